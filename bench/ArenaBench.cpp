@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ArenaBench.cpp
+ * @brief Allocations and time of a table pass, with and without the arena
+ *
+ * Builds INTERFACES synthetic interfaces and renders the interface table
+ * PASSES times three ways, counting heap allocations (every operator new)
+ * and wall time per pass:
+ *
+ *   - LegacyTable: the renderer before the arena, std::string per cell
+ *   - ArenaTable: TableFormatter, cells in its monotonic arena
+ *   - InterfaceTableFormatter::format, cells built from the configs
+ *
+ * The first two get the same cells; their output must match once colour
+ * codes are stripped (the old renderer dropped the reset of a cell exactly
+ * as wide as its column).
+ *
+ *   arena-bench [-n INTERFACES] [-r PASSES]
+ */
+
+#include "InterfaceConfig.hpp"
+#include "InterfaceFlags.hpp"
+#include "InterfaceTableFormatter.hpp"
+#include "InterfaceType.hpp"
+#include "StringUtils.hpp"
+#include "TableRenderers.hpp"
+#include "VRFConfig.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  size_t allocations = 0;
+
+} // namespace
+
+// Counting replacements. Kept out of line: inlined, GCC pairs the
+// library's operator new with free() and warns of a mismatch.
+[[gnu::noinline]] void *operator new(std::size_t n) {
+  ++allocations;
+  if (void *p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+  using Cells = std::array<std::string, 8>;
+
+  std::vector<InterfaceConfig> makeInterfaces(size_t count) {
+    auto vrf = std::make_shared<VRFConfig>();
+    vrf->table = 3;
+    std::vector<InterfaceConfig> out;
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      InterfaceConfig ic;
+      ic.name = "vlan" + std::to_string(i);
+      ic.type = InterfaceType::VLAN;
+      ic.index = static_cast<int>(i + 1);
+      ic.mtu = 1500;
+      ic.flags = i % 7 ? 0x43 : 0x03;
+      ic.address = IPPrefix::v4(0x0a000000u + static_cast<uint32_t>(i), 24);
+      if (i % 2)
+        ic.aliases.push_back(
+            IPPrefix::v4(0x0b000000u + static_cast<uint32_t>(i), 24));
+      if (i % 4 == 0)
+        ic.vrf = vrf;
+      out.push_back(std::move(ic));
+    }
+    return out;
+  }
+
+  // The cells InterfaceTableFormatter builds for an interface.
+  Cells cellsOf(const InterfaceConfig &ic) {
+    std::string addr = ic.address ? ic.address->toString() : "-";
+    for (const auto &a : ic.aliases)
+      addr += "\n" + a.toString();
+    return {ic.index ? "\x1b[1m" + std::to_string(*ic.index) + "\x1b[0m"
+                     : "-",
+            ic.name,
+            interfaceTypeToString(ic.type),
+            addr,
+            ic.flags && hasFlag(*ic.flags, InterfaceFlag::RUNNING)
+                ? "active"
+                : "down",
+            ic.mtu ? std::to_string(*ic.mtu) : "-",
+            ic.vrf ? std::to_string(ic.vrf->table) : "-",
+            ic.flags ? flagsToString(*ic.flags) : "-"};
+  }
+
+  template <typename Table> void addColumns(Table &t) {
+    t.addColumn("Index", "Index", 8, 5, true);
+    t.addColumn("Interface", "Interface", 10, 9, true);
+    t.addColumn("Type", "Type", 9, 13, true);
+    t.addColumn("Address", "Address", 10, 40, true);
+    t.addColumn("Status", "Status", 7, 6, true);
+    t.addColumn("MTU", "MTU", 5, 3, false);
+    t.addColumn("VRF", "VRF", 4, 3, false);
+    t.addColumn("Flags", "Flags", 3, 5, true);
+    t.setSortColumn(0);
+  }
+
+  std::string renderLegacy(const std::vector<Cells> &rows) {
+    LegacyTable t;
+    addColumns(t);
+    for (const auto &c : rows)
+      t.addRow({c.begin(), c.end()});
+    return t.renderTable(200);
+  }
+
+  std::string renderArena(const std::vector<Cells> &rows) {
+    ArenaTable t;
+    addColumns(t);
+    for (const auto &c : rows)
+      t.addRow({c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7]});
+    return t.renderTable(200);
+  }
+
+  struct Result {
+    double allocs = 0;
+    double ms = 0;
+    std::string out;
+  };
+
+  template <typename Fn> Result measure(unsigned passes, Fn render) {
+    Result r;
+    size_t a0 = allocations;
+    auto t0 = Clock::now();
+    for (unsigned k = 0; k < passes; ++k)
+      r.out = render();
+    r.ms = std::chrono::duration<double, std::milli>(Clock::now() - t0)
+               .count() /
+           passes;
+    r.allocs = static_cast<double>(allocations - a0) / passes;
+    return r;
+  }
+
+  void report(const char *name, const Result &r) {
+    std::printf("  %-32s %10.0f allocations %8.2f ms\n", name, r.allocs,
+                r.ms);
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t count = 10000;
+  unsigned passes = 5;
+  int ch;
+  while ((ch = getopt(argc, argv, "n:r:")) != -1) {
+    switch (ch) {
+    case 'n':
+      count = std::strtoul(optarg, nullptr, 10);
+      break;
+    case 'r':
+      passes = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+      break;
+    default:
+      std::cerr << "usage: arena-bench [-n INTERFACES] [-r PASSES]\n";
+      return 1;
+    }
+  }
+  if (count == 0 || passes == 0) {
+    std::cerr << "arena-bench: nothing to render\n";
+    return 1;
+  }
+
+  auto interfaces = makeInterfaces(count);
+  std::vector<Cells> rows;
+  rows.reserve(count);
+  for (const auto &ic : interfaces)
+    rows.push_back(cellsOf(ic));
+
+  Result legacy = measure(passes, [&] { return renderLegacy(rows); });
+  Result arena = measure(passes, [&] { return renderArena(rows); });
+  Result full = measure(passes, [&] {
+    InterfaceTableFormatter f;
+    return f.format(interfaces);
+  });
+
+  std::printf("%zu interfaces, per pass (mean of %u)\n", count, passes);
+  report("LegacyTable (std::string rows)", legacy);
+  report("ArenaTable (TableFormatter)", arena);
+  report("InterfaceTableFormatter::format", full);
+
+  if (strutil::stripAnsi(legacy.out) != strutil::stripAnsi(arena.out)) {
+    std::cerr << "arena-bench: the two renderers disagree\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file DispatchBench.cpp
+ * @brief Replay commands through the parser and dispatcher
+ *
+ * Replays a command mix (or the lines of FILE) until COUNT commands have
+ * run, against a NullConfigurationManager, and reports the cost per
+ * command of each stage: tokenize and parse, the handler table lookup,
+ * and the full dispatch including the handler. Handler output is
+ * discarded.
+ *
+ *   dispatch-bench [-n COUNT] [FILE]
+ */
+
+#include "CommandDispatcher.hpp"
+#include "NullConfigurationManager.hpp"
+#include "Parser.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  // One of each command shape the CLI sees most.
+  const char *const kMix[] = {
+      "set interface name lo1 type loopback mtu 16384 status up",
+      "set interface name eth0 mtu 1400 address 192.0.2.2/24 status up",
+      "set interface name eth0 address fd00::2/64",
+      "set interface name tap3 type tap queues 4 owner root",
+      "set nexthop-group core nexthop 192.0.2.1 interface eth0",
+      "set route protocol static dest 10.50.0.0/16 nexthop-group core",
+      "set route protocol static dest 0.0.0.0/0 nexthop 192.0.2.1",
+      "set route protocol static dest 198.51.100.0/24 nexthop 192.0.2.1 "
+      "vrf 3",
+      "set route protocol static dest ::/0 nexthop fd00::1 interface eth0",
+      "set vrf name blue table 3",
+      "set policy access-list 5 rule 10 action deny source 10.0.0.0/8",
+      "delete route protocol static dest 203.0.113.0/24",
+      "delete nexthop-group core",
+      "show interface",
+      "show route",
+  };
+
+  class NullBuffer : public std::streambuf {
+  protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override {
+      return n;
+    }
+  };
+
+  double nsPer(std::chrono::steady_clock::duration d, size_t n) {
+    return std::chrono::duration<double, std::nano>(d).count() /
+           static_cast<double>(n);
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t count = 100000;
+  int ch;
+  while ((ch = getopt(argc, argv, "n:")) != -1) {
+    if (ch != 'n') {
+      std::cerr << "usage: dispatch-bench [-n COUNT] [FILE]\n";
+      return 1;
+    }
+    count = std::strtoul(optarg, nullptr, 10);
+  }
+
+  std::vector<std::string> lines;
+  if (optind < argc) {
+    std::ifstream in(argv[optind]);
+    if (!in) {
+      std::perror(argv[optind]);
+      return 1;
+    }
+    for (std::string line; std::getline(in, line);)
+      if (!line.empty() && line[0] != '#')
+        lines.push_back(line);
+  } else {
+    lines.assign(std::begin(kMix), std::end(kMix));
+  }
+  if (lines.empty() || count == 0) {
+    std::cerr << "dispatch-bench: nothing to replay\n";
+    return 1;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  netcli::Parser parser;
+  netcli::CommandDispatcher dispatcher;
+  NullConfigurationManager mgr;
+  std::string scratch;
+
+  // Tokenize and parse, keeping the commands for the stages below.
+  std::vector<std::unique_ptr<Command>> cmds;
+  cmds.reserve(count);
+  size_t rejected = 0;
+  auto t0 = Clock::now();
+  for (size_t i = 0; i < count; ++i) {
+    auto cmd = parser.parse(parser.tokenize(lines[i % lines.size()], scratch));
+    if (cmd && cmd->head() && cmd->head()->getNext())
+      cmds.push_back(std::move(cmd));
+    else
+      ++rejected;
+  }
+  auto parsed = Clock::now() - t0;
+  if (cmds.empty()) {
+    std::cerr << "dispatch-bench: no command parsed\n";
+    return 1;
+  }
+
+  // The table lookup dispatch() performs, without the handler.
+  size_t found = 0;
+  t0 = Clock::now();
+  for (const auto &cmd : cmds) {
+    const auto &head = cmd->head();
+    auto verb = head->kind() == TokenKind::Show  ? netcli::Verb::Show
+                : head->kind() == TokenKind::Set ? netcli::Verb::Set
+                                                 : netcli::Verb::Delete;
+    found += netcli::CommandDispatcher::handler(
+                 verb, head->getNext()->kind()) != nullptr;
+  }
+  auto looked = Clock::now() - t0;
+
+  // Full dispatch with the handlers' output discarded.
+  NullBuffer null;
+  auto *out = std::cout.rdbuf(&null);
+  auto *err = std::cerr.rdbuf(&null);
+  size_t failed = 0;
+  t0 = Clock::now();
+  for (const auto &cmd : cmds) {
+    try {
+      dispatcher.dispatch(cmd->head(), &mgr);
+    } catch (const std::exception &) {
+      ++failed;
+    }
+  }
+  auto dispatched = Clock::now() - t0;
+  std::cout.rdbuf(out);
+  std::cerr.rdbuf(err);
+
+  size_t n = cmds.size();
+  std::printf("%zu commands (%zu distinct), %zu rejected by the parser\n",
+              count, lines.size(), rejected);
+  std::printf("  tokenize+parse  %10.1f ns/command\n", nsPer(parsed, count));
+  std::printf("  handler lookup  %10.1f ns/command (%zu with a handler)\n",
+              nsPer(looked, n), found);
+  std::printf("  dispatch        %10.1f ns/command (%zu threw)\n",
+              nsPer(dispatched, n), failed);
+  return 0;
+}
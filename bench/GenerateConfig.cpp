@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file GenerateConfig.cpp
+ * @brief Synthetic configuration for the parse benchmarks
+ *
+ * Writes a configuration shaped like the output of `net -g` on a large
+ * aggregation router: VLAN interfaces, nexthop groups, access lists and,
+ * for most of the lines, static routes across a few VRFs. The output
+ * depends only on the line count and seed, so runs can be compared.
+ *
+ *   gen-config [-l LINES] [-s SEED] > FILE
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <unistd.h>
+
+namespace {
+
+  constexpr unsigned kGroups = 16;
+  constexpr unsigned kMaxVlans = 4094;
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  unsigned long lines = 400000;
+  unsigned long seed = 1;
+  int ch;
+  while ((ch = getopt(argc, argv, "l:s:")) != -1) {
+    switch (ch) {
+    case 'l':
+      lines = std::strtoul(optarg, nullptr, 10);
+      break;
+    case 's':
+      seed = std::strtoul(optarg, nullptr, 10);
+      break;
+    default:
+      std::cerr << "usage: gen-config [-l LINES] [-s SEED]\n";
+      return 1;
+    }
+  }
+
+  // One VLAN per 200 lines and one access-list rule per 500; the rest
+  // are routes.
+  unsigned long vlans = std::min<unsigned long>(lines / 200 + 1, kMaxVlans);
+  unsigned long rules = lines / 500;
+  unsigned long fixed = 1 + vlans + kGroups + rules;
+  unsigned long routes = lines > fixed ? lines - fixed : 0;
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+
+  std::printf("# synthetic configuration: %lu lines, seed %lu\n", lines, seed);
+  for (unsigned long v = 0; v < vlans; ++v)
+    std::printf("set interface name eth0.%lu type vlan inet address "
+                "10.%lu.%lu.1/24 vid %lu parent eth0 mtu 9000 status up\n",
+                v + 1, v / 256, v % 256, v + 1);
+  for (unsigned g = 0; g < kGroups; ++g)
+    std::printf("set nexthop-group uplink%u nexthop 10.0.%u.2 "
+                "nexthop 10.0.%u.2 weight 2\n",
+                g, 2 * g, 2 * g + 1);
+  for (unsigned long i = 0; i < routes; ++i) {
+    // Prefixes are unique; one route in four is IPv6 and one in eight
+    // sits in a VRF.
+    unsigned long vlan = rng() % vlans;
+    unsigned r = rng();
+    if (r % 4 == 0)
+      std::printf("set route protocol static dest 2001:db8:%lx:%lx::/64",
+                  i >> 16, i & 0xffff);
+    else
+      std::printf("set route protocol static dest %lu.%lu.%lu.0/24",
+                  20 + (i >> 16) % 200, (i >> 8) & 255, i & 255);
+    if (r % 4 != 0 && r % 3 == 0)
+      std::printf(" nexthop-group uplink%u", (r >> 8) % kGroups);
+    else if (r % 4 != 0)
+      std::printf(" nexthop 10.%lu.%lu.2 interface eth0.%lu", vlan / 256,
+                  vlan % 256, vlan + 1);
+    else
+      std::printf(" interface eth0.%lu", vlan + 1);
+    if ((r >> 4) % 8 == 0)
+      std::printf(" vrf %u", 1 + (r >> 12) % 4);
+    std::printf("\n");
+  }
+  for (unsigned long i = 0; i < rules; ++i)
+    std::printf("set policy access-list %lu rule %lu action %s source "
+                "10.%lu.%lu.0/24\n",
+                100 + i / 50, 10 * (i % 50 + 1), rng() % 2 ? "permit" : "deny",
+                (i >> 8) & 255, i & 255);
+  return 0;
+}
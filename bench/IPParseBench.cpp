@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file IPParseBench.cpp
+ * @brief Parse and format prefixes: IPPrefix against inet_pton/stoi
+ *
+ * Generates COUNT prefixes, a mix of IPv4 and IPv6 in the canonical
+ * form inet_ntop writes, then parses and re-formats each one three ways
+ * and reports the cost per prefix:
+ *
+ *   - the path IPPrefix replaced: substr at '/', inet_pton, std::stoi,
+ *     then inet_ntop and std::to_string
+ *   - IPPrefix::fromString and toString
+ *   - IPPrefix::fromChars and toChars into a stack buffer
+ *
+ * Every path must reproduce its input; a mismatch is reported and fails
+ * the run.
+ *
+ *   ip-parse-bench [-n COUNT] [-6 PERCENT] [-s SEED]
+ */
+
+#include "IPPrefix.hpp"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  std::vector<std::string> makePrefixes(size_t count, unsigned v6Percent,
+                                        unsigned long seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> out;
+    out.reserve(count);
+    char buf[INET6_ADDRSTRLEN];
+    for (size_t i = 0; i < count; ++i) {
+      if (rng() % 100 < v6Percent) {
+        unsigned char a[16];
+        uint64_t hi = rng(), lo = rng();
+        // Zero runs of varying length exercise the "::" compression.
+        if (rng() % 2)
+          lo &= ~0ull << (16 * (rng() % 4));
+        hi = (hi & 0x0000ffffffffffffull) | 0x2001000000000000ull;
+        for (int b = 0; b < 8; ++b) {
+          a[b] = static_cast<unsigned char>(hi >> (56 - 8 * b));
+          a[8 + b] = static_cast<unsigned char>(lo >> (56 - 8 * b));
+        }
+        inet_ntop(AF_INET6, a, buf, sizeof(buf));
+        out.push_back(std::string(buf) + "/" + std::to_string(rng() % 129));
+      } else {
+        uint32_t v = htonl(static_cast<uint32_t>(rng()));
+        inet_ntop(AF_INET, &v, buf, sizeof(buf));
+        out.push_back(std::string(buf) + "/" + std::to_string(rng() % 33));
+      }
+    }
+    return out;
+  }
+
+  // The parse and format code IPPrefix replaced.
+  std::string legacyRoundTrip(const std::string &s) {
+    auto slash = s.find('/');
+    std::string addr = s.substr(0, slash);
+    int len = std::stoi(s.substr(slash + 1));
+    unsigned char bytes[16];
+    int af = AF_INET;
+    if (inet_pton(AF_INET, addr.c_str(), bytes) != 1) {
+      af = AF_INET6;
+      if (inet_pton(AF_INET6, addr.c_str(), bytes) != 1)
+        return {};
+    }
+    char buf[INET6_ADDRSTRLEN];
+    inet_ntop(af, bytes, buf, sizeof(buf));
+    return std::string(buf) + "/" + std::to_string(len);
+  }
+
+  std::string stringRoundTrip(const std::string &s) {
+    auto p = IPPrefix::fromString(s);
+    return p ? p->toString() : std::string();
+  }
+
+  struct Result {
+    double ns = 0;
+    size_t mismatches = 0;
+  };
+
+  template <typename Fn>
+  Result run(const std::vector<std::string> &prefixes, Fn roundTrip) {
+    Result r;
+    auto t0 = Clock::now();
+    for (const auto &s : prefixes)
+      if (!roundTrip(s))
+        ++r.mismatches;
+    r.ns = std::chrono::duration<double, std::nano>(Clock::now() - t0)
+               .count() /
+           static_cast<double>(prefixes.size());
+    return r;
+  }
+
+  void report(const char *name, const Result &r, double base) {
+    std::printf("  %-22s %8.1f ns/prefix  %5.2fx", name, r.ns, base / r.ns);
+    if (r.mismatches)
+      std::printf("  %zu MISMATCHED", r.mismatches);
+    std::printf("\n");
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t count = 1000000;
+  unsigned v6Percent = 50;
+  unsigned long seed = 1;
+  int ch;
+  while ((ch = getopt(argc, argv, "n:6:s:")) != -1) {
+    switch (ch) {
+    case 'n':
+      count = std::strtoul(optarg, nullptr, 10);
+      break;
+    case '6':
+      v6Percent = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+      break;
+    case 's':
+      seed = std::strtoul(optarg, nullptr, 10);
+      break;
+    default:
+      std::cerr << "usage: ip-parse-bench [-n COUNT] [-6 PERCENT] [-s SEED]\n";
+      return 1;
+    }
+  }
+  if (count == 0) {
+    std::cerr << "ip-parse-bench: nothing to parse\n";
+    return 1;
+  }
+
+  auto prefixes = makePrefixes(count, v6Percent, seed);
+
+  Result legacy = run(prefixes, [](const std::string &s) {
+    return legacyRoundTrip(s) == s;
+  });
+  Result strings = run(prefixes, [](const std::string &s) {
+    return stringRoundTrip(s) == s;
+  });
+  Result chars = run(prefixes, [](const std::string &s) {
+    IPPrefix p;
+    auto end = s.data() + s.size();
+    auto r = IPPrefix::fromChars(s.data(), end, p);
+    if (r.ec != std::errc() || r.ptr != end)
+      return false;
+    char buf[ipchars::kMaxPrefixChars];
+    auto w = p.toChars(buf, buf + sizeof(buf));
+    return size_t(w.ptr - buf) == s.size() &&
+           std::memcmp(buf, s.data(), s.size()) == 0;
+  });
+
+  std::printf("%zu prefixes, %u%% IPv6, parsed and formatted back\n", count,
+              v6Percent);
+  report("inet_pton + stoi", legacy, legacy.ns);
+  report("fromString/toString", strings, legacy.ns);
+  report("fromChars/toChars", chars, legacy.ns);
+  return legacy.mismatches || strings.mismatches || chars.mismatches ? 1 : 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file NullConfigurationManager.hpp
+ * @brief ConfigurationManager that does nothing, for the benchmarks
+ *
+ * Queries return empty results and mutations succeed without touching the
+ * system, so a benchmark measures the client-side path (tokenize, parse,
+ * dispatch) and not the kernel.
+ */
+
+#pragma once
+
+#include "ArpConfig.hpp"
+#include "BridgeInterfaceConfig.hpp"
+#include "CarpInterfaceConfig.hpp"
+#include "ConfigurationManager.hpp"
+#include "EpairInterfaceConfig.hpp"
+#include "GifInterfaceConfig.hpp"
+#include "GreInterfaceConfig.hpp"
+#include "InterfaceConfig.hpp"
+#include "IpsecInterfaceConfig.hpp"
+#include "LaggInterfaceConfig.hpp"
+#include "NdpConfig.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "OvpnInterfaceConfig.hpp"
+#include "PflogInterfaceConfig.hpp"
+#include "PfsyncInterfaceConfig.hpp"
+#include "PolicyConfig.hpp"
+#include "RouteConfig.hpp"
+#include "SixToFourInterfaceConfig.hpp"
+#include "TapInterfaceConfig.hpp"
+#include "TunInterfaceConfig.hpp"
+#include "VRFConfig.hpp"
+#include "VlanInterfaceConfig.hpp"
+#include "VxlanInterfaceConfig.hpp"
+#include "WlanInterfaceConfig.hpp"
+
+class NullConfigurationManager : public ConfigurationManager {
+public:
+  bool SupportsConcurrentQueries() const override { return true; }
+
+  std::vector<InterfaceConfig>
+  GetInterfaces(const std::optional<VRFConfig> &) const override { return {}; }
+  std::vector<InterfaceConfig>
+  GetInterfacesByGroup(const std::optional<VRFConfig> &,
+                       std::string_view) const override {
+    return {};
+  }
+  std::vector<BridgeInterfaceConfig>
+  GetBridgeInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<LaggInterfaceConfig>
+  GetLaggInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<VlanInterfaceConfig>
+  GetVLANInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<TunInterfaceConfig>
+  GetTunInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<TapInterfaceConfig>
+  GetTapInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<GifInterfaceConfig>
+  GetGifInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<OvpnInterfaceConfig>
+  GetOvpnInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<IpsecInterfaceConfig>
+  GetIpsecInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<GreInterfaceConfig>
+  GetGreInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<VxlanInterfaceConfig>
+  GetVxlanInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<EpairInterfaceConfig>
+  GetEpairInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<WlanInterfaceConfig>
+  GetWlanInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<CarpInterfaceConfig>
+  GetCarpInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<SixToFourInterfaceConfig>
+  GetSixToFourInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<PflogInterfaceConfig>
+  GetPflogInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<PfsyncInterfaceConfig>
+  GetPfsyncInterfaces(const std::vector<InterfaceConfig> &) const override {
+    return {};
+  }
+  std::vector<RouteConfig>
+  GetStaticRoutes(const std::optional<VRFConfig> &) const override {
+    return {};
+  }
+  std::vector<RouteConfig>
+  GetRoutes(const std::optional<VRFConfig> &) const override { return {}; }
+  std::vector<VRFConfig> GetVrfs() const override { return {}; }
+  std::vector<ArpConfig>
+  GetArpEntries(const std::optional<std::string> &,
+                const std::optional<std::string> &) const override {
+    return {};
+  }
+  bool
+  SetArpEntry(const std::string &, const std::string &,
+              const std::optional<std::string> &, bool, bool) const override {
+    return true;
+  }
+  bool
+  DeleteArpEntry(const std::string &,
+                 const std::optional<std::string> &) const override {
+    return true;
+  }
+  std::vector<NdpConfig>
+  GetNdpEntries(const std::optional<std::string> &,
+                const std::optional<std::string> &) const override {
+    return {};
+  }
+  bool
+  SetNdpEntry(const std::string &, const std::string &,
+              const std::optional<std::string> &, bool) const override {
+    return true;
+  }
+  bool
+  DeleteNdpEntry(const std::string &,
+                 const std::optional<std::string> &) const override {
+    return true;
+  }
+  void CreateInterface(const std::string &) const override {}
+  void SaveInterface(const InterfaceConfig &) const override {}
+  void DestroyInterface(const std::string &) const override {}
+  void
+  RemoveInterfaceAddress(const std::string &,
+                         const std::string &) const override {
+  }
+  void
+  RemoveInterfaceGroup(const std::string &,
+                       const std::string &) const override {
+  }
+  bool InterfaceExists(std::string_view) const override { return false; }
+  std::vector<std::string>
+  GetInterfaceAddresses(const std::string &, int) const override { return {}; }
+  void CreateBridge(const std::string &) const override {}
+  void SaveBridge(const BridgeInterfaceConfig &) const override {}
+  std::vector<std::string>
+  GetBridgeMembers(const std::string &) const override { return {}; }
+  void CreateLagg(const std::string &) const override {}
+  void SaveLagg(const LaggInterfaceConfig &) const override {}
+  void SaveVlan(const VlanInterfaceConfig &) const override {}
+  void CreateTun(const std::string &) const override {}
+  void SaveTun(const TunInterfaceConfig &) const override {}
+  void CreateGif(const std::string &) const override {}
+  void SaveGif(const GifInterfaceConfig &) const override {}
+  void CreateOvpn(const std::string &) const override {}
+  void SaveOvpn(const OvpnInterfaceConfig &) const override {}
+  void CreateIpsec(const std::string &) const override {}
+  void SaveIpsec(const IpsecInterfaceConfig &) const override {}
+  void CreateWlan(const std::string &) const override {}
+  void SaveWlan(const WlanInterfaceConfig &) const override {}
+  void CreateTap(const std::string &) const override {}
+  void SaveTap(const TapInterfaceConfig &) const override {}
+  void CreateGre(const std::string &) const override {}
+  void SaveGre(const GreInterfaceConfig &) const override {}
+  void CreateVxlan(const std::string &) const override {}
+  void SaveVxlan(const VxlanInterfaceConfig &) const override {}
+  void CreateSixToFour(const std::string &) const override {}
+  void SaveSixToFour(const SixToFourInterfaceConfig &) const override {}
+  void DestroySixToFour(const std::string &) const override {}
+  void CreatePflog(const std::string &) const override {}
+  void SavePflog(const PflogInterfaceConfig &) const override {}
+  void DestroyPflog(const std::string &) const override {}
+  void CreatePfsync(const std::string &) const override {}
+  void SavePfsync(const PfsyncInterfaceConfig &) const override {}
+  void DestroyPfsync(const std::string &) const override {}
+  void SaveCarp(const CarpInterfaceConfig &) const override {}
+  void AddRoute(const RouteConfig &) const override {}
+  void DeleteRoute(const RouteConfig &) const override {}
+  std::vector<NexthopGroupConfig>
+  GetNexthopGroups() const override { return {}; }
+  void SetNexthopGroup(const NexthopGroupConfig &) const override {}
+  void DeleteNexthopGroup(const NexthopGroupConfig &) const override {}
+  std::vector<PolicyConfig>
+  GetPolicies(const std::optional<uint32_t> &) const override { return {}; }
+  void SetPolicy(const PolicyConfig &) const override {}
+  void DeletePolicy(const PolicyConfig &) const override {}
+  void CreateEpair(const std::string &) const override {}
+  void SaveEpair(const EpairInterfaceConfig &) const override {}
+  void CreateVrf(const VRFConfig &) const override {}
+  void DeleteVrf(const std::string &) const override {}
+};
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ParseBench.cpp
+ * @brief Scaling of the parallel script parser across cores
+ *
+ * Maps FILE with ScriptFile and runs the per-line step `net apply` uses
+ * (tokenize, parse, and reduce `set route` lines to RouteConfig) with 1,
+ * 2, 4, ... workers up to THREADS. Each count runs REPEAT times and the
+ * fastest run is reported, along with a check that the result is in file
+ * order and matches the single-worker run.
+ *
+ *   parse-bench [-t THREADS] [-r REPEAT] FILE
+ *
+ * gen-config writes a suitable FILE.
+ */
+
+#include "RouteToken.hpp"
+#include "ScriptFile.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  struct Parsed {
+    size_t lineno;
+    bool ok;
+    std::optional<RouteConfig> route;
+  };
+
+  Parsed step(netcli::ScriptFile::Line &l) {
+    Parsed p{l.lineno, l.cmd && l.cmd->head(), std::nullopt};
+    if (!p.ok)
+      return p;
+    const auto &head = l.cmd->head();
+    const Token *target = head->getNext().get();
+    if (head->kind() == TokenKind::Set && target &&
+        target->kind() == TokenKind::Route) {
+      const auto &rt = static_cast<const RouteToken &>(*target);
+      if (!rt.isNexthopGroup())
+        p.route = rt.toConfig();
+    }
+    return p;
+  }
+
+  bool sameResult(const std::vector<Parsed> &a, const std::vector<Parsed> &b) {
+    if (a.size() != b.size())
+      return false;
+    for (size_t i = 0; i < a.size(); ++i)
+      if (a[i].lineno != b[i].lineno || a[i].ok != b[i].ok ||
+          a[i].route.has_value() != b[i].route.has_value())
+        return false;
+    return true;
+  }
+
+  bool inOrder(const std::vector<Parsed> &v) {
+    for (size_t i = 1; i < v.size(); ++i)
+      if (v[i].lineno <= v[i - 1].lineno)
+        return false;
+    return true;
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  unsigned repeat = 3;
+  int ch;
+  while ((ch = getopt(argc, argv, "t:r:")) != -1) {
+    switch (ch) {
+    case 't':
+      maxThreads = std::max(1ul, std::strtoul(optarg, nullptr, 10));
+      break;
+    case 'r':
+      repeat = std::max(1ul, std::strtoul(optarg, nullptr, 10));
+      break;
+    default:
+      optind = argc + 1;
+      break;
+    }
+  }
+  if (optind != argc - 1) {
+    std::cerr << "usage: parse-bench [-t THREADS] [-r REPEAT] FILE\n";
+    return 1;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  std::optional<netcli::ScriptFile> script;
+  try {
+    script.emplace(argv[optind]);
+  } catch (const std::exception &e) {
+    std::cerr << "parse-bench: " << e.what() << "\n";
+    return 1;
+  }
+
+  std::vector<unsigned> counts;
+  for (unsigned t = 1; t < maxThreads; t *= 2)
+    counts.push_back(t);
+  counts.push_back(maxThreads);
+
+  std::vector<Parsed> reference;
+  double base = 0;
+  for (unsigned threads : counts) {
+    double best = 0;
+    std::vector<Parsed> result;
+    for (unsigned r = 0; r < repeat; ++r) {
+      auto t0 = Clock::now();
+      result = script->map(step, threads);
+      double s = std::chrono::duration<double>(Clock::now() - t0).count();
+      if (r == 0 || s < best)
+        best = s;
+    }
+
+    if (reference.empty()) {
+      reference = std::move(result);
+      base = best;
+      size_t ok = 0, routes = 0;
+      for (const auto &p : reference) {
+        ok += p.ok;
+        routes += p.route.has_value();
+      }
+      std::printf("%s: %zu commands, %zu parsed, %zu routes; %u cores\n",
+                  argv[optind], reference.size(), ok, routes,
+                  std::thread::hardware_concurrency());
+      std::printf("threads   seconds    lines/s  speedup  result\n");
+      result = reference;
+    }
+    bool same = inOrder(result) && sameResult(result, reference);
+    std::printf("%7u %9.3f %10.0f %8.2f  %s\n", threads, best,
+                static_cast<double>(result.size()) / best, base / best,
+                same ? "ok" : "MISMATCH");
+    if (!same)
+      return 1;
+  }
+  return 0;
+}
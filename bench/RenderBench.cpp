@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file RenderBench.cpp
+ * @brief Time and peak memory of rendering a very large table
+ *
+ * Renders ROWS three-column rows (index, destination, gateway; the index
+ * column out of order, so the sort does work) three ways:
+ *
+ *   - legacy: the renderer before the arena (TableRenderers.hpp), which
+ *     copies the rows to sort them and builds the whole text in memory
+ *   - string: TableFormatter::renderTable(int), returning one string
+ *   - stream: TableFormatter::renderTable(std::ostream &), in chunks
+ *
+ * Each runs in a child process, so its peak RSS is its own. The output is
+ * hashed instead of written out; all three must produce the same bytes.
+ *
+ *   render-bench [-n ROWS]
+ */
+
+#include "TableRenderers.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Result {
+    double ms = 0;
+    long maxRssKb = 0;
+    uint64_t hash = 0;
+    uint64_t bytes = 0;
+  };
+
+  // FNV-1a over everything written, so the stream mode keeps no text.
+  class HashBuffer : public std::streambuf {
+  public:
+    uint64_t hash = 0xcbf29ce484222325ull;
+    uint64_t bytes = 0;
+
+    void add(const char *s, size_t n) {
+      for (size_t i = 0; i < n; ++i) {
+        hash ^= static_cast<unsigned char>(s[i]);
+        hash *= 0x100000001b3ull;
+      }
+      bytes += n;
+    }
+
+  protected:
+    int overflow(int c) override {
+      if (c != traits_type::eof()) {
+        char ch = static_cast<char>(c);
+        add(&ch, 1);
+      }
+      return c;
+    }
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+      add(s, static_cast<size_t>(n));
+      return n;
+    }
+  };
+
+  // Row i: a shuffled index, a /24 and a gateway inside it.
+  void cells(size_t i, size_t rows, std::string &index, std::string &dest,
+             std::string &gw) {
+    uint32_t net = 0x0a000000u + static_cast<uint32_t>(i << 8);
+    auto quad = [](uint32_t a) {
+      return std::to_string(a >> 24) + "." + std::to_string(a >> 16 & 255) +
+             "." + std::to_string(a >> 8 & 255) + "." +
+             std::to_string(a & 255);
+    };
+    index = std::to_string((i * 7919) % rows + 1);
+    dest = quad(net) + "/24";
+    gw = quad(net + 1);
+  }
+
+  template <typename Table> void addColumns(Table &t) {
+    t.addColumn("Index", "Index", 8, 5, false);
+    t.addColumn("Destination", "Destination", 10, 11, true);
+    t.addColumn("Gateway", "Gateway", 9, 7, true);
+    t.setSortColumn(0);
+  }
+
+  Result run(const std::string &mode, size_t rows) {
+    HashBuffer sink;
+    std::string index, dest, gw;
+    auto t0 = Clock::now();
+    if (mode == "legacy") {
+      LegacyTable t;
+      addColumns(t);
+      for (size_t i = 0; i < rows; ++i) {
+        cells(i, rows, index, dest, gw);
+        t.addRow({index, dest, gw});
+      }
+      std::string out = t.renderTable();
+      sink.add(out.data(), out.size());
+    } else {
+      ArenaTable t;
+      addColumns(t);
+      for (size_t i = 0; i < rows; ++i) {
+        cells(i, rows, index, dest, gw);
+        t.addRow({index, dest, gw});
+      }
+      if (mode == "string") {
+        std::string out = t.renderTable();
+        sink.add(out.data(), out.size());
+      } else {
+        std::ostream os(&sink);
+        t.renderTable(os);
+      }
+    }
+    Result r;
+    r.ms = std::chrono::duration<double, std::milli>(Clock::now() - t0)
+               .count();
+    struct rusage ru{};
+    getrusage(RUSAGE_SELF, &ru);
+    r.maxRssKb = ru.ru_maxrss;
+    r.hash = sink.hash;
+    r.bytes = sink.bytes;
+    return r;
+  }
+
+  // Run `mode` in a child and read its Result back through a pipe.
+  bool runChild(const std::string &mode, size_t rows, Result &r) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+      std::perror("pipe");
+      return false;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+      std::perror("fork");
+      return false;
+    }
+    if (pid == 0) {
+      close(fds[0]);
+      Result out = run(mode, rows);
+      bool ok = write(fds[1], &out, sizeof(out)) == sizeof(out);
+      _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    bool ok = read(fds[0], &r, sizeof(r)) == sizeof(r);
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t rows = 1000000;
+  int ch;
+  while ((ch = getopt(argc, argv, "n:")) != -1) {
+    if (ch != 'n') {
+      std::cerr << "usage: render-bench [-n ROWS]\n";
+      return 1;
+    }
+    rows = std::strtoul(optarg, nullptr, 10);
+  }
+  if (rows == 0) {
+    std::cerr << "render-bench: nothing to render\n";
+    return 1;
+  }
+
+  std::printf("%zu rows, 3 columns\n", rows);
+  const char *const modes[] = {"legacy", "string", "stream"};
+  Result first;
+  bool differ = false;
+  for (const char *mode : modes) {
+    Result r;
+    if (!runChild(mode, rows, r)) {
+      std::cerr << "render-bench: " << mode << " run failed\n";
+      return 1;
+    }
+    std::printf("  %-7s %9.1f ms %8.1f MB max RSS %12llu bytes\n", mode, r.ms,
+                static_cast<double>(r.maxRssKb) / 1024,
+                static_cast<unsigned long long>(r.bytes));
+    if (mode == modes[0])
+      first = r;
+    else if (r.hash != first.hash || r.bytes != first.bytes)
+      differ = true;
+  }
+  if (differ) {
+    std::cerr << "render-bench: the renderers' output differs\n";
+    return 1;
+  }
+  return 0;
+}
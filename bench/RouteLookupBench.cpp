@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file RouteLookupBench.cpp
+ * @brief Build and query a RouteLookupTable over a synthetic route dump
+ *
+ * Generates V4 IPv4 and V6 IPv6 routes (plus a default for each family),
+ * compiles them into a RouteLookupTable and reports the build time and
+ * the cost per lookup for LOOKUPS addresses in random order and in sorted
+ * order. Random queries over prefixes without locality are bound by cache
+ * misses; sorted ones show the cache-warm cost. A sample of the answers
+ * is checked against a linear longest-prefix scan.
+ *
+ *   route-lookup-bench [-4 V4] [-6 V6] [-n LOOKUPS] [-s SEED]
+ */
+
+#include "IPPrefix.hpp"
+#include "RouteConfig.hpp"
+#include "RouteLookupTable.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  // Answers checked against the linear scan.
+  constexpr size_t kChecked = 100;
+
+  // A global unicast address, in 2000::/3.
+  IPPrefix randomV6(std::mt19937_64 &rng, uint8_t len = 128) {
+    unsigned __int128 a = (unsigned __int128)rng() << 64 | rng();
+    return IPPrefix::v6(a >> 3 | (unsigned __int128)1 << 125, len);
+  }
+
+  RouteConfig route(const IPPrefix &prefix) {
+    RouteConfig rc;
+    rc.prefix = prefix.network();
+    rc.nexthop = IPPrefix::fromString(prefix.isV4() ? "192.0.2.1" : "fd00::1");
+    rc.flags = RouteConfig::Flag(RouteConfig::UP) |
+               RouteConfig::Flag(RouteConfig::GATEWAY);
+    return rc;
+  }
+
+  std::vector<RouteConfig> makeRoutes(size_t v4, size_t v6,
+                                      std::mt19937_64 &rng) {
+    std::vector<RouteConfig> out;
+    out.reserve(v4 + v6 + 2);
+    out.push_back(route(IPPrefix::v4(0, 0)));
+    out.push_back(route(IPPrefix::v6(0, 0)));
+    // Mostly /24s with a spread of shorter and host routes, as in a
+    // full table.
+    for (size_t i = 0; i < v4; ++i) {
+      unsigned r = rng() % 100;
+      uint8_t len = r < 60   ? 24
+                    : r < 90 ? uint8_t(16 + rng() % 8)
+                             : uint8_t(25 + rng() % 8);
+      out.push_back(route(IPPrefix::v4(static_cast<uint32_t>(rng()), len)));
+    }
+    for (size_t i = 0; i < v6; ++i) {
+      unsigned r = rng() % 100;
+      uint8_t len = r < 50   ? 48
+                    : r < 90 ? uint8_t(29 + rng() % 19)
+                             : uint8_t(49 + rng() % 80);
+      out.push_back(route(randomV6(rng, len)));
+    }
+    return out;
+  }
+
+  // Longest match by scanning every route; the first of equals wins.
+  const RouteConfig *scan(const std::vector<RouteConfig> &routes,
+                          const IPPrefix &addr) {
+    const RouteConfig *best = nullptr;
+    for (const auto &rc : routes)
+      if (rc.prefix.af() == addr.af() && rc.prefix.contains(addr) &&
+          (!best || rc.prefix.length() > best->prefix.length()))
+        best = &rc;
+    return best;
+  }
+
+  double nsPerLookup(const RouteLookupTable &table,
+                     const std::vector<IPPrefix> &addrs, size_t &misses) {
+    misses = 0;
+    auto t0 = Clock::now();
+    for (const auto &a : addrs)
+      misses += table.lookup(a) == nullptr;
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0)
+               .count() /
+           static_cast<double>(addrs.size());
+  }
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  size_t v4 = 900000, v6 = 200000, lookups = 1000000;
+  unsigned long seed = 1;
+  int ch;
+  while ((ch = getopt(argc, argv, "4:6:n:s:")) != -1) {
+    switch (ch) {
+    case '4':
+      v4 = std::strtoul(optarg, nullptr, 10);
+      break;
+    case '6':
+      v6 = std::strtoul(optarg, nullptr, 10);
+      break;
+    case 'n':
+      lookups = std::strtoul(optarg, nullptr, 10);
+      break;
+    case 's':
+      seed = std::strtoul(optarg, nullptr, 10);
+      break;
+    default:
+      std::cerr << "usage: route-lookup-bench [-4 V4] [-6 V6] [-n LOOKUPS] "
+                   "[-s SEED]\n";
+      return 1;
+    }
+  }
+  if (lookups == 0) {
+    std::cerr << "route-lookup-bench: nothing to look up\n";
+    return 1;
+  }
+
+  std::mt19937_64 rng(seed);
+  auto routes = makeRoutes(v4, v6, rng);
+
+  // Queries in the same proportion of families as the routes.
+  std::vector<IPPrefix> addrs;
+  addrs.reserve(lookups);
+  for (size_t i = 0; i < lookups; ++i) {
+    if (rng() % (v4 + v6 + 2) < v4 + 1)
+      addrs.push_back(IPPrefix::v4(static_cast<uint32_t>(rng())));
+    else
+      addrs.push_back(randomV6(rng));
+  }
+
+  auto t0 = Clock::now();
+  RouteLookupTable table(routes);
+  double buildMs =
+      std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+  size_t misses = 0;
+  double random = nsPerLookup(table, addrs, misses);
+  auto sorted = addrs;
+  std::sort(sorted.begin(), sorted.end());
+  double warm = nsPerLookup(table, sorted, misses);
+
+  size_t wrong = 0;
+  for (size_t i = 0; i < std::min(kChecked, addrs.size()); ++i) {
+    const RouteConfig *got = table.lookup(addrs[i]);
+    const RouteConfig *want = scan(routes, addrs[i]);
+    if (!got || !want || got->prefix != want->prefix)
+      ++wrong;
+  }
+
+  std::printf("%zu IPv4 + %zu IPv6 routes: built in %.1f ms, %zu nodes\n",
+              v4 + 1, v6 + 1, buildMs, table.nodeCount());
+  std::printf("  %zu lookups, random order  %8.1f ns/lookup\n", lookups,
+              random);
+  std::printf("  %zu lookups, sorted order  %8.1f ns/lookup\n", lookups,
+              warm);
+  if (misses || wrong) {
+    std::printf("  %zu unmatched, %zu of %zu differ from a linear scan\n",
+                misses, wrong, std::min(kChecked, addrs.size()));
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file TableRenderers.hpp
+ * @brief The table renderer before the arena, and TableFormatter, side by
+ * side for the benchmarks
+ *
+ * LegacyTable is the renderer TableFormatter had before it moved its cells
+ * into an arena: a vector of std::string per row, a deep copy of the rows
+ * to sort them, cells split through an istringstream, and the whole table
+ * built in one ostringstream. ArenaTable exposes the current TableFormatter
+ * with the same interface, so a benchmark can feed both the same cells and
+ * compare the output.
+ */
+
+#pragma once
+
+#include "StringUtils.hpp"
+#include "TableFormatter.hpp"
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class LegacyTable {
+public:
+  void addColumn(const std::string &key, const std::string &title,
+                 int priority = 1, int minWidth = 3, bool leftAlign = true) {
+    columns_.push_back({key, title, priority, std::max(1, minWidth),
+                        leftAlign});
+  }
+
+  void addRow(const std::vector<std::string> &cells) {
+    if (cells.size() == columns_.size())
+      rows_.push_back(cells);
+  }
+
+  void setSortColumn(int index) { sortColumn_ = index; }
+
+  std::string renderTable(int maxWidth = 80);
+
+private:
+  struct Column {
+    std::string key;
+    std::string title;
+    int priority;
+    int minWidth;
+    bool leftAlign;
+  };
+
+  static std::vector<std::string> splitLines(const std::string &s) {
+    std::vector<std::string> out;
+    std::string line;
+    std::istringstream iss(s);
+    while (std::getline(iss, line))
+      out.push_back(line);
+    if (out.empty())
+      out.push_back("");
+    return out;
+  }
+
+  std::vector<Column> columns_;
+  std::vector<std::vector<std::string>> rows_;
+  int sortColumn_ = 0;
+};
+
+inline std::string LegacyTable::renderTable(int maxWidth) {
+  if (columns_.empty())
+    return std::string();
+
+  const size_t ncol = columns_.size();
+
+  std::vector<int> widths(ncol, 0);
+  for (size_t i = 0; i < ncol; ++i)
+    widths[i] = strutil::visibleLength(columns_[i].title);
+
+  for (const auto &r : rows_) {
+    for (size_t i = 0; i < ncol; ++i) {
+      auto lines = splitLines(r[i]);
+      for (const auto &l : lines)
+        widths[i] = std::max(widths[i], strutil::visibleLength(l));
+    }
+  }
+
+  auto totalWidth = std::accumulate(widths.begin(), widths.end(), 0) +
+                    static_cast<int>(ncol - 1);
+
+  if (totalWidth > maxWidth) {
+    std::vector<size_t> idx(ncol);
+    std::iota(idx.begin(), idx.end(), size_t(0));
+    std::sort(idx.begin(), idx.end(), [&](size_t a, size_t b) {
+      if (columns_[a].priority != columns_[b].priority)
+        return columns_[a].priority < columns_[b].priority;
+      return a < b;
+    });
+
+    while (totalWidth > maxWidth) {
+      bool reduced = false;
+      for (size_t k = 0; k < idx.size() && totalWidth > maxWidth; ++k) {
+        size_t i = idx[k];
+        if (widths[i] > columns_[i].minWidth) {
+          widths[i] -= 1;
+          totalWidth -= 1;
+          reduced = true;
+        }
+      }
+      if (!reduced)
+        break;
+    }
+  }
+
+  std::ostringstream oss;
+
+  auto pad = [&](const std::string &s, int w, bool left) {
+    int vis = strutil::visibleLength(s);
+    if (vis >= w)
+      return strutil::truncateVisible(s, w);
+    int padlen = w - vis;
+    if (left) {
+      std::string out = s;
+      out.append(padlen, ' ');
+      return out;
+    }
+    std::string out(padlen, ' ');
+    out += s;
+    return out;
+  };
+
+  for (size_t i = 0; i < ncol; ++i) {
+    if (i)
+      oss << ' ';
+    oss << pad(columns_[i].title, widths[i], columns_[i].leftAlign);
+  }
+  oss << '\n';
+
+  for (size_t i = 0; i < ncol; ++i) {
+    if (i)
+      oss << ' ';
+    oss << std::string(widths[i], '-');
+  }
+  oss << '\n';
+
+  std::vector<std::vector<std::string>> sorted_rows = rows_;
+  int sc = sortColumn_;
+  if (sc < 0 || sc >= static_cast<int>(ncol))
+    sc = 0;
+
+  if (columns_[sc].key == "Index") {
+    auto parseInt = [](const std::string &s, long long &out) -> bool {
+      if (s.empty() || s == "-")
+        return false;
+      std::string clean = strutil::stripAnsi(s);
+      if (clean.empty() || clean == "-")
+        return false;
+      try {
+        size_t pos = 0;
+        out = std::stoll(clean, &pos);
+        return pos == clean.size();
+      } catch (...) {
+        return false;
+      }
+    };
+    std::stable_sort(sorted_rows.begin(), sorted_rows.end(),
+                     [&](const std::vector<std::string> &a,
+                         const std::vector<std::string> &b) {
+                       long long ia = 0, ib = 0;
+                       bool ha = parseInt(a[sc], ia);
+                       bool hb = parseInt(b[sc], ib);
+                       if (ha && hb)
+                         return ia < ib;
+                       if (ha != hb)
+                         return ha;
+                       return a[sc] < b[sc];
+                     });
+  } else {
+    std::stable_sort(sorted_rows.begin(), sorted_rows.end(),
+                     [&](const std::vector<std::string> &a,
+                         const std::vector<std::string> &b) {
+                       return a[sc] < b[sc];
+                     });
+  }
+
+  for (const auto &r : sorted_rows) {
+    std::vector<std::vector<std::string>> cellLines(ncol);
+    size_t maxLines = 1;
+    for (size_t i = 0; i < ncol; ++i) {
+      cellLines[i] = splitLines(r[i]);
+      maxLines = std::max(maxLines, cellLines[i].size());
+    }
+
+    for (size_t ln = 0; ln < maxLines; ++ln) {
+      for (size_t i = 0; i < ncol; ++i) {
+        if (i)
+          oss << ' ';
+        std::string cell = (ln < cellLines[i].size()) ? cellLines[i][ln] : "";
+        oss << pad(cell, widths[i], columns_[i].leftAlign);
+      }
+      oss << '\n';
+    }
+  }
+
+  return oss.str();
+}
+
+class ArenaTable : public TableFormatter<int> {
+public:
+  using TableFormatter<int>::addColumn;
+  using TableFormatter<int>::addRow;
+  using TableFormatter<int>::setSortColumn;
+  using TableFormatter<int>::renderTable;
+
+  std::string format(const std::vector<int> &) override { return {}; }
+};
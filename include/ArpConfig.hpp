@@ -33,12 +33,13 @@
 #pragma once
 
 #include "ConfigData.hpp"
+#include "IPPrefix.hpp"
 #include <optional>
 #include <string>
 
 class ArpConfig : public ConfigData {
 public:
-  std::string ip;                   // IP address
+  IPPrefix ip;                      // IP address (host prefix)
   std::string mac;                  // MAC address
   std::optional<std::string> iface; // Interface name
   std::optional<int> expire;        // Expiration time
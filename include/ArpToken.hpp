@@ -48,10 +48,13 @@ public:
   static std::string toString(ArpConfig *cfg);
 
   std::vector<std::string> autoComplete(std::string_view) const override;
+
+  TokenKind kind() const override { return TokenKind::Arp; }
+
   std::unique_ptr<Token> clone() const override;
 
   static std::shared_ptr<ArpToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
   const std::string &ip() const { return ip_; }
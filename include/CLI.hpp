@@ -32,11 +32,15 @@
 
 #pragma once
 
+#include "CommandDispatcher.hpp"
+#include "CompletionCache.hpp"
 #include "ConfigurationManager.hpp"
+#include "HistoryLog.hpp"
 #include "Parser.hpp"
 #include <histedit.h>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -67,18 +71,24 @@ public:
 
 private:
   std::unique_ptr<ConfigurationManager> mgr_;
+  std::unique_ptr<CompletionCache> completions_; ///< interactive mode only
   netcli::Parser parser_;
+  netcli::CommandDispatcher dispatcher_;
+  std::string scratch_; ///< unescaped-token buffer reused across lines
   std::string historyFile_;
+  std::unique_ptr<HistoryLog> history_; ///< interactive mode only
   EditLine *el_;
   History *hist_;
   HistEvent ev_;
   int preview_len_ = 0;
 
+  /// Entries handed to libedit for up/down recall.
+  static constexpr size_t kEditHistorySize = 1000;
+
   // Reverse-i-search state
   bool in_search_ = false;
-  std::string search_query_;
-  std::vector<std::string> search_matches_;
-  int search_index_ = -1;
+  std::unique_ptr<HistoryLog::Search> search_;
+  int search_index_ = -1; ///< 0 is the most recent match
 
   void loadHistory();
   void saveHistory(const std::string &line);
@@ -89,7 +99,7 @@ private:
 
   /// Get completions for a partial word given preceding tokens.
   std::vector<std::string>
-  getCompletions(const std::vector<std::string> &tokens,
+  getCompletions(const std::vector<std::string_view> &tokens,
                  const std::string &partial) const;
 
   /// Remove any inline preview text from the edit buffer.
@@ -101,9 +111,6 @@ private:
   /// Clear the entire edit-line buffer (used by Ctrl-C, search cancel, etc.).
   void clearLineBuffer();
 
-  /// Load all history lines into a vector (most-recent last).
-  std::vector<std::string> loadHistoryLines() const;
-
   // ── Reverse-i-search ────────────────────────────────────────────────
 
   /// Enter interactive reverse-i-search mode.  Returns when the user
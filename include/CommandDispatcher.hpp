@@ -27,54 +27,41 @@
 
 /**
  * @file CommandDispatcher.hpp
- * @brief Type-safe command dispatch replacing dynamic_cast cascades
+ * @brief Table-driven command dispatch
  *
- * The CommandDispatcher maintains a registry of handlers keyed by
- * (Verb, token type_index). When dispatch() is called, it identifies the
- * verb token, extracts the target token, and looks up the matching handler.
+ * Handlers live in a constant table indexed by (object TokenKind, verb).
+ * dispatch() reads the kind of the head and target tokens and calls the
+ * handler in that slot. No registration happens at runtime, so a
+ * dispatcher costs nothing to construct, and it can be kept for the life
+ * of a session.
  */
 
 #pragma once
 
 #include "ConfigurationManager.hpp"
 #include "Token.hpp"
-#include <functional>
-#include <iostream>
-#include <map>
 #include <memory>
-#include <typeindex>
 
 namespace netcli {
 
   /// Verb categories parsed from the command head token.
   enum class Verb { Show, Set, Delete };
 
-  /// A handler receives the raw target Token* and the ConfigurationManager.
-  /// Implementations static_cast to the concrete token type (safe because
-  /// dispatch guarantees the type matches what was registered).
-  using Handler = std::function<void(const Token &, ConfigurationManager *)>;
+  /// A handler receives the target token and the ConfigurationManager.
+  /// Table entries static_cast to the concrete token type, which is safe
+  /// because the slot is chosen by the token's own kind().
+  using Handler = void (*)(const Token &, ConfigurationManager *);
 
   class CommandDispatcher {
   public:
-    CommandDispatcher();
-
-    /// Register a handler for a specific verb + target token type.
-    template <typename TokenT>
-    void registerHandler(Verb verb, Handler handler) {
-      handlers_[{verb, std::type_index(typeid(TokenT))}] = std::move(handler);
-    }
+    /// Handler for `verb` applied to an object of kind `object`, or
+    /// nullptr when the combination is not supported.
+    static Handler handler(Verb verb, TokenKind object);
 
     /// Dispatch a parsed command chain. The head token must be a verb token
     /// (ShowToken, SetToken, DeleteToken) whose next() is the target token.
     void dispatch(const std::shared_ptr<Token> &head,
                   ConfigurationManager *mgr) const;
-
-  private:
-    /// Register all built-in handlers.
-    void registerDefaults();
-
-    using Key = std::pair<Verb, std::type_index>;
-    std::map<Key, Handler> handlers_;
   };
 
 } // namespace netcli
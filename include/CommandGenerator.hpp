@@ -47,22 +47,21 @@ namespace netcli {
     ~CommandGenerator() override = default;
 
   protected:
-    void generateVRFs(ConfigurationManager &mgr) override;
-    void generateLoopbacks(ConfigurationManager &mgr,
-                           std::set<std::string> &processedInterfaces) override;
-    void generateEpairs(ConfigurationManager &mgr,
-                        std::set<std::string> &processedInterfaces) override;
-    void generateBasicInterfaces(
-        ConfigurationManager &mgr,
-        std::set<std::string> &processedInterfaces) override;
-    void generateBridges(ConfigurationManager &mgr,
-                         std::set<std::string> &processedInterfaces) override;
-    void generateLaggs(ConfigurationManager &mgr,
-                       std::set<std::string> &processedInterfaces) override;
-    void generateVLANs(ConfigurationManager &mgr,
-                       std::set<std::string> &processedInterfaces) override;
+    void generateVRFs(ConfigurationManager &mgr, std::ostream &out) override;
+    InterfaceSection generateLoopbacks(ConfigurationManager &mgr,
+                                       const Bases &bases) override;
+    InterfaceSection generateEpairs(ConfigurationManager &mgr,
+                                    const Bases &bases) override;
+    InterfaceSection generateBasicInterfaces(ConfigurationManager &mgr,
+                                             const Bases &bases) override;
+    InterfaceSection generateBridges(ConfigurationManager &mgr,
+                                     const Bases &bases) override;
+    InterfaceSection generateLaggs(ConfigurationManager &mgr,
+                                   const Bases &bases) override;
+    InterfaceSection generateVLANs(ConfigurationManager &mgr,
+                                   const Bases &bases) override;
     // Tunnels are generated by the base ConfigurationGenerator now.
-    void generateRoutes(ConfigurationManager &mgr) override;
+    void generateRoutes(ConfigurationManager &mgr, std::ostream &out) override;
   };
 
 } // namespace netcli
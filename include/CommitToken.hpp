@@ -21,9 +21,12 @@ public:
   std::vector<std::string>
   autoComplete(const std::vector<std::string> &tokens [[maybe_unused]],
                std::string_view partial [[maybe_unused]],
-               ConfigurationManager *mgr [[maybe_unused]]) const override {
+               const CompletionCache *cache [[maybe_unused]]) const override {
     return {};
   }
+
+  TokenKind kind() const override { return TokenKind::Commit; }
+
   std::unique_ptr<Token> clone() const override {
     return std::make_unique<CommitToken>(*this);
   }
@@ -31,6 +34,6 @@ public:
   void executeSet(ConfigurationManager *mgr) const;
 
   static std::shared_ptr<CommitToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 };
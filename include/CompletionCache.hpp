@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file CompletionCache.hpp
+ * @brief Background-refreshed data for interactive tab completion
+ *
+ * The shell previews a completion on every keystroke. Asking the
+ * ConfigurationManager for interfaces at that point enumerates and probes
+ * every interface, which is too slow on boxes with thousands of them.
+ *
+ * CompletionCache keeps the names completion needs (interfaces, groups,
+ * VRFs, ACL ids, route prefixes) in an immutable snapshot of
+ * CompletionIndex sets. A worker thread rebuilds it on a timer and
+ * whenever invalidate() is called, for example after a command has
+ * changed the configuration. Readers take the current snapshot under a
+ * short lock and never wait for a refresh. Until the first refresh
+ * finishes, the snapshot is empty.
+ *
+ * The worker calls the manager's getters concurrently with the foreground
+ * thread, as the generator's thread pool already does.
+ */
+
+#pragma once
+
+#include "CompletionIndex.hpp"
+#include "ConfigurationManager.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class CompletionCache {
+public:
+  /// Completion data at one point in time.
+  struct Snapshot {
+    CompletionIndex interfaces;
+    CompletionIndex groups;
+    CompletionIndex vrfs;     ///< routing table ids
+    CompletionIndex vrfNames;
+    CompletionIndex acls;     ///< access-list ids
+    CompletionIndex prefixes; ///< main table destinations
+  };
+
+  explicit CompletionCache(
+      ConfigurationManager &mgr,
+      std::chrono::seconds interval = std::chrono::seconds(10));
+  ~CompletionCache();
+
+  CompletionCache(const CompletionCache &) = delete;
+  CompletionCache &operator=(const CompletionCache &) = delete;
+
+  /// The latest snapshot. Never blocks on a refresh in progress.
+  std::shared_ptr<const Snapshot> snapshot() const;
+
+  /// Ask the worker to refresh now instead of at the next interval.
+  void invalidate();
+
+private:
+  void run();
+  std::shared_ptr<const Snapshot> build() const;
+
+  ConfigurationManager &mgr_;
+  std::chrono::seconds interval_;
+
+  mutable std::mutex snapshotMutex_;
+  std::shared_ptr<const Snapshot> snapshot_;
+
+  std::mutex wakeMutex_;
+  std::condition_variable wake_;
+  bool dirty_ = true;
+  bool stop_ = false;
+  std::thread worker_;
+};
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file CompletionIndex.hpp
+ * @brief Prefix-searchable set of completion candidates
+ *
+ * Holds one set of names (interfaces, groups, VRFs, ACL ids, prefixes)
+ * for tab completion. Names are kept in natural order, where digit runs
+ * compare by value, so "vlan2" sorts before "vlan10". A second array holds
+ * the same names in plain byte order, which keeps every prefix a
+ * contiguous range. Finding the names that start with a prefix is a
+ * binary search for that range, plus a sort of the matched positions back
+ * into natural order.
+ *
+ * When nothing starts with the typed text, complete() falls back to
+ * subsequence matching ("e0.1" finds "em0.100"), ranked by score.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CompletionIndex {
+public:
+  CompletionIndex() = default;
+  /// Build from any list of names. Duplicates are dropped.
+  explicit CompletionIndex(std::vector<std::string> names);
+
+  size_t size() const { return names_.size(); }
+  bool empty() const { return names_.empty(); }
+
+  /// Names starting with `prefix`, in natural order.
+  std::vector<std::string> prefixed(std::string_view prefix) const;
+
+  /// Names containing `pattern` as a subsequence, best match first, at
+  /// most `limit` of them. Consecutive matches and matches at the start
+  /// of a name or of a segment ("." "-" "_" "/" ":", or a letter/digit
+  /// boundary) score higher. Ties keep natural order.
+  std::vector<std::string> fuzzy(std::string_view pattern,
+                                 size_t limit = 20) const;
+
+  /// prefixed(), or fuzzy() when no name has the prefix.
+  std::vector<std::string> complete(std::string_view partial) const;
+
+  /// Natural (numeric-aware) ordering: "eth2" < "eth10".
+  static bool naturalLess(std::string_view a, std::string_view b);
+
+private:
+  std::vector<std::string> names_; ///< natural order
+  std::vector<uint32_t> bytewise_; ///< indexes into names_, byte order
+};
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file ConfigurationApply.hpp
+ * @brief `net apply FILE`: apply a configuration file to the system
+ *
+ * Syntax: net apply [--routes-only] [-n|--dry-run] FILE|-
+ *
+ * The file's `set` commands are parsed up front into the desired VRFs,
+ * interfaces, routes and nexthop groups, ARP/NDP entries and policies.
+ * The live system is read once and each object type is diffed against it;
+ * only the differences are printed and executed, creations in dependency
+ * order (VRFs, interfaces, routes, neighbours, policies) and deletions in
+ * reverse. Routes use RouteDiff. Objects the file omits are deleted for
+ * routes, permanent neighbour entries and policies only; VRFs and
+ * interfaces are never removed. --dry-run prints the plan without applying
+ * it, --routes-only restricts everything to routes and nexthop groups.
+ */
+
+#pragma once
+
+#include "ConfigurationManager.hpp"
+#include <string>
+
+namespace netcli {
+
+  struct ApplyOptions {
+    std::string file;        ///< Configuration file, "-" for stdin
+    bool routesOnly = false; ///< Ignore everything but routes/groups
+    bool dryRun = false;     ///< Print the changes, do not apply them
+  };
+
+  /// Parse the arguments of `apply` (argv[0] is "apply"). Prints usage and
+  /// returns false on error.
+  bool parseApplyOptions(int argc, char *argv[], ApplyOptions &opts);
+
+  /// Run `apply`; returns a process exit status (0 when every change
+  /// succeeded).
+  int executeApply(const ApplyOptions &opts, ConfigurationManager &mgr);
+
+} // namespace netcli
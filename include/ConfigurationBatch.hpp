@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ConfigurationBatch.hpp
+ * @brief `net --batch FILE`: run a command script as one transaction
+ *
+ * Piped stdin runs each line as soon as it is read, so an error halfway
+ * leaves the system half-configured. A batch runs in four phases, each
+ * one timed:
+ *
+ *   parse     Every line is parsed and validated before anything is
+ *             touched. Only `set` and `delete` are accepted. Every bad
+ *             line is reported with its number and nothing is applied.
+ *   snapshot  The live state of each object type the script touches is
+ *             read once.
+ *   apply     Commands run in file order. Runs of consecutive `set route`
+ *             lines go to the backend as one AddRoutes call. Before a
+ *             command first touches an object (interface, route prefix,
+ *             nexthop group, VRF, neighbour entry, access list), that
+ *             object's prior state is pushed onto an undo log.
+ *   rollback  On the first failure, the undo log is replayed newest
+ *             first. Each object returns to its state from before the
+ *             batch.
+ *
+ * Interfaces created by the batch are destroyed on rollback. Existing
+ * interfaces lose any addresses and groups the batch added, and their
+ * base settings are saved again. Type-specific settings such as lagg
+ * members or a vlan tag are not restored. Interface commands run through
+ * their executor, which reports some errors without failing the batch.
+ */
+
+#pragma once
+
+#include "ConfigurationManager.hpp"
+#include <string>
+
+namespace netcli {
+
+  /// Run the script in @p file ("-" for stdin) as one transaction;
+  /// returns a process exit status (0 when every command was applied, 1
+  /// when the script was rejected or rolled back).
+  int executeBatch(const std::string &file, ConfigurationManager &mgr);
+
+} // namespace netcli
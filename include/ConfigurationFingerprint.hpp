@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file ConfigurationFingerprint.hpp
+ * @brief Merkle-style hash tree over the generated configuration
+ *
+ * The tree is built from the canonical `set` lines ConfigurationGenerator
+ * emits. Every line belongs to one object:
+ *
+ *   set vrf ...                  vrf/fibs
+ *   set interface name NAME ...  interface/NAME
+ *   set route ... [vrf N]        route/N (one object per table, 0 = main)
+ *   set nexthop-group NAME ...   nexthop-group/NAME
+ *   set arp ... / set ndp ...    arp/static, ndp/static
+ *   set policy access-list N ... policy/N
+ *
+ * An object's hash covers its lines in generated order, a section's hash
+ * covers its (name, object hash) pairs in name order, and the root covers
+ * the (section, hash) pairs. Equal roots mean the two systems generate the
+ * same configuration; otherwise comparing sections, then objects, narrows
+ * the difference down without exchanging the configuration itself.
+ *
+ * Text form (`net -g --fingerprint`, read by `net verify FILE`):
+ *
+ *   fingerprint 1 ROOT
+ *   section NAME HASH OBJECTS
+ *   object SECTION NAME HASH
+ *
+ * The object lines are optional; without them verify reports differences
+ * per section only. A line whose object has no name (e.g. `set interface`
+ * without `name`) is filed under the name `-`.
+ */
+
+#pragma once
+
+#include "ConfigurationManager.hpp"
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+
+namespace netcli {
+
+  class ConfigurationFingerprint {
+  public:
+    using Hash = uint64_t;
+
+    struct Section {
+      Hash hash = 0;
+      size_t count = 0;                     ///< number of objects
+      std::map<std::string, Hash> objects; ///< empty when not transferred
+    };
+
+    /// Build the tree from generator output (one command per line).
+    static ConfigurationFingerprint fromCommands(std::istream &in);
+
+    /// Generate the running configuration and build its tree.
+    static ConfigurationFingerprint fromSystem(ConfigurationManager &mgr);
+
+    /// Parse the text form; throws std::runtime_error on malformed input.
+    static ConfigurationFingerprint read(std::istream &in);
+
+    /// Write the text form, with or without the object lines.
+    void write(std::ostream &out, bool objects = true) const;
+
+    Hash root() const { return root_; }
+    const std::map<std::string, Section> &sections() const {
+      return sections_;
+    }
+
+    /**
+     * @brief Compare this (live) tree with an expected one
+     *
+     * Prints one line per differing section or object: `~` differs, `+`
+     * only present here, `-` only in @p expected.
+     * @return true when the roots match
+     */
+    bool verify(const ConfigurationFingerprint &expected,
+                std::ostream &out) const;
+
+  private:
+    void seal();
+
+    Hash root_ = 0;
+    std::map<std::string, Section> sections_;
+  };
+
+} // namespace netcli
@@ -33,13 +33,40 @@
 #pragma once
 
 #include "ConfigurationManager.hpp"
-#include <set>
+#include "InterfaceConfig.hpp"
+#include <iostream>
 #include <string>
+#include <vector>
 
 namespace netcli {
 
+  /// Commands rendered for one interface: its main `set` line followed by
+  /// one line per alias address.
+  struct GeneratedInterface {
+    std::string name;
+    std::string commands;
+  };
+
+  /// The interfaces one generator stage emits, in emission order.
+  using InterfaceSection = std::vector<GeneratedInterface>;
+
+  /**
+   * @brief Render an interface and its aliases
+   * @param ifc The interface (its aliases become extra lines)
+   * @param command The main command without the leading "set "
+   */
+  GeneratedInterface renderInterface(const InterfaceConfig &ifc,
+                                     const std::string &command);
+
   /**
    * @brief Abstract base class for configuration generation
+   *
+   * The interface list is read once and handed to every stage. Stages only
+   * fetch their type-specific details and render into their own section;
+   * when the backend allows it the stages run concurrently. Sections are
+   * then written out in a fixed order, and an interface claimed by an
+   * earlier stage is skipped by later ones, so the output does not depend
+   * on scheduling.
    */
   class ConfigurationGenerator {
   public:
@@ -48,28 +75,45 @@ namespace netcli {
     /**
      * @brief Generate complete configuration output
      * @param mgr The configuration manager to query
+     * @param out Where to write the commands
      */
-    void generateConfiguration(ConfigurationManager &mgr);
+    void generateConfiguration(ConfigurationManager &mgr,
+                               std::ostream &out = std::cout);
+
+    /**
+     * @brief Generate only the interface commands, every type in the same
+     * order generateConfiguration() emits them
+     * @param mgr The configuration manager to query
+     * @param out Where to write the commands
+     */
+    void generateInterfaces(ConfigurationManager &mgr,
+                            std::ostream &out = std::cout);
 
   protected:
-    virtual void generateVRFs(ConfigurationManager &mgr) = 0;
-    virtual void
-    generateLoopbacks(ConfigurationManager &mgr,
-                      std::set<std::string> &processedInterfaces) = 0;
-    virtual void generateEpairs(ConfigurationManager &mgr,
-                                std::set<std::string> &processedInterfaces) = 0;
-    virtual void
+    using Bases = std::vector<InterfaceConfig>;
+
+    virtual void generateVRFs(ConfigurationManager &mgr,
+                              std::ostream &out) = 0;
+    virtual InterfaceSection generateLoopbacks(ConfigurationManager &mgr,
+                                               const Bases &bases) = 0;
+    virtual InterfaceSection generateEpairs(ConfigurationManager &mgr,
+                                            const Bases &bases) = 0;
+    virtual InterfaceSection
     generateBasicInterfaces(ConfigurationManager &mgr,
-                            std::set<std::string> &processedInterfaces) = 0;
-    virtual void
-    generateBridges(ConfigurationManager &mgr,
-                    std::set<std::string> &processedInterfaces) = 0;
-    virtual void generateLaggs(ConfigurationManager &mgr,
-                               std::set<std::string> &processedInterfaces) = 0;
-    virtual void generateVLANs(ConfigurationManager &mgr,
-                               std::set<std::string> &processedInterfaces) = 0;
+                            const Bases &bases) = 0;
+    virtual InterfaceSection generateBridges(ConfigurationManager &mgr,
+                                             const Bases &bases) = 0;
+    virtual InterfaceSection generateLaggs(ConfigurationManager &mgr,
+                                           const Bases &bases) = 0;
+    virtual InterfaceSection generateVLANs(ConfigurationManager &mgr,
+                                           const Bases &bases) = 0;
     // Tunnel generation is handled centrally by ConfigurationGenerator
-    virtual void generateRoutes(ConfigurationManager &mgr) = 0;
+    virtual void generateRoutes(ConfigurationManager &mgr,
+                                std::ostream &out) = 0;
+
+  private:
+    void generate(ConfigurationManager &mgr, std::ostream &out,
+                  bool interfacesOnly);
   };
 
 } // namespace netcli
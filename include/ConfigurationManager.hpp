@@ -47,8 +47,10 @@ class GreInterfaceConfig;
 class InterfaceConfig;
 class LaggInterfaceConfig;
 class NdpConfig;
+class NexthopGroupConfig;
 class PolicyConfig;
 class RouteConfig;
+class RouteTable;
 class TunInterfaceConfig;
 class GifInterfaceConfig;
 class OvpnInterfaceConfig;
@@ -75,6 +77,11 @@ class ConfigurationManager {
 public:
   virtual ~ConfigurationManager() = default;
 
+  /// True when the query methods below may be called from several threads
+  /// at once (each call opens its own sockets). Backends sharing a session
+  /// leave this false and are queried sequentially.
+  virtual bool SupportsConcurrentQueries() const { return false; }
+
   // ── Enumeration / query API ──────────────────────────────────────────
 
   virtual std::vector<InterfaceConfig>
@@ -91,6 +98,8 @@ public:
 
   virtual std::vector<TunInterfaceConfig>
   GetTunInterfaces(const std::vector<InterfaceConfig> &bases) const = 0;
+  virtual std::vector<TapInterfaceConfig>
+  GetTapInterfaces(const std::vector<InterfaceConfig> &bases) const = 0;
   virtual std::vector<GifInterfaceConfig>
   GetGifInterfaces(const std::vector<InterfaceConfig> &bases) const = 0;
   virtual std::vector<OvpnInterfaceConfig>
@@ -120,6 +129,10 @@ public:
   GetStaticRoutes(const std::optional<VRFConfig> &vrf = std::nullopt) const = 0;
   virtual std::vector<RouteConfig>
   GetRoutes(const std::optional<VRFConfig> &vrf = std::nullopt) const = 0;
+  /// The same routes in columnar form, for large dumps. The default
+  /// converts GetRoutes(); backends may fill the table directly.
+  virtual RouteTable
+  GetRouteTable(const std::optional<VRFConfig> &vrf = std::nullopt) const;
   virtual std::vector<VRFConfig> GetVrfs() const = 0;
 
   // ARP/NDP neighbor cache management
@@ -221,6 +234,19 @@ public:
   // Route operations
   virtual void AddRoute(const RouteConfig &route) const = 0;
   virtual void DeleteRoute(const RouteConfig &route) const = 0;
+  /// Add many routes at once. The default calls AddRoute() per route;
+  /// backends override it to reuse one socket for the whole batch.
+  virtual void AddRoutes(const std::vector<RouteConfig> &routes) const;
+  /// Re-point a route at a new nexthop; `was` and `want` share table and
+  /// prefix. The default deletes `was` and adds `want`, putting `was`
+  /// back if the add fails; backends override it to swap in one step.
+  virtual void ReplaceRoute(const RouteConfig &was,
+                            const RouteConfig &want) const;
+
+  // Nexthop group operations (shared gateways referenced by routes)
+  virtual std::vector<NexthopGroupConfig> GetNexthopGroups() const = 0;
+  virtual void SetNexthopGroup(const NexthopGroupConfig &group) const = 0;
+  virtual void DeleteNexthopGroup(const NexthopGroupConfig &group) const = 0;
 
   // Policy operations (access-lists, prefix-lists, route-maps)
   virtual std::vector<PolicyConfig> GetPolicies(
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file ConfigurationSnapshot.hpp
+ * @brief `net snapshot save|restore FILE`: binary configuration snapshots
+ *
+ * A snapshot holds the same state `net -g` prints, laid out so that
+ * restore can mmap the file and walk it without parsing the bulk of it:
+ *
+ *   Header            magic, version, byte order, section count, file size
+ *   SectionEntry[n]   kind, record count, offset and size of each section
+ *   Strings           NUL-terminated strings, referenced by byte offset
+ *   Commands          string offsets of `set` lines (VRFs, interfaces,
+ *                     nexthop groups, access lists) in generation order
+ *   RouteTables       one entry per VRF: first route and route count
+ *   Routes            fixed-size route records, grouped by table
+ *   Arp, Ndp          fixed-size neighbour records
+ *
+ * All integers are in host byte order and every section starts on an
+ * 8-byte boundary. Interfaces and policies have a shape per type and stay
+ * commands; they are few. Routes and neighbours, which make up nearly all
+ * of a large configuration, are applied straight from their records:
+ * routes in batches per table through ConfigurationManager::AddRoutes.
+ */
+
+#pragma once
+
+#include "ConfigurationManager.hpp"
+#include <cstdint>
+#include <string>
+
+namespace netcli {
+
+  namespace snapshot {
+
+    inline constexpr char kMagic[8] = {'S', 'T', 'L', 'S', 'N', 'A', 'P', 0};
+    inline constexpr uint32_t kVersion = 1;
+    inline constexpr uint32_t kByteOrder = 0x01020304;
+    inline constexpr uint32_t kNoString = UINT32_MAX;
+
+    enum class SectionKind : uint32_t {
+      Strings = 1,
+      Commands = 2,
+      RouteTables = 3,
+      Routes = 4,
+      Arp = 5,
+      Ndp = 6,
+    };
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t byteOrder; ///< kByteOrder as written by the producer
+      uint32_t sections;  ///< SectionEntry records following the header
+      uint32_t reserved;
+      uint64_t size; ///< total file size
+    };
+
+    struct SectionEntry {
+      uint32_t kind; ///< SectionKind
+      uint32_t count;
+      uint64_t offset;
+      uint64_t size;
+    };
+
+    struct RouteTable {
+      int32_t vrf; ///< -1 for the main table
+      uint32_t first;
+      uint32_t count;
+    };
+
+    struct Route {
+      enum Flags : uint8_t { Nexthop = 1, Blackhole = 2, Reject = 4 };
+      uint8_t family; ///< 4 or 6
+      uint8_t length; ///< prefix length
+      uint8_t flags;
+      uint8_t nexthopFamily;
+      uint32_t iface; ///< string offset or kNoString
+      uint32_t group; ///< nexthop group name or kNoString
+      uint8_t dest[16];
+      uint8_t nexthop[16];
+    };
+
+    struct Neighbour {
+      enum Flags : uint8_t { Published = 1 };
+      uint8_t family;
+      uint8_t flags;
+      uint16_t reserved;
+      uint32_t iface; ///< string offset or kNoString
+      uint32_t mac;   ///< string offset
+      uint8_t ip[16];
+    };
+
+    static_assert(sizeof(Header) == 32);
+    static_assert(sizeof(SectionEntry) == 24);
+    static_assert(sizeof(RouteTable) == 12);
+    static_assert(sizeof(Route) == 44);
+    static_assert(sizeof(Neighbour) == 28);
+
+  } // namespace snapshot
+
+  /// Write the running configuration to @p file; returns an exit status.
+  int saveSnapshot(const std::string &file, ConfigurationManager &mgr);
+
+  /// Apply the snapshot in @p file to the system; returns an exit status
+  /// (0 when every object was applied).
+  int restoreSnapshot(const std::string &file, ConfigurationManager &mgr);
+
+} // namespace netcli
@@ -6,7 +6,8 @@
 #pragma once
 
 #include "ConfigurationManager.hpp"
+#include <ostream>
 
 namespace netcli {
-  void generateArpCommands(ConfigurationManager &mgr);
+  void generateArpCommands(ConfigurationManager &mgr, std::ostream &out);
 } // namespace netcli
@@ -6,7 +6,8 @@
 #pragma once
 
 #include "ConfigurationManager.hpp"
+#include <ostream>
 
 namespace netcli {
-  void generateNdpCommands(ConfigurationManager &mgr);
+  void generateNdpCommands(ConfigurationManager &mgr, std::ostream &out);
 } // namespace netcli
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "ConfigurationGenerator.hpp"
 #include "ConfigurationManager.hpp"
-#include <set>
 
 namespace netcli {
-  void generateOvpnCommands(ConfigurationManager &mgr,
-                            std::set<std::string> &processedInterfaces);
-}
+  InterfaceSection
+  generateOvpnCommands(ConfigurationManager &mgr,
+                       const std::vector<InterfaceConfig> &bases);
+} // namespace netcli
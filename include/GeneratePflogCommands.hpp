@@ -5,11 +5,11 @@
 
 #pragma once
 
+#include "ConfigurationGenerator.hpp"
 #include "ConfigurationManager.hpp"
-#include <set>
-#include <string>
 
 namespace netcli {
-  void generatePflogCommands(ConfigurationManager &mgr,
-                             std::set<std::string> &processedInterfaces);
+  InterfaceSection
+  generatePflogCommands(ConfigurationManager &mgr,
+                        const std::vector<InterfaceConfig> &bases);
 } // namespace netcli
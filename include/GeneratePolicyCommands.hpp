@@ -0,0 +1,13 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ */
+
+#pragma once
+
+#include "ConfigurationManager.hpp"
+#include <ostream>
+
+namespace netcli {
+  void generatePolicyCommands(ConfigurationManager &mgr, std::ostream &out);
+} // namespace netcli
@@ -5,11 +5,11 @@
 
 #pragma once
 
+#include "ConfigurationGenerator.hpp"
 #include "ConfigurationManager.hpp"
-#include <set>
-#include <string>
 
 namespace netcli {
-  void generateSixToFourCommands(ConfigurationManager &mgr,
-                                 std::set<std::string> &processedInterfaces);
+  InterfaceSection
+  generateSixToFourCommands(ConfigurationManager &mgr,
+                            const std::vector<InterfaceConfig> &bases);
 } // namespace netcli
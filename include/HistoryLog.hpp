@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file HistoryLog.hpp
+ * @brief In-memory command history with an append-only log file
+ *
+ * The shell keeps every history line in memory and appends each new
+ * command to the history file with a single write(). fsync() runs at most
+ * once per batch of appends and when the log is closed, not per command.
+ * The file is rewritten only when it is opened: to drop entries past the
+ * size limit, or to convert a file that libedit's H_SAVE wrote.
+ *
+ * Reverse search (Ctrl-R) uses a trigram index. Each three-byte sequence
+ * maps to the ids of the entries that contain it. A Search narrows its
+ * matches one keystroke at a time. It filters the previous keystroke's
+ * matches, or the posting list of the newest trigram if that is smaller.
+ * Backspace pops back to the saved matches, so no keystroke touches the
+ * disk.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class HistoryLog {
+public:
+  /// Load `path` (if it exists) and open it for appending. An empty path
+  /// keeps history in memory only.
+  explicit HistoryLog(std::string path, size_t maxEntries = 100000);
+  ~HistoryLog();
+
+  HistoryLog(const HistoryLog &) = delete;
+  HistoryLog &operator=(const HistoryLog &) = delete;
+
+  /// Record a command in memory and append it to the log.
+  void append(std::string_view line);
+
+  /// fsync() any appends not yet synced.
+  void flush();
+
+  size_t size() const { return entries_.size(); }
+  const std::string &operator[](size_t id) const { return entries_[id]; }
+
+  /// Incremental substring search over the log, for one Ctrl-R session.
+  /// The log must not be appended to while a Search is alive.
+  class Search {
+  public:
+    explicit Search(const HistoryLog &log) : log_(log) {}
+
+    /// Extend the query by one character.
+    void push(char c);
+    /// Drop the last character of the query.
+    void pop();
+
+    const std::string &query() const { return query_; }
+    /// Ids of the entries containing query(), oldest first.
+    const std::vector<uint32_t> &matches() const;
+
+  private:
+    const HistoryLog &log_;
+    std::string query_;
+    /// levels_[k] holds the matches for the first k + 1 query characters.
+    std::vector<std::vector<uint32_t>> levels_;
+  };
+
+private:
+  void load();
+  void rewrite();
+  void index(uint32_t id);
+  const std::vector<uint32_t> *postings(std::string_view gram) const;
+
+  std::string path_;
+  size_t maxEntries_;
+  int fd_ = -1;
+  std::vector<std::string> entries_;
+  std::unordered_map<uint32_t, std::vector<uint32_t>> trigrams_;
+
+  static constexpr unsigned kSyncEvery = 16;
+  static constexpr std::chrono::seconds kSyncInterval{2};
+  unsigned unsynced_ = 0;
+  std::chrono::steady_clock::time_point lastSync_;
+};
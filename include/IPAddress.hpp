@@ -33,12 +33,14 @@
 #pragma once
 
 #include "AddressFamily.hpp"
+#include "IPChars.hpp"
 #include <arpa/inet.h>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <netinet/in.h>
 #include <string>
+#include <string_view>
 #include <sys/socket.h>
 
 // Polymorphic IP address base type
@@ -50,7 +52,7 @@ public:
   virtual std::unique_ptr<IPAddress> clone() const = 0;
 
   // Parse textual address (IPv4 or IPv6)
-  static std::unique_ptr<IPAddress> fromString(const std::string &s);
+  static std::unique_ptr<IPAddress> fromString(std::string_view s);
 
   // Create a subnet mask IPAddress from a CIDR prefix length for the
   // specified address family (IPv4 or IPv6). Returns nullptr on invalid
@@ -66,25 +68,18 @@ class IPv4Address : public IPAddress {
 public:
   IPv4Address() = default;
   explicit IPv4Address(uint32_t v) : v_(v) {}
-  explicit IPv4Address(const std::string &s) {
-    struct in_addr a4;
-    if (inet_pton(AF_INET, s.c_str(), &a4) == 1) {
-      v_ = ntohl(a4.s_addr);
-    } else {
+  explicit IPv4Address(std::string_view s) {
+    auto r = ipchars::parseV4(s.data(), s.data() + s.size(), v_);
+    if (r.ec != std::errc() || r.ptr != s.data() + s.size())
       v_ = 0;
-    }
   }
 
   AddressFamily family() const override { return AddressFamily::IPv4; }
   uint32_t value() const { return v_; }
 
   std::string toString() const override {
-    struct in_addr a4;
-    a4.s_addr = htonl(v_);
-    char buf[INET_ADDRSTRLEN] = {0};
-    if (inet_ntop(AF_INET, &a4, buf, sizeof(buf)) == nullptr)
-      return std::string();
-    return std::string(buf);
+    char buf[ipchars::kMaxV4Chars];
+    return std::string(buf, ipchars::formatV4(buf, buf + sizeof(buf), v_).ptr);
   }
 
   std::unique_ptr<IPAddress> clone() const override {
@@ -99,34 +94,27 @@ class IPv6Address : public IPAddress {
 public:
   IPv6Address() = default;
   explicit IPv6Address(unsigned __int128 v) : v_(v) {}
-  explicit IPv6Address(const std::string &s) {
-    struct in6_addr a6;
-    if (inet_pton(AF_INET6, s.c_str(), &a6) == 1) {
-      unsigned __int128 v = 0;
-      for (int i = 0; i < 16; ++i) {
-        v <<= 8;
-        v |= static_cast<unsigned char>(a6.s6_addr[i]);
-      }
-      v_ = v;
-    } else {
-      v_ = 0;
-    }
+  explicit IPv6Address(std::string_view s) {
+    uint8_t b[16];
+    auto r = ipchars::parseV6(s.data(), s.data() + s.size(), b);
+    if (r.ec != std::errc() || r.ptr != s.data() + s.size())
+      return;
+    for (int i = 0; i < 16; ++i)
+      v_ = v_ << 8 | b[i];
   }
 
   AddressFamily family() const override { return AddressFamily::IPv6; }
   unsigned __int128 value() const { return v_; }
 
   std::string toString() const override {
-    struct in6_addr a6;
+    uint8_t b[16];
     unsigned __int128 v = v_;
     for (int i = 15; i >= 0; --i) {
-      a6.s6_addr[i] = static_cast<uint8_t>(v & 0xFF);
+      b[i] = static_cast<uint8_t>(v & 0xFF);
       v >>= 8;
     }
-    char buf[INET6_ADDRSTRLEN] = {0};
-    if (inet_ntop(AF_INET6, &a6, buf, sizeof(buf)) == nullptr)
-      return std::string();
-    return std::string(buf);
+    char buf[ipchars::kMaxV6Chars];
+    return std::string(buf, ipchars::formatV6(buf, buf + sizeof(buf), b).ptr);
   }
 
   std::unique_ptr<IPAddress> clone() const override {
@@ -135,21 +123,18 @@ public:
 };
 
 // Factory: parse an address string (IPv4 or IPv6)
-inline std::unique_ptr<IPAddress> IPAddress::fromString(const std::string &s) {
-  // Try IPv4
-  struct in_addr a4;
-  if (inet_pton(AF_INET, s.c_str(), &a4) == 1) {
-    uint32_t v = ntohl(a4.s_addr);
-    return std::make_unique<IPv4Address>(v);
-  }
-  // Try IPv6
-  struct in6_addr a6;
-  if (inet_pton(AF_INET6, s.c_str(), &a6) == 1) {
+inline std::unique_ptr<IPAddress> IPAddress::fromString(std::string_view s) {
+  const char *first = s.data(), *last = s.data() + s.size();
+  uint32_t v4;
+  auto r = ipchars::parseV4(first, last, v4);
+  if (r.ec == std::errc() && r.ptr == last)
+    return std::make_unique<IPv4Address>(v4);
+  uint8_t b[16];
+  r = ipchars::parseV6(first, last, b);
+  if (r.ec == std::errc() && r.ptr == last) {
     unsigned __int128 v = 0;
-    for (int i = 0; i < 16; ++i) {
-      v <<= 8;
-      v |= static_cast<unsigned char>(a6.s6_addr[i]);
-    }
+    for (int i = 0; i < 16; ++i)
+      v = v << 8 | b[i];
     return std::make_unique<IPv6Address>(v);
   }
   return nullptr;
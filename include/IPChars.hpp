@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file IPChars.hpp
+ * @brief Non-allocating IPv4/IPv6 text parsing and formatting
+ *
+ * std::from_chars / std::to_chars style routines for addresses and prefix
+ * lengths. Parsers read a [first, last) range, stop at the first character
+ * that cannot continue the token and report it through `ptr`; nothing is
+ * written to the output on failure. Formatters write into a caller buffer
+ * and report errc::value_too_large when it is too small. IPv6 output
+ * follows RFC 5952 (lowercase, longest zero run compressed) and uses the
+ * same dotted-quad tail as inet_ntop for IPv4-mapped/compatible addresses.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+namespace ipchars {
+
+  /// Longest dotted-quad IPv4 text ("255.255.255.255").
+  inline constexpr size_t kMaxV4Chars = 15;
+  /// Longest IPv6 text, same as INET6_ADDRSTRLEN without the NUL.
+  inline constexpr size_t kMaxV6Chars = 45;
+  /// Longest "address/len" text.
+  inline constexpr size_t kMaxPrefixChars = kMaxV6Chars + 4;
+
+  namespace detail {
+    constexpr int hexValue(char c) {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return -1;
+    }
+    constexpr bool isDigit(char c) { return c >= '0' && c <= '9'; }
+  } // namespace detail
+
+  /// Parse a dotted-quad IPv4 address into a host-order value. Each octet
+  /// is 1-3 decimal digits, at most 255, with no leading zeros.
+  inline std::from_chars_result parseV4(const char *first, const char *last,
+                                        uint32_t &out) {
+    const char *p = first;
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) {
+      if (i > 0) {
+        if (p == last || *p != '.')
+          return {first, std::errc::invalid_argument};
+        ++p;
+      }
+      const char *start = p;
+      unsigned octet = 0;
+      while (p != last && detail::isDigit(*p) && p - start < 3) {
+        octet = octet * 10 + static_cast<unsigned>(*p - '0');
+        ++p;
+      }
+      if (p == start || octet > 255 || (p - start > 1 && *start == '0') ||
+          (p != last && detail::isDigit(*p)))
+        return {first, std::errc::invalid_argument};
+      v = v << 8 | octet;
+    }
+    out = v;
+    return {p, std::errc()};
+  }
+
+  /// Parse an IPv6 address (RFC 4291 text forms, including "::" and a
+  /// trailing dotted quad) into 16 network-order bytes.
+  inline std::from_chars_result parseV6(const char *first, const char *last,
+                                        uint8_t (&out)[16]) {
+    uint8_t buf[16] = {};
+    int n = 0;
+    int gap = -1;
+    const char *p = first;
+
+    if (p != last && *p == ':') {
+      if (last - p < 2 || p[1] != ':')
+        return {first, std::errc::invalid_argument};
+      gap = 0;
+      p += 2;
+    }
+    while (p != last) {
+      const char *group = p;
+      unsigned v = 0;
+      int digits = 0;
+      for (int h; p != last && digits < 5 && (h = detail::hexValue(*p)) >= 0;
+           ++p, ++digits)
+        v = v << 4 | static_cast<unsigned>(h);
+      if (digits == 0)
+        break;
+      if (p != last && *p == '.') {
+        uint32_t v4;
+        if (n > 12)
+          return {first, std::errc::invalid_argument};
+        auto r = parseV4(group, last, v4);
+        if (r.ec != std::errc())
+          return {first, std::errc::invalid_argument};
+        buf[n++] = static_cast<uint8_t>(v4 >> 24);
+        buf[n++] = static_cast<uint8_t>(v4 >> 16);
+        buf[n++] = static_cast<uint8_t>(v4 >> 8);
+        buf[n++] = static_cast<uint8_t>(v4);
+        p = r.ptr;
+        break;
+      }
+      if (digits > 4 || n == 16)
+        return {first, std::errc::invalid_argument};
+      buf[n++] = static_cast<uint8_t>(v >> 8);
+      buf[n++] = static_cast<uint8_t>(v);
+      if (p == last || *p != ':')
+        break;
+      if (last - p >= 2 && p[1] == ':') {
+        if (gap >= 0)
+          return {first, std::errc::invalid_argument};
+        gap = n;
+        p += 2;
+        continue;
+      }
+      ++p;
+      if (p == last || detail::hexValue(*p) < 0)
+        return {first, std::errc::invalid_argument};
+    }
+
+    if (gap >= 0) {
+      // "::" stands for at least one zero group.
+      if (n == 16)
+        return {first, std::errc::invalid_argument};
+      int tail = n - gap;
+      std::memmove(buf + 16 - tail, buf + gap, static_cast<size_t>(tail));
+      std::memset(buf + gap, 0, static_cast<size_t>(16 - n));
+    } else if (n != 16) {
+      return {first, std::errc::invalid_argument};
+    }
+    std::memcpy(out, buf, sizeof(buf));
+    return {p, std::errc()};
+  }
+
+  /// Parse a decimal prefix length of at most `max` (1-3 digits).
+  inline std::from_chars_result parsePrefixLength(const char *first,
+                                                  const char *last,
+                                                  uint8_t max, uint8_t &out) {
+    const char *p = first;
+    unsigned v = 0;
+    while (p != last && detail::isDigit(*p) && p - first < 3) {
+      v = v * 10 + static_cast<unsigned>(*p - '0');
+      ++p;
+    }
+    if (p == first || v > max || (p != last && detail::isDigit(*p)))
+      return {first, std::errc::invalid_argument};
+    out = static_cast<uint8_t>(v);
+    return {p, std::errc()};
+  }
+
+  /// Format a host-order IPv4 value as a dotted quad.
+  inline std::to_chars_result formatV4(char *first, char *last, uint32_t v) {
+    char *p = first;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      if (shift != 24) {
+        if (p == last)
+          return {last, std::errc::value_too_large};
+        *p++ = '.';
+      }
+      auto r = std::to_chars(p, last, (v >> shift) & 0xff);
+      if (r.ec != std::errc())
+        return r;
+      p = r.ptr;
+    }
+    return {p, std::errc()};
+  }
+
+  /// Append "/len" (a prefix length suffix).
+  inline std::to_chars_result formatPrefixLength(char *first, char *last,
+                                                 uint8_t len) {
+    if (first == last)
+      return {last, std::errc::value_too_large};
+    *first = '/';
+    return std::to_chars(first + 1, last, len);
+  }
+
+  /// Format 16 network-order bytes as RFC 5952 IPv6 text.
+  inline std::to_chars_result formatV6(char *first, char *last,
+                                       const uint8_t *bytes) {
+    uint16_t words[8];
+    for (int i = 0; i < 8; ++i)
+      words[i] = static_cast<uint16_t>(bytes[2 * i] << 8 | bytes[2 * i + 1]);
+
+    // Longest run of two or more zero groups; the first one wins ties.
+    int best = -1, bestLen = 0;
+    for (int i = 0; i < 8;) {
+      if (words[i] != 0) {
+        ++i;
+        continue;
+      }
+      int j = i;
+      while (j < 8 && words[j] == 0)
+        ++j;
+      if (j - i > bestLen && j - i >= 2) {
+        best = i;
+        bestLen = j - i;
+      }
+      i = j;
+    }
+
+    char tmp[kMaxV6Chars];
+    char *p = tmp;
+    char *const end = tmp + sizeof(tmp);
+    for (int i = 0; i < 8; ++i) {
+      if (i == best) {
+        *p++ = ':';
+        if (i + bestLen == 8)
+          *p++ = ':';
+        i += bestLen - 1;
+        continue;
+      }
+      if (i > 0)
+        *p++ = ':';
+      // ::a.b.c.d and ::ffff:a.b.c.d keep the dotted tail, as inet_ntop.
+      if (i == 6 && best == 0 &&
+          (bestLen == 6 || (bestLen == 5 && words[5] == 0xffff))) {
+        uint32_t v4 = static_cast<uint32_t>(words[6]) << 16 | words[7];
+        p = formatV4(p, end, v4).ptr;
+        break;
+      }
+      p = std::to_chars(p, end, words[i], 16).ptr;
+    }
+
+    size_t len = static_cast<size_t>(p - tmp);
+    if (static_cast<size_t>(last - first) < len)
+      return {last, std::errc::value_too_large};
+    std::memcpy(first, tmp, len);
+    return {first + len, std::errc()};
+  }
+
+} // namespace ipchars
@@ -34,6 +34,7 @@
 
 #include "AddressFamily.hpp"
 #include "IPAddress.hpp"
+#include "IPChars.hpp"
 #include <arpa/inet.h>
 #include <cstdint>
 #include <cstring>
@@ -41,6 +42,7 @@
 #include <netinet/in.h>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <sys/socket.h>
 
 // Polymorphic IP network base type
@@ -60,8 +62,9 @@ public:
   // Returns 32 for IPv4 when `sa` is null, 128 for IPv6 when null.
   static uint8_t masklenFromSockaddr(const struct sockaddr *sa);
 
-  // Parse network string like "192.0.2.0/24" or IPv6 notation.
-  static std::unique_ptr<IPNetwork> fromString(const std::string &s);
+  // Parse network string like "192.0.2.0/24" or IPv6 notation. Returns
+  // nullptr for malformed addresses and out-of-range prefix lengths.
+  static std::unique_ptr<IPNetwork> fromString(std::string_view s);
 };
 
 // IPv4 network implementation
@@ -72,19 +75,11 @@ class IPv4Network : public IPNetwork {
 public:
   IPv4Network() = default;
   IPv4Network(uint32_t a, uint8_t m) : addr_(a), mask_(m) {}
-  explicit IPv4Network(const std::string &s) {
-    auto pos = s.find('/');
-    std::string a = s;
-    if (pos != std::string::npos) {
-      a = s.substr(0, pos);
-      mask_ = static_cast<uint8_t>(std::stoi(s.substr(pos + 1)));
-    }
-    struct in_addr a4;
-    if (inet_pton(AF_INET, a.c_str(), &a4) == 1) {
-      addr_ = ntohl(a4.s_addr);
-    } else {
-      addr_ = 0;
-    }
+  explicit IPv4Network(std::string_view s) {
+    const char *last = s.data() + s.size();
+    auto r = ipchars::parseV4(s.data(), last, addr_);
+    if (r.ec == std::errc() && r.ptr != last && *r.ptr == '/')
+      ipchars::parsePrefixLength(r.ptr + 1, last, 32, mask_);
   }
 
   AddressFamily family() const override { return AddressFamily::IPv4; }
@@ -99,12 +94,10 @@ public:
   }
 
   std::string toString() const override {
-    struct in_addr a4;
-    a4.s_addr = htonl(addr_);
-    char buf[INET_ADDRSTRLEN] = {0};
-    if (inet_ntop(AF_INET, &a4, buf, sizeof(buf)) == nullptr)
-      return std::string();
-    return std::string(buf) + "/" + std::to_string(mask_);
+    char buf[ipchars::kMaxV4Chars + 4];
+    char *end = buf + sizeof(buf);
+    char *p = ipchars::formatV4(buf, end, addr_).ptr;
+    return std::string(buf, ipchars::formatPrefixLength(p, end, mask_).ptr);
   }
 
   std::unique_ptr<IPNetwork> clone() const override {
@@ -129,24 +122,16 @@ public:
 
   IPv6Network() = default;
   IPv6Network(unsigned __int128 a, uint8_t m) : addr_(a), mask_(m) {}
-  explicit IPv6Network(const std::string &s) {
-    auto pos = s.find('/');
-    std::string a = s;
-    if (pos != std::string::npos) {
-      a = s.substr(0, pos);
-      mask_ = static_cast<uint8_t>(std::stoi(s.substr(pos + 1)));
-    }
-    struct in6_addr a6;
-    if (inet_pton(AF_INET6, a.c_str(), &a6) == 1) {
-      unsigned __int128 v = 0;
-      for (int i = 0; i < 16; ++i) {
-        v <<= 8;
-        v |= static_cast<unsigned char>(a6.s6_addr[i]);
-      }
-      addr_ = v;
-    } else {
-      addr_ = 0;
-    }
+  explicit IPv6Network(std::string_view s) {
+    const char *last = s.data() + s.size();
+    uint8_t b[16];
+    auto r = ipchars::parseV6(s.data(), last, b);
+    if (r.ec != std::errc())
+      return;
+    for (int i = 0; i < 16; ++i)
+      addr_ = addr_ << 8 | b[i];
+    if (r.ptr != last && *r.ptr == '/')
+      ipchars::parsePrefixLength(r.ptr + 1, last, 128, mask_);
   }
 
   AddressFamily family() const override { return AddressFamily::IPv6; }
@@ -167,16 +152,16 @@ public:
   }
 
   std::string toString() const override {
-    struct in6_addr a6;
+    uint8_t b[16];
     unsigned __int128 v = addr_;
     for (int i = 15; i >= 0; --i) {
-      a6.s6_addr[i] = static_cast<uint8_t>(v & 0xFF);
+      b[i] = static_cast<uint8_t>(v & 0xFF);
       v >>= 8;
     }
-    char buf[INET6_ADDRSTRLEN] = {0};
-    if (inet_ntop(AF_INET6, &a6, buf, sizeof(buf)) == nullptr)
-      return std::string();
-    return std::string(buf) + "/" + std::to_string(mask_);
+    char buf[ipchars::kMaxPrefixChars];
+    char *end = buf + sizeof(buf);
+    char *p = ipchars::formatV6(buf, end, b).ptr;
+    return std::string(buf, ipchars::formatPrefixLength(p, end, mask_).ptr);
   }
 
   std::unique_ptr<IPNetwork> clone() const override {
@@ -190,30 +175,29 @@ public:
 };
 
 // Factory: parse network string like "192.0.2.0/24" or IPv6
-inline std::unique_ptr<IPNetwork> IPNetwork::fromString(const std::string &s) {
-  // Try IPv4 pattern
-  auto pos = s.find('/');
-  std::string addr = s;
-  if (pos != std::string::npos)
-    addr = s.substr(0, pos);
-  struct in_addr a4;
-  if (inet_pton(AF_INET, addr.c_str(), &a4) == 1) {
-    uint32_t v = ntohl(a4.s_addr);
+inline std::unique_ptr<IPNetwork> IPNetwork::fromString(std::string_view s) {
+  const char *first = s.data(), *last = s.data() + s.size();
+  uint32_t v4;
+  auto r = ipchars::parseV4(first, last, v4);
+  if (r.ec == std::errc()) {
     uint8_t m = 32;
-    if (pos != std::string::npos)
-      m = static_cast<uint8_t>(std::stoi(s.substr(pos + 1)));
-    return std::make_unique<IPv4Network>(v, m);
+    if (r.ptr != last && *r.ptr == '/')
+      r = ipchars::parsePrefixLength(r.ptr + 1, last, 32, m);
+    if (r.ec != std::errc() || r.ptr != last)
+      return nullptr;
+    return std::make_unique<IPv4Network>(v4, m);
   }
-  struct in6_addr a6;
-  if (inet_pton(AF_INET6, addr.c_str(), &a6) == 1) {
-    unsigned __int128 v = 0;
-    for (int i = 0; i < 16; ++i) {
-      v <<= 8;
-      v |= static_cast<unsigned char>(a6.s6_addr[i]);
-    }
+  uint8_t b[16];
+  r = ipchars::parseV6(first, last, b);
+  if (r.ec == std::errc()) {
     uint8_t m = 128;
-    if (pos != std::string::npos)
-      m = static_cast<uint8_t>(std::stoi(s.substr(pos + 1)));
+    if (r.ptr != last && *r.ptr == '/')
+      r = ipchars::parsePrefixLength(r.ptr + 1, last, 128, m);
+    if (r.ec != std::errc() || r.ptr != last)
+      return nullptr;
+    unsigned __int128 v = 0;
+    for (int i = 0; i < 16; ++i)
+      v = v << 8 | b[i];
     return std::make_unique<IPv6Network>(v, m);
   }
   return nullptr;
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file IPPrefix.hpp
+ * @brief Flat, trivially copyable IP address/prefix value type
+ *
+ * IPPrefix stores an IPv4 or IPv6 address inline (16 bytes, network byte
+ * order, IPv4 in the first four bytes) together with the family and a
+ * prefix length. A bare address is a prefix of full length. Values are
+ * totally ordered (family, address, length) and hashable, so they can be
+ * kept in flat vectors and sorted or used as map keys without allocating.
+ * IPAddress / IPNetwork remain for callers that need the polymorphic
+ * interface; toNetwork()/toAddress() convert on demand.
+ */
+
+#pragma once
+
+#include "AddressFamily.hpp"
+#include "IPAddress.hpp"
+#include "IPChars.hpp"
+#include "IPNetwork.hpp"
+#include <array>
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+class IPPrefix {
+public:
+  constexpr IPPrefix() = default;
+
+  /// IPv4 address in host byte order.
+  static constexpr IPPrefix v4(uint32_t addr, uint8_t len = 32) {
+    IPPrefix p;
+    p.fam_ = kV4;
+    p.len_ = len > 32 ? 32 : len;
+    p.bytes_[0] = static_cast<uint8_t>(addr >> 24);
+    p.bytes_[1] = static_cast<uint8_t>(addr >> 16);
+    p.bytes_[2] = static_cast<uint8_t>(addr >> 8);
+    p.bytes_[3] = static_cast<uint8_t>(addr);
+    return p;
+  }
+
+  /// IPv6 address as a 128-bit integer in host byte order.
+  static constexpr IPPrefix v6(unsigned __int128 addr, uint8_t len = 128) {
+    IPPrefix p;
+    p.fam_ = kV6;
+    p.len_ = len > 128 ? 128 : len;
+    for (int i = 15; i >= 0; --i) {
+      p.bytes_[i] = static_cast<uint8_t>(addr);
+      addr >>= 8;
+    }
+    return p;
+  }
+
+  /// IPv6 address from 16 bytes in network byte order (e.g. in6_addr).
+  static IPPrefix v6Bytes(const void *bytes, uint8_t len = 128) {
+    IPPrefix p;
+    p.fam_ = kV6;
+    p.len_ = len > 128 ? 128 : len;
+    std::memcpy(p.bytes_.data(), bytes, 16);
+    return p;
+  }
+
+  /// Parse "addr" or "addr/len". Returns nullopt on malformed input or an
+  /// out-of-range prefix length.
+  static std::optional<IPPrefix> fromString(std::string_view s);
+  /// from_chars-style parse of the longest "addr[/len]" at `first`. On
+  /// success `out` is assigned and `ptr` points past the consumed text.
+  static std::from_chars_result fromChars(const char *first,
+                                          const char *last, IPPrefix &out);
+
+  /// Build from a sockaddr_in / sockaddr_in6 and a prefix length (defaults
+  /// to the full length of the family).
+  static std::optional<IPPrefix> fromSockaddr(const struct sockaddr *sa,
+                                              std::optional<uint8_t> len = {});
+
+  /// Convert from the polymorphic types.
+  static IPPrefix fromNetwork(const IPNetwork &net);
+  static IPPrefix fromAddress(const IPAddress &addr);
+
+  constexpr bool empty() const { return fam_ == kNone; }
+  constexpr explicit operator bool() const { return !empty(); }
+  constexpr bool isV4() const { return fam_ == kV4; }
+  constexpr bool isV6() const { return fam_ == kV6; }
+  constexpr AddressFamily family() const {
+    return fam_ == kV6 ? AddressFamily::IPv6 : AddressFamily::IPv4;
+  }
+  /// AF_INET / AF_INET6, or AF_UNSPEC for an empty value.
+  constexpr int af() const {
+    return fam_ == kV4 ? AF_INET : fam_ == kV6 ? AF_INET6 : AF_UNSPEC;
+  }
+
+  constexpr uint8_t length() const { return len_; }
+  constexpr uint8_t maxLength() const {
+    return fam_ == kV6 ? 128 : fam_ == kV4 ? 32 : 0;
+  }
+  constexpr bool isHost() const { return len_ == maxLength(); }
+
+  /// Raw address bytes in network byte order (4 or 16 significant bytes).
+  constexpr const std::array<uint8_t, 16> &bytes() const { return bytes_; }
+  constexpr uint32_t v4Value() const {
+    return (uint32_t(bytes_[0]) << 24) | (uint32_t(bytes_[1]) << 16) |
+           (uint32_t(bytes_[2]) << 8) | uint32_t(bytes_[3]);
+  }
+  constexpr unsigned __int128 v6Value() const {
+    unsigned __int128 v = 0;
+    for (uint8_t b : bytes_)
+      v = (v << 8) | b;
+    return v;
+  }
+
+  // ── Mask helpers ────────────────────────────────────────────────────
+  static constexpr uint32_t maskV4(uint8_t len) {
+    return len == 0 ? 0u : len >= 32 ? ~0u : ~0u << (32 - len);
+  }
+  static constexpr unsigned __int128 maskV6(uint8_t len) {
+    constexpr unsigned __int128 ones = ~static_cast<unsigned __int128>(0);
+    return len == 0 ? 0 : len >= 128 ? ones : ones << (128 - len);
+  }
+
+  /// The same address with a different prefix length.
+  constexpr IPPrefix withLength(uint8_t len) const {
+    IPPrefix p = *this;
+    p.len_ = len > maxLength() ? maxLength() : len;
+    return p;
+  }
+  /// The address alone (full-length prefix).
+  constexpr IPPrefix address() const { return withLength(maxLength()); }
+  /// The address with host bits cleared.
+  constexpr IPPrefix network() const {
+    IPPrefix p = *this;
+    for (int i = 0; i < 16; ++i) {
+      int bits = static_cast<int>(len_) - i * 8;
+      if (bits <= 0)
+        p.bytes_[i] = 0;
+      else if (bits < 8)
+        p.bytes_[i] &= static_cast<uint8_t>(0xff << (8 - bits));
+    }
+    return p;
+  }
+  /// True when `other` (address or prefix) lies inside this prefix.
+  constexpr bool contains(const IPPrefix &other) const {
+    if (fam_ != other.fam_ || other.len_ < len_)
+      return false;
+    return other.withLength(len_).network() == network();
+  }
+
+  /// "addr/len".
+  std::string toString() const;
+  /// "addr" without the prefix length.
+  std::string addressString() const;
+  /// to_chars-style formatting into [first, last); needs at most
+  /// ipchars::kMaxPrefixChars (resp. kMaxV6Chars) bytes.
+  std::to_chars_result toChars(char *first, char *last) const;
+  std::to_chars_result addressToChars(char *first, char *last) const;
+
+  std::unique_ptr<IPNetwork> toNetwork() const;
+  std::unique_ptr<IPAddress> toAddress() const;
+
+  constexpr bool operator==(const IPPrefix &) const = default;
+  constexpr auto operator<=>(const IPPrefix &) const = default;
+
+private:
+  static constexpr uint8_t kNone = 0;
+  static constexpr uint8_t kV4 = 4;
+  static constexpr uint8_t kV6 = 6;
+
+  // Member order defines the ordering: family, address, length.
+  uint8_t fam_ = kNone;
+  std::array<uint8_t, 16> bytes_{};
+  uint8_t len_ = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<IPPrefix>);
+static_assert(sizeof(IPPrefix) == 18);
+
+template <> struct std::hash<IPPrefix> {
+  size_t operator()(const IPPrefix &p) const noexcept {
+    uint64_t lo, hi;
+    std::memcpy(&hi, p.bytes().data(), 8);
+    std::memcpy(&lo, p.bytes().data() + 8, 8);
+    uint64_t h = hi * 0x9e3779b97f4a7c15ull ^ lo;
+    h ^= (uint64_t(p.length()) << 8 | uint64_t(p.af())) * 0xff51afd7ed558ccdull;
+    return static_cast<size_t>(h ^ (h >> 32));
+  }
+};
+
+// ── Inline definitions ───────────────────────────────────────────────
+
+inline std::from_chars_result
+IPPrefix::fromChars(const char *first, const char *last, IPPrefix &out) {
+  IPPrefix p;
+  uint32_t a4;
+  auto r = ipchars::parseV4(first, last, a4);
+  if (r.ec == std::errc() && (r.ptr == last || *r.ptr != ':')) {
+    p = v4(a4);
+  } else {
+    uint8_t a6[16];
+    r = ipchars::parseV6(first, last, a6);
+    if (r.ec != std::errc())
+      return r;
+    p = v6Bytes(a6);
+  }
+  if (r.ptr != last && *r.ptr == '/') {
+    auto lr = ipchars::parsePrefixLength(r.ptr + 1, last, p.maxLength(),
+                                         p.len_);
+    if (lr.ec != std::errc())
+      return {first, lr.ec};
+    r.ptr = lr.ptr;
+  }
+  out = p;
+  return r;
+}
+
+inline std::optional<IPPrefix> IPPrefix::fromString(std::string_view s) {
+  IPPrefix p;
+  auto r = fromChars(s.data(), s.data() + s.size(), p);
+  if (r.ec != std::errc() || r.ptr != s.data() + s.size())
+    return std::nullopt;
+  return p;
+}
+
+inline std::optional<IPPrefix>
+IPPrefix::fromSockaddr(const struct sockaddr *sa, std::optional<uint8_t> len) {
+  if (!sa)
+    return std::nullopt;
+  if (sa->sa_family == AF_INET) {
+    auto *sin = reinterpret_cast<const struct sockaddr_in *>(sa);
+    return v4(ntohl(sin->sin_addr.s_addr), len.value_or(32));
+  }
+  if (sa->sa_family == AF_INET6) {
+    auto *sin6 = reinterpret_cast<const struct sockaddr_in6 *>(sa);
+    return v6Bytes(sin6->sin6_addr.s6_addr, len.value_or(128));
+  }
+  return std::nullopt;
+}
+
+inline IPPrefix IPPrefix::fromNetwork(const IPNetwork &net) {
+  if (auto *n4 = dynamic_cast<const IPv4Network *>(&net))
+    return v4(static_cast<const IPv4Address &>(*n4->address()).value(),
+              n4->mask());
+  auto a = net.address();
+  return v6(static_cast<const IPv6Address &>(*a).value(), net.mask());
+}
+
+inline IPPrefix IPPrefix::fromAddress(const IPAddress &addr) {
+  if (auto *a4 = dynamic_cast<const IPv4Address *>(&addr))
+    return v4(a4->value());
+  return v6(static_cast<const IPv6Address &>(addr).value());
+}
+
+inline std::to_chars_result IPPrefix::addressToChars(char *first,
+                                                    char *last) const {
+  if (isV4())
+    return ipchars::formatV4(first, last, v4Value());
+  if (isV6())
+    return ipchars::formatV6(first, last, bytes_.data());
+  return {first, std::errc()};
+}
+
+inline std::to_chars_result IPPrefix::toChars(char *first, char *last) const {
+  auto r = addressToChars(first, last);
+  if (r.ec != std::errc() || empty())
+    return r;
+  return ipchars::formatPrefixLength(r.ptr, last, len_);
+}
+
+inline std::string IPPrefix::addressString() const {
+  char buf[ipchars::kMaxV6Chars];
+  return std::string(buf, addressToChars(buf, buf + sizeof(buf)).ptr);
+}
+
+inline std::string IPPrefix::toString() const {
+  char buf[ipchars::kMaxPrefixChars];
+  return std::string(buf, toChars(buf, buf + sizeof(buf)).ptr);
+}
+
+inline std::unique_ptr<IPNetwork> IPPrefix::toNetwork() const {
+  if (isV4())
+    return std::make_unique<IPv4Network>(v4Value(), len_);
+  if (isV6())
+    return std::make_unique<IPv6Network>(v6Value(), len_);
+  return nullptr;
+}
+
+inline std::unique_ptr<IPAddress> IPPrefix::toAddress() const {
+  if (isV4())
+    return std::make_unique<IPv4Address>(v4Value());
+  if (isV6())
+    return std::make_unique<IPv6Address>(v6Value());
+  return nullptr;
+}
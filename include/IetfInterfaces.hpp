@@ -115,76 +115,33 @@ public:
       newPath(ctx, ipv6_mtu_fmt, mtu_str, iface.name);
     }
 
-    auto emitNetwork = [&](const IPNetwork *net) {
-      if (!net)
+    auto emitNetwork = [&](const InterfaceAddress &net) {
+      if (net.prefix.empty())
         return;
-      auto addrPtr = net->address();
-      if (!addrPtr)
-        return;
-      std::string ipstr = addrPtr->toString();
-      std::string plen = std::to_string(net->mask());
-      if (net->family() == AddressFamily::IPv4) {
-        std::string cidr_mask;
-
-        if (auto m = IPAddress::maskFromCIDR(AddressFamily::IPv4, net->mask()))
-          cidr_mask = m->toString();
-
-        std::string subnet_mask;
-        if (auto sm = net->subnet())
-          subnet_mask = sm->toString();
-
-        if (!subnet_mask.empty() && !cidr_mask.empty() &&
-            subnet_mask != cidr_mask) {
-          newPath(ctx, ipv4_addr_netmask_fmt, subnet_mask, iface.name, ipstr);
-        } else {
-          newPath(ctx, ipv4_addr_prefix_fmt, plen, iface.name, ipstr);
-        }
-      } else if (net->family() == AddressFamily::IPv6) {
+      std::string ipstr = net.prefix.addressString();
+      std::string plen = std::to_string(net.mask());
+      if (net.family() == AddressFamily::IPv4) {
+        newPath(ctx, ipv4_addr_prefix_fmt, plen, iface.name, ipstr);
+      } else {
         newPath(ctx, ipv6_addr_prefix_fmt, plen, iface.name, ipstr);
 
-        if (const IPv6Network *v6 = dynamic_cast<const IPv6Network *>(net)) {
-          if (v6->pltime || v6->vltime) {
-            newPath(ctx, ipv6_addr_origin_fmt, "random", iface.name, ipstr);
-          } else {
-            if (const IPv6Address *ip6 =
-                    dynamic_cast<const IPv6Address *>(addrPtr.get())) {
-              unsigned __int128 val = ip6->value();
-              uint16_t top = static_cast<uint16_t>((val >> 112) & 0xffff);
-              if (top == 0xfe80u)
-                newPath(ctx, ipv6_addr_origin_fmt, "link-layer", iface.name,
-                        ipstr);
-              else
-                newPath(ctx, ipv6_addr_origin_fmt, "static", iface.name, ipstr);
-            } else {
-              newPath(ctx, ipv6_addr_origin_fmt, "static", iface.name, ipstr);
-            }
-          }
-        } else {
-          if (const IPv6Address *ip6 =
-                  dynamic_cast<const IPv6Address *>(addrPtr.get())) {
-            unsigned __int128 val = ip6->value();
-            uint16_t top = static_cast<uint16_t>((val >> 112) & 0xffff);
-            if (top == 0xfe80u)
-              newPath(ctx, ipv6_addr_origin_fmt, "link-layer", iface.name,
-                      ipstr);
-            else
-              newPath(ctx, ipv6_addr_origin_fmt, "static", iface.name, ipstr);
-          } else {
-            newPath(ctx, ipv6_addr_origin_fmt, "static", iface.name, ipstr);
-          }
-        }
+        const auto &b = net.prefix.bytes();
+        const char *origin = "static";
+        if (net.pltime || net.vltime)
+          origin = "random";
+        else if (b[0] == 0xfe && (b[1] & 0xc0) == 0x80)
+          origin = "link-layer";
+        newPath(ctx, ipv6_addr_origin_fmt, origin, iface.name, ipstr);
       }
     };
 
     // Primary address
     if (iface.address)
-      emitNetwork(iface.address.get());
+      emitNetwork(*iface.address);
 
     // Aliases
-    for (const auto &a : iface.aliases) {
-      if (a)
-        emitNetwork(a.get());
-    }
+    for (const auto &a : iface.aliases)
+      emitNetwork(a);
 
     return node_;
   }
@@ -330,12 +287,12 @@ public:
               } else {
                 full = std::string(ipstr ? ipstr : "");
               }
-              if (auto net = IPNetwork::fromString(full)) {
+              if (auto net = IPPrefix::fromString(full)) {
                 if (!havePrimaryAddr) {
-                  out.address = std::move(net);
+                  out.address = *net;
                   havePrimaryAddr = true;
                 } else {
-                  out.aliases.push_back(std::move(net));
+                  out.aliases.push_back(*net);
                 }
               }
               continue;
@@ -345,12 +302,12 @@ public:
             std::string full = ipstr;
             if (!plen.empty())
               full += "/" + plen;
-            if (auto net = IPNetwork::fromString(full)) {
+            if (auto net = IPPrefix::fromString(full)) {
               if (!havePrimaryAddr) {
-                out.address = std::move(net);
+                out.address = *net;
                 havePrimaryAddr = true;
               } else {
-                out.aliases.push_back(std::move(net));
+                out.aliases.push_back(*net);
               }
             }
           }
@@ -33,7 +33,7 @@
 #pragma once
 
 #include "ConfigData.hpp"
-#include "IPNetwork.hpp"
+#include "IPPrefix.hpp"
 #include "InterfaceType.hpp"
 #include <memory>
 #include <optional>
@@ -45,28 +45,60 @@
 
 class ConfigurationManager; // Forward declaration to avoid circular dependency
 
+/**
+ * @brief One address assigned to an interface
+ *
+ * The prefix plus the per-address IPv6 state reported by the kernel. Being
+ * trivially copyable, address lists copy as a block with no per-address
+ * allocation.
+ */
+struct InterfaceAddress {
+  InterfaceAddress() = default;
+  InterfaceAddress(const IPPrefix &p) : prefix(p) {}
+
+  IPPrefix prefix;
+  std::optional<uint32_t> addr_flags; ///< IN6_IFF_* flags (IPv6 only)
+  std::optional<uint32_t> scopeid;    ///< Scope ID for link/site-local
+  std::optional<uint32_t> pltime;     ///< Preferred lifetime (seconds)
+  std::optional<uint32_t> vltime;     ///< Valid lifetime (seconds)
+
+  AddressFamily family() const { return prefix.family(); }
+  uint8_t mask() const { return prefix.length(); }
+  std::string toString() const { return prefix.toString(); }
+};
+
+static_assert(std::is_trivially_copyable_v<InterfaceAddress>);
+
 /**
  * @brief Complete configuration for a network interface
  *
  * Supports all interface types with type-specific configurations.
  * Optional fields allow for sparse configuration updates.
+ *
+ * The VRF is held as an immutable shared object: copies of an interface
+ * (per-type configs, generator scratch copies, show tables) share it
+ * instead of cloning it, and code that changes membership installs a new
+ * VRFConfig rather than editing the shared one.
  */
 class InterfaceConfig : public ConfigData {
 public:
   InterfaceConfig() = default;
   // Platform-specific constructor removed; system layer builds instances.
   InterfaceConfig(std::string name, InterfaceType type,
-                  std::unique_ptr<IPNetwork> address,
-                  std::vector<std::unique_ptr<IPNetwork>> aliases,
-                  std::unique_ptr<VRFConfig> vrf, std::optional<uint32_t> flags,
+                  std::optional<InterfaceAddress> address,
+                  std::vector<InterfaceAddress> aliases,
+                  std::shared_ptr<const VRFConfig> vrf,
+                  std::optional<uint32_t> flags,
                   std::vector<std::string> groups, std::optional<int> mtu);
-  // Copy semantics: deep copy owned pointers (defined out-of-line)
-  InterfaceConfig(const InterfaceConfig &o);
+  InterfaceConfig(const InterfaceConfig &) = default;
+  InterfaceConfig(InterfaceConfig &&) noexcept = default;
+  InterfaceConfig &operator=(const InterfaceConfig &) = default;
+  InterfaceConfig &operator=(InterfaceConfig &&) noexcept = default;
   std::string name; ///< Interface name (e.g., em0, bridge0)
   InterfaceType type = InterfaceType::Unknown; ///< Interface type
-  std::unique_ptr<IPNetwork> address; ///< Primary IP address with prefix
-  std::vector<std::unique_ptr<IPNetwork>> aliases; ///< Additional IP addresses
-  std::unique_ptr<VRFConfig> vrf;                  ///< VRF membership
+  std::optional<InterfaceAddress> address; ///< Primary IP address with prefix
+  std::vector<InterfaceAddress> aliases;   ///< Additional IP addresses
+  std::shared_ptr<const VRFConfig> vrf;    ///< VRF membership (shared)
   std::optional<uint32_t> flags;   ///< System flags (IFF_UP, IFF_RUNNING, etc.)
   std::vector<std::string> groups; ///< Interface groups
   std::optional<int> mtu;          ///< Maximum Transmission Unit
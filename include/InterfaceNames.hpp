@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file InterfaceNames.hpp
+ * @brief Process-wide table of interned interface and group names
+ *
+ * Each distinct name gets a small dense id for the life of the process, so
+ * joins and sets over interfaces (duplicate suppression in the generator,
+ * group collection, "is this a known interface") compare and hash 32-bit
+ * integers instead of strings. Names are stored once and never move;
+ * name() references stay valid for the life of the process.
+ *
+ * Kernel interface indexes are not stable (an index can be reused after
+ * an interface is destroyed), so they are mapped through a separate
+ * InterfaceIndexCache that lives for one enumeration pass only.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using InterfaceId = uint32_t;
+
+class InterfaceNames {
+public:
+  static constexpr InterfaceId kNone = 0;
+
+  /// The process-wide table. Safe to use from concurrent generator stages.
+  static InterfaceNames &instance();
+
+  /// Id for @p name, adding it on first use. The empty name maps to kNone.
+  InterfaceId intern(std::string_view name);
+
+  /// Id for @p name if it has been interned, otherwise kNone.
+  InterfaceId find(std::string_view name) const;
+
+  /// The name behind @p id (empty for kNone or an unknown id).
+  const std::string &name(InterfaceId id) const;
+
+private:
+  InterfaceNames() = default;
+
+  mutable std::shared_mutex mutex_;
+  std::deque<std::string> names_; ///< id - 1 -> name
+  std::unordered_map<std::string_view, InterfaceId> ids_;
+};
+
+/**
+ * @brief ifindex -> interned name for one enumeration pass
+ *
+ * Resolves each kernel index with if_indextoname() once per pass instead
+ * of once per route or neighbour entry.
+ */
+class InterfaceIndexCache {
+public:
+  /// Id of the interface with kernel index @p ifindex, kNone if none.
+  InterfaceId id(unsigned int ifindex);
+
+  /// Name of the interface with kernel index @p ifindex, or nullptr.
+  const std::string *name(unsigned int ifindex);
+
+private:
+  std::unordered_map<unsigned int, InterfaceId> ids_;
+};
@@ -34,6 +34,7 @@
 
 #include "InterfaceType.hpp"
 #include "InterfaceTypeDispatch.hpp"
+#include <algorithm>
 #include <iostream>
 #include <optional>
 #include <string>
@@ -66,33 +67,36 @@ public:
   /**
    * @brief Render an InterfaceConfig to a command string
    */
-  static std::string toString(InterfaceConfig *cfg);
+  static std::string toString(const InterfaceConfig *cfg);
 
   /// Central type→handler dispatch table lookup.
   /// Returns nullptr for Unknown or unmapped types.
   static const InterfaceTypeDispatch *dispatch(InterfaceType t);
 
   /* overloads for specific interface-related configs */
-  static std::string toString(BridgeInterfaceConfig *cfg);
-  static std::string toString(CarpInterfaceConfig *cfg);
-  static std::string toString(GreInterfaceConfig *cfg);
-  static std::string toString(LaggInterfaceConfig *cfg);
-  static std::string toString(SixToFourInterfaceConfig *cfg);
-  static std::string toString(TapInterfaceConfig *cfg);
+  static std::string toString(const BridgeInterfaceConfig *cfg);
+  static std::string toString(const CarpInterfaceConfig *cfg);
+  static std::string toString(const GreInterfaceConfig *cfg);
+  static std::string toString(const LaggInterfaceConfig *cfg);
+  static std::string toString(const SixToFourInterfaceConfig *cfg);
+  static std::string toString(const TapInterfaceConfig *cfg);
 
-  static std::string toString(TunInterfaceConfig *cfg);
-  static std::string toString(GifInterfaceConfig *cfg);
-  static std::string toString(OvpnInterfaceConfig *cfg);
-  static std::string toString(IpsecInterfaceConfig *cfg);
-  static std::string toString(VlanInterfaceConfig *cfg);
-  static std::string toString(VxlanInterfaceConfig *cfg);
-  static std::string toString(WlanInterfaceConfig *cfg);
-  static std::string toString(WireGuardInterfaceConfig *cfg);
+  static std::string toString(const TunInterfaceConfig *cfg);
+  static std::string toString(const GifInterfaceConfig *cfg);
+  static std::string toString(const OvpnInterfaceConfig *cfg);
+  static std::string toString(const IpsecInterfaceConfig *cfg);
+  static std::string toString(const VlanInterfaceConfig *cfg);
+  static std::string toString(const VxlanInterfaceConfig *cfg);
+  static std::string toString(const WlanInterfaceConfig *cfg);
+  static std::string toString(const WireGuardInterfaceConfig *cfg);
   std::vector<std::string>
   autoComplete(std::string_view partial) const override;
   std::vector<std::string>
   autoComplete(const std::vector<std::string> &tokens, std::string_view partial,
-               ConfigurationManager *mgr) const override;
+               const CompletionCache *cache) const override;
+
+  TokenKind kind() const override { return TokenKind::Interface; }
+
   std::unique_ptr<Token> clone() const override;
 
   /// Execute a 'set interface' command using this token's parsed state.
@@ -102,6 +106,12 @@ public:
   /// Execute a 'delete interface' command using this token's parsed state.
   void executeDelete(ConfigurationManager *mgr) const;
 
+  /// The work behind executeSet() and executeDelete(). These throw when the
+  /// command is invalid or the backend rejects it, where the execute*
+  /// variants print the error, so a batch can roll back.
+  void applySet(ConfigurationManager &mgr) const;
+  void applyDelete(ConfigurationManager &mgr) const;
+
   const std::string &name() const { return name_; }
   InterfaceType type() const { return type_; }
   std::optional<int> vrf;
@@ -117,6 +127,12 @@ public:
   std::optional<std::string> source;
   std::optional<std::string> destination;
 
+  // Tun/tap device options (queues, owner, owner-group, vnet-hdr)
+  std::optional<int> queues;
+  std::optional<std::string> owner;
+  std::optional<std::string> owner_group;
+  std::optional<bool> vnet_hdr;
+
   // --- IPsec SA sub-command fields ---
   std::optional<IpsecSA> ipsec_sa;
 
@@ -151,71 +167,75 @@ public:
   //  - interfaces
   //  - interfaces <type> <name>   where <type> is ethernet|loopback|pppoe
   static std::shared_ptr<InterfaceToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
 protected:
   /// Parse keyword arguments from tokens starting at cur, advancing cur past
   /// consumed tokens. Dispatches to per-type keyword parsers based on type().
   static void parseKeywords(std::shared_ptr<InterfaceToken> &tok,
-                            const std::vector<std::string> &tokens,
+                            const std::vector<std::string_view> &tokens,
                             size_t &cur);
 
   // Per-type keyword parsers — each handles type-specific keywords and returns
   // true if it consumed any tokens at cur, false otherwise.
   static bool parseBridgeKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                  const std::vector<std::string> &tokens,
+                                  const std::vector<std::string_view> &tokens,
                                   size_t &cur);
   static bool parseVlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                const std::vector<std::string> &tokens,
+                                const std::vector<std::string_view> &tokens,
                                 size_t &cur);
   static bool parseLaggKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                const std::vector<std::string> &tokens,
+                                const std::vector<std::string_view> &tokens,
                                 size_t &cur);
   static bool parseTunKeywords(std::shared_ptr<InterfaceToken> &tok,
-                               const std::vector<std::string> &tokens,
+                               const std::vector<std::string_view> &tokens,
                                size_t &cur);
   static bool parseGifKeywords(std::shared_ptr<InterfaceToken> &tok,
-                               const std::vector<std::string> &tokens,
+                               const std::vector<std::string_view> &tokens,
                                size_t &cur);
   static bool parseOvpnKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                const std::vector<std::string> &tokens,
+                                const std::vector<std::string_view> &tokens,
                                 size_t &cur);
   static bool parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                 const std::vector<std::string> &tokens,
+                                 const std::vector<std::string_view> &tokens,
                                  size_t &cur);
   static bool parseGreKeywords(std::shared_ptr<InterfaceToken> &tok,
-                               const std::vector<std::string> &tokens,
+                               const std::vector<std::string_view> &tokens,
                                size_t &cur);
   static bool parseCarpKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                const std::vector<std::string> &tokens,
+                                const std::vector<std::string_view> &tokens,
                                 size_t &cur);
   static bool parseVxlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                 const std::vector<std::string> &tokens,
+                                 const std::vector<std::string_view> &tokens,
                                  size_t &cur);
   static bool parseWlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                const std::vector<std::string> &tokens,
+                                const std::vector<std::string_view> &tokens,
                                 size_t &cur);
-  static bool parseWireGuardKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                     const std::vector<std::string> &tokens,
-                                     size_t &cur);
+  static bool parseWireGuardKeywords(
+      std::shared_ptr<InterfaceToken> &tok,
+      const std::vector<std::string_view> &tokens, size_t &cur);
   static bool parseTapKeywords(std::shared_ptr<InterfaceToken> &tok,
-                               const std::vector<std::string> &tokens,
+                               const std::vector<std::string_view> &tokens,
                                size_t &cur);
-  static bool parseSixToFourKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                     const std::vector<std::string> &tokens,
-                                     size_t &cur);
+  /// Keywords shared by tun and tap: queues, owner, owner-group, vnet-hdr.
+  static bool parseTunTapKeywords(std::shared_ptr<InterfaceToken> &tok,
+                                  const std::vector<std::string_view> &tokens,
+                                  size_t &cur);
+  static bool parseSixToFourKeywords(
+      std::shared_ptr<InterfaceToken> &tok,
+      const std::vector<std::string_view> &tokens, size_t &cur);
   static bool parsePflogKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                 const std::vector<std::string> &tokens,
+                                 const std::vector<std::string_view> &tokens,
                                  size_t &cur);
   static bool parsePfsyncKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                  const std::vector<std::string> &tokens,
+                                  const std::vector<std::string_view> &tokens,
                                   size_t &cur);
   static bool parseEpairKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                 const std::vector<std::string> &tokens,
+                                 const std::vector<std::string_view> &tokens,
                                  size_t &cur);
   static bool parseLoopbackKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                    const std::vector<std::string> &tokens,
+                                    const std::vector<std::string_view> &tokens,
                                     size_t &cur);
 
   // Per-type autocompletion providers — return type-specific keywords when
@@ -235,6 +255,28 @@ protected:
   static std::vector<std::string> wlanCompletions(const std::string &prev);
   static std::vector<std::string> wireGuardCompletions(const std::string &prev);
   static std::vector<std::string> tapCompletions(const std::string &prev);
+  static std::vector<std::string> tunTapCompletions(const std::string &prev);
+
+  /// Render the tun/tap device options shared by TunInterfaceConfig and
+  /// TapInterfaceConfig. The kernel keeps no requested queue count, only
+  /// the multiqueue flag and the queues attached right now, so a device
+  /// read back as multiqueue is emitted with at least two queues.
+  template <typename Cfg>
+  static std::string tunTapOptionsString(const Cfg &c) {
+    std::string s;
+    if (c.queues && *c.queues > 1)
+      s += " queues " + std::to_string(*c.queues);
+    else if (c.multi_queue)
+      s += " queues " +
+           std::to_string(std::max(c.attached_queues.value_or(0), 2));
+    if (c.owner)
+      s += " owner " + *c.owner;
+    if (c.owner_group)
+      s += " owner-group " + *c.owner_group;
+    if (c.vnet_hdr && *c.vnet_hdr)
+      s += " vnet-hdr";
+    return s;
+  }
   static std::vector<std::string> sixToFourCompletions(const std::string &prev);
   static std::vector<std::string> pflogCompletions(const std::string &prev);
   static std::vector<std::string> pfsyncCompletions(const std::string &prev);
@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include "KeywordTrie.hpp"
 #include <string>
+#include <string_view>
 
 /**
  * @brief Network interface types
@@ -132,46 +134,35 @@ inline std::string interfaceTypeToString(InterfaceType t) {
   }
 }
 
-inline InterfaceType interfaceTypeFromString(const std::string &s) {
-  if (s == "ethernet")
-    return InterfaceType::Ethernet;
-  if (s == "lo")
-    return InterfaceType::Loopback;
-  if (s == "ppp")
-    return InterfaceType::PPP;
-  if (s == "bridge")
-    return InterfaceType::Bridge;
-  if (s == "vlan")
-    return InterfaceType::VLAN;
-  if (s == "lagg")
-    return InterfaceType::Lagg;
-  if (s == "gif")
-    return InterfaceType::Gif;
-  if (s == "tun")
-    return InterfaceType::Tun;
-  if (s == "gre")
-    return InterfaceType::GRE;
-  if (s == "vxlan")
-    return InterfaceType::VXLAN;
-  if (s == "epair")
-    return InterfaceType::Epair;
-  if (s == "carp")
-    return InterfaceType::Carp;
-  if (s == "tap")
-    return InterfaceType::Tap;
-  if (s == "stf")
-    return InterfaceType::SixToFour;
-  if (s == "ovpn")
-    return InterfaceType::Ovpn;
-  if (s == "pflog")
-    return InterfaceType::Pflog;
-  if (s == "pfsync")
-    return InterfaceType::Pfsync;
-  if (s == "wg")
-    return InterfaceType::WireGuard;
-  if (s == "enc")
-    return InterfaceType::Enc;
-  if (s == "wlan")
-    return InterfaceType::Wireless;
-  return InterfaceType::Unknown;
+/// CLI type keywords and the interface types they name. Used both to parse
+/// `type <keyword>` and to complete it.
+inline const KeywordTrie<InterfaceType> &interfaceTypeKeywords() {
+  static const KeywordTrie<InterfaceType> trie{
+      {"ethernet", InterfaceType::Ethernet},
+      {"lo", InterfaceType::Loopback},
+      {"ppp", InterfaceType::PPP},
+      {"bridge", InterfaceType::Bridge},
+      {"vlan", InterfaceType::VLAN},
+      {"lagg", InterfaceType::Lagg},
+      {"gif", InterfaceType::Gif},
+      {"tun", InterfaceType::Tun},
+      {"gre", InterfaceType::GRE},
+      {"vxlan", InterfaceType::VXLAN},
+      {"epair", InterfaceType::Epair},
+      {"carp", InterfaceType::Carp},
+      {"tap", InterfaceType::Tap},
+      {"stf", InterfaceType::SixToFour},
+      {"ovpn", InterfaceType::Ovpn},
+      {"pflog", InterfaceType::Pflog},
+      {"pfsync", InterfaceType::Pfsync},
+      {"wg", InterfaceType::WireGuard},
+      {"enc", InterfaceType::Enc},
+      {"wlan", InterfaceType::Wireless},
+  };
+  return trie;
+}
+
+inline InterfaceType interfaceTypeFromString(std::string_view s) {
+  const InterfaceType *t = interfaceTypeKeywords().find(s);
+  return t ? *t : InterfaceType::Unknown;
 }
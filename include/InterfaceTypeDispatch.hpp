@@ -40,6 +40,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class InterfaceToken;
@@ -57,7 +58,8 @@ struct InterfaceTypeDispatch {
 
   /// Parser for type-specific keyword arguments.
   using ParseKeywordsFn = bool (*)(std::shared_ptr<InterfaceToken> &,
-                                   const std::vector<std::string> &, size_t &);
+                                   const std::vector<std::string_view> &,
+                                   size_t &);
 
   /// Execute 'set interface … type X' — builds type config and saves.
   using SetFn = void (*)(const InterfaceToken &, ConfigurationManager *,
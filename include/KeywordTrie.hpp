@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file KeywordTrie.hpp
+ * @brief Keyword table compiled into a character trie
+ *
+ * The parser's keyword tables (verbs, nouns, interface types, interface
+ * keywords) are written as plain {keyword, value} lists and compiled once
+ * into a trie. Looking a word up walks one node per character. Completing
+ * a partial word walks to the node for the prefix and returns every
+ * keyword below it, in table order. Parsing and tab completion therefore
+ * read the same table.
+ *
+ * Entries marked hidden (aliases such as "routes" for "route") are found
+ * by find() but are not offered by complete(). Keywords are kept as
+ * string_views, so tables are built from string literals.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+template <typename V = bool> class KeywordTrie {
+public:
+  struct Entry {
+    std::string_view keyword;
+    V value{};
+    bool hidden = false;
+  };
+
+  KeywordTrie(std::initializer_list<Entry> entries) {
+    for (const auto &e : entries)
+      insert(e);
+  }
+
+  /// Keyword-only table, for plain completion lists.
+  KeywordTrie(std::initializer_list<std::string_view> keywords) {
+    for (auto k : keywords)
+      insert(Entry{k});
+  }
+
+  /// Value stored for exactly `word`, or nullptr.
+  const V *find(std::string_view word) const {
+    uint32_t n = walk(word);
+    if (n == kNoNode || nodes_[n].entry == kNoEntry)
+      return nullptr;
+    return &entries_[nodes_[n].entry].value;
+  }
+
+  bool contains(std::string_view word) const { return find(word); }
+
+  /// Visible keywords starting with `partial`, in table order.
+  std::vector<std::string> complete(std::string_view partial) const {
+    std::vector<std::string> out;
+    uint32_t n = walk(partial);
+    if (n == kNoNode)
+      return out;
+    std::vector<uint32_t> hits;
+    collect(n, hits);
+    std::sort(hits.begin(), hits.end());
+    for (uint32_t e : hits)
+      if (!entries_[e].hidden)
+        out.emplace_back(entries_[e].keyword);
+    return out;
+  }
+
+private:
+  static constexpr uint32_t kNoNode = UINT32_MAX;
+  static constexpr uint32_t kNoEntry = UINT32_MAX;
+
+  struct Node {
+    std::vector<std::pair<char, uint32_t>> children;
+    uint32_t entry = kNoEntry;
+  };
+
+  void insert(const Entry &e) {
+    uint32_t n = 0;
+    for (char c : e.keyword) {
+      uint32_t next = child(n, c);
+      if (next == kNoNode) {
+        next = static_cast<uint32_t>(nodes_.size());
+        nodes_[n].children.emplace_back(c, next);
+        nodes_.emplace_back();
+      }
+      n = next;
+    }
+    if (nodes_[n].entry == kNoEntry) {
+      nodes_[n].entry = static_cast<uint32_t>(entries_.size());
+      entries_.push_back(e);
+    }
+  }
+
+  uint32_t child(uint32_t n, char c) const {
+    for (const auto &[ch, next] : nodes_[n].children)
+      if (ch == c)
+        return next;
+    return kNoNode;
+  }
+
+  uint32_t walk(std::string_view s) const {
+    uint32_t n = 0;
+    for (char c : s) {
+      n = child(n, c);
+      if (n == kNoNode)
+        break;
+    }
+    return n;
+  }
+
+  void collect(uint32_t n, std::vector<uint32_t> &out) const {
+    if (nodes_[n].entry != kNoEntry)
+      out.push_back(nodes_[n].entry);
+    for (const auto &[ch, next] : nodes_[n].children)
+      collect(next, out);
+  }
+
+  std::vector<Node> nodes_{1};
+  std::vector<Entry> entries_;
+};
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "ConfigData.hpp"
+#include "IPPrefix.hpp"
 #include <optional>
 #include <string>
 // Avoid pulling system/FreeBSD headers into this public header.
@@ -42,7 +43,7 @@
 
 class NdpConfig : public ConfigData {
 public:
-  std::string ip;                   // IPv6 address
+  IPPrefix ip;                      // IPv6 address (host prefix)
   std::string mac;                  // MAC address
   std::optional<std::string> iface; // Interface name
   std::optional<int> expire;        // Expiration time
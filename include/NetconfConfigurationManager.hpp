@@ -45,8 +45,10 @@
 #include "GreInterfaceConfig.hpp"
 #include "IpsecInterfaceConfig.hpp"
 #include "LaggInterfaceConfig.hpp"
+#include "NexthopGroupConfig.hpp"
 #include "OvpnInterfaceConfig.hpp"
 #include "PolicyConfig.hpp"
+#include "TapInterfaceConfig.hpp"
 #include "TunInterfaceConfig.hpp"
 #include "VlanInterfaceConfig.hpp"
 #include "VxlanInterfaceConfig.hpp"
@@ -77,6 +79,8 @@ class NetconfConfigurationManager : public ConfigurationManager {
 
   std::vector<TunInterfaceConfig>
   GetTunInterfaces(const std::vector<InterfaceConfig> &bases) const override;
+  std::vector<TapInterfaceConfig>
+  GetTapInterfaces(const std::vector<InterfaceConfig> &bases) const override;
   std::vector<GifInterfaceConfig>
   GetGifInterfaces(const std::vector<InterfaceConfig> &bases) const override;
   std::vector<OvpnInterfaceConfig>
@@ -198,6 +202,11 @@ class NetconfConfigurationManager : public ConfigurationManager {
   void AddRoute(const RouteConfig &route) const override;
   void DeleteRoute(const RouteConfig &route) const override;
 
+  // Nexthop groups
+  std::vector<NexthopGroupConfig> GetNexthopGroups() const override;
+  void SetNexthopGroup(const NexthopGroupConfig &group) const override;
+  void DeleteNexthopGroup(const NexthopGroupConfig &group) const override;
+
   // Epair
   void CreateEpair(const std::string &name) const override;
   void SaveEpair(const EpairInterfaceConfig &epair) const override;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file NexthopGroupConfig.hpp
+ * @brief Shared nexthop group configuration
+ *
+ * A nexthop group is a named set of gateways that routes reference by
+ * name instead of carrying their own next-hop. Changing the group's
+ * membership updates every route that points at it in one operation.
+ *
+ * Syntax: set nexthop-group <NAME> nexthop <IP> [interface <IF>]
+ *             [weight <1-256>] [nexthop <IP> ...]
+ */
+
+#pragma once
+
+#include "ConfigData.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A single gateway inside a nexthop group
+ */
+struct NexthopGroupMember {
+  std::string gateway;              ///< Gateway IP address
+  std::optional<std::string> iface; ///< Outgoing interface name
+  uint16_t weight = 1;              ///< Relative weight (1-256)
+};
+
+/**
+ * @brief Configuration for a named nexthop group
+ */
+class NexthopGroupConfig : public ConfigData {
+public:
+  std::string name;                        ///< Group name
+  std::optional<uint32_t> id;              ///< Kernel object id if known
+  std::vector<NexthopGroupMember> members; ///< Gateways in the group
+
+  /**
+   * @brief Derive a stable kernel object id from a group name
+   *
+   * Numeric names are used verbatim so operators can line groups up with
+   * ids chosen by other tools, and so that groups read back from a kernel
+   * which does not store names round-trip. Other names are hashed into
+   * [0x10000000, 0x3fffffff].
+   */
+  static uint32_t idFromName(const std::string &name);
+
+  /// True when two group names refer to the same kernel object, e.g.
+  /// "core" and the id a backend without names reports it under.
+  static bool sameId(const std::string &a, const std::string &b) {
+    return a == b || idFromName(a) == idFromName(b);
+  }
+
+  void save(ConfigurationManager &mgr) const override;
+  void destroy(ConfigurationManager &mgr) const override;
+};
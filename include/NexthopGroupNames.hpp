@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file NexthopGroupNames.hpp
+ * @brief Names of the nexthop groups this host has created
+ *
+ * The Linux kernel keeps nexthop objects by id only. Group names are
+ * hashed into ids (NexthopGroupConfig::idFromName), so an id cannot be
+ * turned back into its name. SetNexthopGroup records one "<id> <name>"
+ * line per group in a small file under /var/run; the name runs to the
+ * end of the line, so it may hold spaces. Reads use it to report groups
+ * and group routes under the names they were created with. /var/run is
+ * cleared at boot, as the kernel objects are.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+
+class NexthopGroupNames {
+public:
+  static constexpr const char *kDefaultPath =
+      "/var/run/stelleri/nexthop-groups";
+
+  /// Load the map at `path`; a missing or unreadable file is empty.
+  explicit NexthopGroupNames(std::string path = kDefaultPath);
+
+  /// Name recorded for `id`, or the id in decimal when there is none.
+  std::string name(uint32_t id) const;
+
+  /// Record `name` for `id` and rewrite the file. Numeric names map to
+  /// themselves and are not stored, nor are names holding a newline.
+  void set(uint32_t id, std::string_view name);
+  /// Forget `id` and rewrite the file.
+  void erase(uint32_t id);
+
+private:
+  void save() const;
+
+  std::string path_;
+  std::map<uint32_t, std::string> names_;
+};
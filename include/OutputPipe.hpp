@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file OutputPipe.hpp
+ * @brief JunOS-style output pipes for show commands
+ *
+ * A command line may end in one or more pipes:
+ *
+ *   show route | match 10.1. | count
+ *
+ * The CLI splits the pipes off before parsing and installs an OutputPipe
+ * as std::cout's buffer while the command runs. The pipe cuts what is
+ * written into lines and passes each one through its stages in order, so
+ * a formatter that writes row by row never has its whole table held here.
+ * Only the current line is buffered (columns also holds the line before,
+ * to find a table's header). Stages:
+ *
+ *   match REGEX      keep lines matching REGEX
+ *   except REGEX     drop lines matching REGEX
+ *   begin REGEX      drop lines before the first match (alias: find)
+ *   count            print "Count: N lines" instead of the lines
+ *   columns NAME[,NAME...]
+ *                    keep the named table columns
+ *   no-more          do not page the output
+ *
+ * Regexes are ECMAScript and are matched against the text with colour
+ * escapes removed. Interactive sessions page the output to the terminal
+ * height unless no-more is given.
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class OutputPipe : public std::streambuf {
+public:
+  /// One filter in the chain; defined in OutputPipe.cpp.
+  class Stage;
+
+  /// Split `line` at unquoted '|'. Returns the command and appends each
+  /// pipe's text (trimmed) to `pipes`.
+  static std::string_view split(std::string_view line,
+                                std::vector<std::string_view> &pipes);
+
+  /// Stage names starting with `partial`, for tab completion.
+  static std::vector<std::string> completeStage(std::string_view partial);
+
+  /// Forward filtered lines to `out`.
+  explicit OutputPipe(std::streambuf *out);
+  ~OutputPipe() override;
+
+  OutputPipe(const OutputPipe &) = delete;
+  OutputPipe &operator=(const OutputPipe &) = delete;
+
+  /// Parse one pipe ("match 10.1.") and append its stage. Throws
+  /// std::invalid_argument for unknown stages or bad arguments.
+  void addStage(std::string_view spec);
+
+  /// Page the output after `rows` terminal rows (0 disables paging).
+  /// A no-more stage overrides this.
+  void setPager(unsigned rows) { pagerRows_ = rows; }
+
+  /// Flush the last partial line and let the stages emit their totals.
+  void finish();
+
+protected:
+  int_type overflow(int_type ch) override;
+  std::streamsize xsputn(const char *s, std::streamsize n) override;
+  int sync() override;
+
+private:
+  void feed(std::string_view text);
+  /// Pass `text` through stages [from, end) and emit what survives.
+  void process(std::string &text, size_t from);
+  void emit(const std::string &text);
+  bool prompt();
+
+  std::streambuf *out_;
+  std::vector<std::unique_ptr<Stage>> stages_;
+  std::string pending_; ///< text after the last newline
+  std::string scratch_; ///< line being passed through the stages
+  unsigned pagerRows_ = 0;
+  bool noMore_ = false;
+  unsigned shown_ = 0; ///< lines shown since the last pager prompt
+  bool quit_ = false;  ///< the user quit the pager; drop the rest
+  bool finished_ = false;
+};
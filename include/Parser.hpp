@@ -35,6 +35,7 @@
 #include "Command.hpp"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace netcli {
@@ -44,12 +45,25 @@ namespace netcli {
     Parser() = default;
     ~Parser() = default;
 
-    // Tokenize a raw command line into space-separated tokens.
-    std::vector<std::string> tokenize(const std::string &line) const;
+    // Tokenize a raw command line into whitespace-separated tokens in a
+    // single pass. Single quotes keep their contents literally; double
+    // quotes and a bare backslash escape the next character, so a value
+    // such as a description can contain spaces. Tokens are views into
+    // `line`, except tokens that needed unescaping, which are views into
+    // `scratch`. Both must outlive the returned tokens. `scratch` is
+    // reserved once to the line length, so it never reallocates under
+    // the views already handed out.
+    std::vector<std::string_view> tokenize(std::string_view line,
+                                           std::string &scratch) const;
 
     // Parse a token vector into a Command. Returns nullptr on parse error.
     std::unique_ptr<Command>
-    parse(const std::vector<std::string> &tokens) const;
+    parse(const std::vector<std::string_view> &tokens) const;
+
+    // Completions for the verb (show/set/delete) and for the noun that
+    // follows it, read from the same keyword tables parse() dispatches on.
+    static std::vector<std::string> completeVerb(std::string_view partial);
+    static std::vector<std::string> completeNoun(std::string_view partial);
   };
 
 } // namespace netcli
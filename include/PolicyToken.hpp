@@ -43,10 +43,16 @@ public:
   PolicyToken() = default;
 
   std::vector<std::string> autoComplete(std::string_view) const override;
+  std::vector<std::string>
+  autoComplete(const std::vector<std::string> &tokens, std::string_view partial,
+               const CompletionCache *cache) const override;
+
+  TokenKind kind() const override { return TokenKind::Policy; }
+
   std::unique_ptr<Token> clone() const override;
 
   static std::shared_ptr<PolicyToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
   // ── Parsed fields ──────────────────────────────────────────────────
@@ -70,6 +76,6 @@ public:
 
 private:
   // Parse access-list sub-tokens starting at position i
-  static void parseAccessList(const std::vector<std::string> &tokens, size_t &i,
-                              std::shared_ptr<PolicyToken> &tok);
+  static void parseAccessList(const std::vector<std::string_view> &tokens,
+                              size_t &i, std::shared_ptr<PolicyToken> &tok);
 };
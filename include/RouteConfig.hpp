@@ -33,6 +33,7 @@
 #pragma once
 
 #include "ConfigData.hpp"
+#include "IPPrefix.hpp"
 #include <optional>
 #include <string>
 
@@ -41,9 +42,12 @@
  */
 class RouteConfig : public ConfigData {
 public:
-  std::string prefix;                 ///< Destination prefix in CIDR notation
-  std::optional<std::string> nexthop; ///< Next-hop IP address
+  IPPrefix prefix;                    ///< Destination prefix
+  std::optional<IPPrefix> nexthop;    ///< Next-hop IP address (host prefix)
+  std::optional<int> gateway_link;    ///< AF_LINK gateway ifindex (link#N)
   std::optional<std::string> iface;   ///< Outgoing interface name
+  std::optional<std::string>
+      nexthop_group;      ///< Shared nexthop group (instead of nexthop)
   std::optional<int> vrf;             ///< VRF table ID for route
   bool blackhole = false;             ///< Blackhole route (drop packets)
   bool reject = false;                ///< Reject route (send ICMP unreachable)
@@ -122,6 +126,7 @@ public:
   unsigned long rmx_pksent = 0;
 
   // Raw routing message provenance
+  std::optional<int> protocol; ///< rtm_protocol (Linux): who installed it
   std::optional<int> rtm_type;
   std::optional<int> rtm_pid;
   std::optional<int> rtm_seq;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file RouteDiff.hpp
+ * @brief Minimal add/replace/delete sets between desired and live routes
+ *
+ * Both sides are sorted by a binary (table, prefix, nexthop) key and merged
+ * in one pass. The live side stays in its columnar RouteTable; only rows
+ * that end up in a replace or remove set are expanded to RouteConfig.
+ * Within a (table, prefix) group, entries with the same nexthop pair up
+ * first; leftovers pair up as replacements (e.g. a changed gateway) and
+ * anything still unmatched becomes an add or a delete.
+ *
+ * Only static live routes that carry a gateway, nexthop group or
+ * blackhole/reject action are deleted or re-pointed to another nexthop:
+ * those with rtm_protocol static or boot (what netlink and SIOCADDRT
+ * install), or with RTF_STATIC where no protocol is reported. Interface
+ * (connected) routes and routes from DHCP, router advertisements or
+ * routing daemons are left alone.
+ */
+
+#pragma once
+
+#include "RouteConfig.hpp"
+#include "RouteTable.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+struct RouteDiff {
+  std::vector<RouteConfig> add;
+  /// (live, desired) pairs for the same table and prefix
+  std::vector<std::pair<RouteConfig, RouteConfig>> replace;
+  std::vector<RouteConfig> remove;
+  size_t unchanged = 0;
+
+  bool empty() const {
+    return add.empty() && replace.empty() && remove.empty();
+  }
+
+  /**
+   * @brief Compute the changes that turn `current` into `desired`
+   *
+   * Attributes absent from a desired route (e.g. no interface given) are
+   * not compared, so a route that only differs in kernel-filled fields
+   * counts as unchanged.
+   */
+  static RouteDiff compute(std::vector<RouteConfig> desired,
+                           const RouteTable &current);
+};
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file RouteLookupTable.hpp
+ * @brief Longest-prefix-match lookup over a route dump
+ *
+ * Routes are compiled into one Poptrie-style trie per address family. The
+ * first 18 address bits index a direct-pointing table (262144 entries,
+ * 1 MiB per family); below that each node consumes 6 bits and holds two
+ * 64-bit maps, one marking slots that descend to a child and one marking
+ * where a new run of identical leaf results starts. Children and leaves of a node are stored contiguously,
+ * so a step is a popcount plus one array index, and an IPv4 lookup
+ * touches the direct table and at most three nodes. Results are
+ * leaf-pushed at build time; the table is immutable once built.
+ */
+
+#pragma once
+
+#include "IPPrefix.hpp"
+#include "RouteConfig.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief One answered lookup: the queried address and the matching route
+ * (nullptr when nothing matched)
+ */
+struct RouteLookupResult {
+  IPPrefix address;
+  const RouteConfig *route = nullptr;
+};
+
+class RouteLookupTable {
+public:
+  RouteLookupTable() = default;
+  explicit RouteLookupTable(std::vector<RouteConfig> routes);
+
+  /**
+   * @brief Longest-prefix match for an address
+   *
+   * Only the address part of `addr` is used. When several routes share
+   * the best prefix, an UP route is preferred over one that is not,
+   * otherwise the first one in the dump wins. Returns nullptr when no
+   * route (not even a default) covers the address.
+   */
+  const RouteConfig *lookup(const IPPrefix &addr) const;
+
+  const std::vector<RouteConfig> &routes() const { return routes_; }
+
+  /// Compiled trie nodes (IPv4 + IPv6), for diagnostics.
+  size_t nodeCount() const { return v4_.nodes.size() + v6_.nodes.size(); }
+
+  struct Node {
+    uint64_t vector = 0;  ///< Slots that descend to a child node
+    uint64_t leafvec = 0; ///< Slots that start a new leaf run
+    uint32_t base0 = 0;   ///< First leaf of this node in `leaves`
+    uint32_t base1 = 0;   ///< First child of this node in `nodes`
+  };
+
+  struct Trie {
+    /// Indexed by the top 18 address bits: route index + 1 (0 = no
+    /// route), or a node index with the high bit set.
+    std::vector<uint32_t> direct;
+    std::vector<Node> nodes;
+    std::vector<uint32_t> leaves; ///< Route index + 1, 0 = no route
+  };
+
+private:
+  std::vector<RouteConfig> routes_;
+  Trie v4_;
+  Trie v6_;
+};
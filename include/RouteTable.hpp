@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file RouteTable.hpp
+ * @brief Columnar in-memory route table
+ *
+ * RouteConfig carries every field a routing socket can report. Most of
+ * those fields are strings and optionals that are empty for nearly every
+ * route. A RouteTable keeps a dump as parallel arrays instead. Each row
+ * holds the binary destination, prefix length, table, flags, protocol,
+ * nexthop id, interface id and MTU, about 44 bytes a route, so a million
+ * routes fit in roughly 45 MB.
+ *
+ * Nexthop addresses are pooled, and interfaces are InterfaceNames ids.
+ * The rare fields live in a side array that only rows carrying them
+ * reference: nexthop group, link gateway, scope, author, link-layer
+ * gateway, the other rmx_* metrics, and so on. The strings among them
+ * share a small pool. Of the rtm_* provenance fields only the protocol is
+ * kept; the diff engine uses it to tell its own routes from others.
+ *
+ * at() rebuilds a RouteConfig for one row. Code that needs the full
+ * struct for a single route still gets it, for example a diff result or
+ * a command line.
+ */
+
+#pragma once
+
+#include "IPPrefix.hpp"
+#include "InterfaceNames.hpp"
+#include "RouteConfig.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class RouteTable {
+public:
+  RouteTable() = default;
+  explicit RouteTable(const std::vector<RouteConfig> &routes);
+
+  size_t size() const { return length_.size(); }
+  bool empty() const { return length_.empty(); }
+  void reserve(size_t n);
+
+  /// Append a row holding only `prefix`; returns its index. The set*
+  /// calls below fill in the remaining columns.
+  size_t append(const IPPrefix &prefix);
+  /// Append a full route; returns its index.
+  size_t push_back(const RouteConfig &rc);
+  /// Append row `row` of `other`; returns its index.
+  size_t push_back(const RouteTable &other, size_t row);
+  /// Replace row `row` with `rc`.
+  void assign(size_t row, const RouteConfig &rc);
+
+  void setNexthop(size_t row, const std::optional<IPPrefix> &nexthop);
+  void setInterface(size_t row, std::string_view name);
+  void setVrf(size_t row, std::optional<int> vrf);
+  void setFlags(size_t row, unsigned flags) { flags_[row] = flags; }
+  void setMtu(size_t row, uint32_t mtu) { mtu_[row] = mtu; }
+  void setProtocol(size_t row, std::optional<int> protocol) {
+    protocol_[row] = static_cast<uint8_t>(protocol.value_or(0));
+  }
+  void setNexthopGroup(size_t row, std::string_view group);
+
+  // ── Column access ─────────────────────────────────────────────────
+
+  IPPrefix prefix(size_t row) const;
+  std::optional<IPPrefix> nexthop(size_t row) const;
+  /// VRF table id, 0 for the main table.
+  int table(size_t row) const { return table_[row]; }
+  std::optional<int> vrf(size_t row) const;
+  unsigned flags(size_t row) const { return flags_[row]; }
+  bool blackhole(size_t row) const { return bits_[row] & kBlackhole; }
+  bool reject(size_t row) const { return bits_[row] & kReject; }
+  uint32_t mtu(size_t row) const { return mtu_[row]; }
+  /// rtm_protocol, unset where the platform does not report one.
+  std::optional<int> protocol(size_t row) const {
+    if (protocol_[row] == 0)
+      return std::nullopt;
+    return protocol_[row];
+  }
+  /// Interface id, InterfaceNames::kNone when the route has none.
+  InterfaceId interface(size_t row) const { return iface_[row]; }
+
+  // Rare fields; unset for rows without them.
+  std::optional<std::string_view> nexthopGroup(size_t row) const;
+  std::optional<int> gatewayLink(size_t row) const;
+  std::optional<std::string_view> scope(size_t row) const;
+  std::optional<std::string_view> author(size_t row) const;
+  std::optional<int> expire(size_t row) const;
+
+  /// The full RouteConfig for one row (of rtm_*, only the protocol).
+  RouteConfig at(size_t row) const;
+  std::vector<RouteConfig> toVector() const;
+
+  /// Bytes held by the columns, pools and side array.
+  size_t memoryUsage() const;
+
+private:
+  static constexpr uint8_t kHasVrf = 0x1;
+  static constexpr uint8_t kBlackhole = 0x2;
+  static constexpr uint8_t kReject = 0x4;
+
+  /// Fields set on few routes. String members are pool ids (0 = unset).
+  struct Extra {
+    uint32_t nexthopGroup = 0;
+    uint32_t scope = 0;
+    uint32_t ifa = 0;
+    uint32_t ifp = 0;
+    uint32_t gatewayHw = 0;
+    uint32_t author = 0;
+    uint32_t brd = 0;
+    std::optional<int> gatewayLink;
+    std::optional<int> expire;
+    std::optional<int> ifaceIndex;
+    std::array<unsigned long, 7> rmx{}; ///< hopcount .. pksent
+  };
+
+  Extra *extra(size_t row);
+  const Extra *extra(size_t row) const;
+  Extra &ensureExtra(size_t row);
+  uint32_t intern(std::string_view s);
+  uint32_t internOptional(const std::optional<std::string> &s);
+  std::optional<std::string_view> lookup(uint32_t id) const;
+
+  // One entry per row.
+  std::vector<std::array<uint8_t, 16>> dst_;
+  std::vector<uint8_t> family_; ///< 4, 6 or 0
+  std::vector<uint8_t> length_;
+  std::vector<uint8_t> bits_;
+  std::vector<uint8_t> protocol_; ///< 0 (RTPROT_UNSPEC) when unknown
+  std::vector<int32_t> table_;
+  std::vector<uint32_t> flags_;
+  std::vector<uint32_t> nexthop_; ///< 1-based index into nexthops_
+  std::vector<InterfaceId> iface_;
+  std::vector<uint32_t> mtu_;
+  std::vector<uint32_t> extra_; ///< 1-based index into extras_
+
+  // Shared pools.
+  std::vector<IPPrefix> nexthops_;
+  std::unordered_map<IPPrefix, uint32_t> nexthopIds_;
+  std::vector<Extra> extras_;
+  std::vector<std::string> strings_;
+  std::unordered_map<std::string, uint32_t> stringIds_;
+};
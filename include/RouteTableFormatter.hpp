@@ -33,7 +33,9 @@
 #pragma once
 
 #include "RouteConfig.hpp"
+#include "RouteTable.hpp"
 #include "TableFormatter.hpp"
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -43,4 +45,14 @@ public:
 
   // Format routes as ASCII table
   std::string format(const std::vector<RouteConfig> &routes) override;
+  // Same, straight from the columnar table (no RouteConfig per row)
+  std::string format(const RouteTable &routes);
+  // Same, written to `out` row by row instead of built as one string
+  void format(const RouteTable &routes, std::ostream &out);
+
+  // Gateway column text: next-hop, link#N, group name or "-"
+  static std::string gatewayString(const RouteConfig &route);
+  // Flags column text in netstat order (U G H S B R)
+  static std::string flagsString(const RouteConfig &route);
+  static std::string flagsString(unsigned flags, bool blackhole, bool reject);
 };
@@ -36,6 +36,7 @@
 #include "IPAddress.hpp"
 #include "IPNetwork.hpp"
 #include "InterfaceToken.hpp"
+#include "NexthopGroupConfig.hpp"
 #include "RouteConfig.hpp"
 #include "Token.hpp"
 #include "VRFToken.hpp"
@@ -50,6 +51,12 @@ public:
   explicit RouteToken(std::string prefix);
 
   std::vector<std::string> autoComplete(std::string_view) const override;
+  std::vector<std::string>
+  autoComplete(const std::vector<std::string> &tokens, std::string_view partial,
+               const CompletionCache *cache) const override;
+
+  TokenKind kind() const override { return TokenKind::Route; }
+
   std::unique_ptr<Token> clone() const override;
 
   const std::string &prefix() const { return prefix_; }
@@ -59,12 +66,28 @@ public:
       vrf;                // only the id/name is completable in this context
   bool blackhole = false; // Kept for backward compatibility
   bool reject = false;    // Kept for backward compatibility
+  std::optional<std::string> nexthop_group; // route via a shared group
+
+  // Set when the command targets `nexthop-group [NAME]` rather than a
+  // route; empty for `show nexthop-group` without a name.
+  std::optional<std::string> group_name;
+  std::vector<NexthopGroupMember> group_members;
+  bool isNexthopGroup() const { return group_name.has_value(); }
+
+  // `show route lookup <addr>` / `show route lookup file <path>`
+  std::optional<std::string> lookup_address;
+  std::optional<std::string> lookup_file;
+  bool isLookup() const { return lookup_address || lookup_file; }
 
   void debugOutput(std::ostream &os) const;
 
+  // Build the RouteConfig this token describes; nullopt when the
+  // destination prefix is missing or malformed.
+  std::optional<RouteConfig> toConfig() const;
+
   // Parse route tokens starting at `start` and return a RouteToken
   static std::shared_ptr<RouteToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
   // (Rendering moved to execute handlers; token is parse-only.)
@@ -72,9 +95,18 @@ public:
 private:
   std::string prefix_;
 
+  static std::shared_ptr<RouteToken>
+  parseNexthopGroup(const std::vector<std::string_view> &tokens, size_t start,
+                    size_t &next);
+
 public:
   /**
    * @brief Render a RouteConfig to a command string
    */
   static std::string toString(RouteConfig *cfg);
+
+  /**
+   * @brief Render a NexthopGroupConfig to a command string
+   */
+  static std::string toString(NexthopGroupConfig *cfg);
 };
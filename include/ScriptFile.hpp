@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file ScriptFile.hpp
+ * @brief Parallel tokenize and parse of large configuration scripts
+ *
+ * Generated configurations for big routers run to hundreds of thousands
+ * of lines. A ScriptFile maps a regular file into memory (other inputs,
+ * such as stdin, are read into a buffer) and splits it at line boundaries
+ * into chunks. map() tokenizes and parses each chunk on a worker pool and
+ * runs the caller's per-line step there as well, for example validation.
+ * The per-chunk results are then joined in file order, so callers execute
+ * commands exactly as a line-by-line reader would.
+ */
+
+#pragma once
+
+#include "Parser.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace netcli {
+
+  class ScriptFile {
+  public:
+    /// Open @p file, or read stdin for "-". Throws std::runtime_error
+    /// when the file cannot be read.
+    explicit ScriptFile(const std::string &file);
+    ~ScriptFile();
+
+    ScriptFile(const ScriptFile &) = delete;
+    ScriptFile &operator=(const ScriptFile &) = delete;
+
+    std::string_view text() const { return text_; }
+
+    /// One non-blank line that is not a `#` comment.
+    struct Line {
+      size_t lineno;
+      std::string_view text; ///< without surrounding whitespace
+      std::vector<std::string_view> tokens; ///< valid only during fn
+      std::unique_ptr<Command> cmd; ///< null when the line does not parse
+      std::string error;            ///< what the parser threw, if anything
+    };
+
+    /// Tokenize and parse every line, then call fn(Line &) on it, on up to
+    /// @p threads workers (0: one per core). Returns fn's results in file
+    /// order. fn runs concurrently on different lines.
+    template <typename Fn>
+    std::vector<std::invoke_result_t<Fn &, Line &>>
+    map(Fn fn, unsigned threads = 0) const;
+
+  private:
+    struct Chunk {
+      std::string_view text;
+      size_t firstLine; ///< line number of the chunk's first line
+    };
+
+    std::vector<Chunk> split(unsigned threads) const;
+    template <typename Fn, typename R>
+    static void parseChunk(const Chunk &chunk, Fn &fn, std::vector<R> &out);
+
+    std::string buffer_; ///< input that could not be mapped
+    const char *map_ = nullptr;
+    size_t mapSize_ = 0;
+    std::string_view text_;
+  };
+
+  template <typename Fn, typename R>
+  void ScriptFile::parseChunk(const Chunk &chunk, Fn &fn,
+                              std::vector<R> &out) {
+    Parser parser;
+    std::string scratch;
+    std::string_view rest = chunk.text;
+    for (size_t lineno = chunk.firstLine; !rest.empty(); ++lineno) {
+      size_t nl = rest.find('\n');
+      std::string_view raw = rest.substr(0, nl);
+      rest.remove_prefix(nl == std::string_view::npos ? rest.size() : nl + 1);
+
+      size_t first = raw.find_first_not_of(" \t\r");
+      if (first == std::string_view::npos || raw[first] == '#')
+        continue;
+      Line line{lineno, raw.substr(first, raw.find_last_not_of(" \t\r") -
+                                              first + 1),
+                {}, nullptr, {}};
+      try {
+        line.tokens = parser.tokenize(raw, scratch);
+        line.cmd = parser.parse(line.tokens);
+      } catch (const std::exception &e) {
+        line.cmd.reset();
+        line.error = e.what();
+      }
+      out.push_back(fn(line));
+    }
+  }
+
+  template <typename Fn>
+  std::vector<std::invoke_result_t<Fn &, ScriptFile::Line &>>
+  ScriptFile::map(Fn fn, unsigned threads) const {
+    using R = std::invoke_result_t<Fn &, Line &>;
+    if (threads == 0)
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    auto chunks = split(threads);
+
+    std::vector<std::vector<R>> parts(chunks.size());
+    std::vector<std::exception_ptr> errors(chunks.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+      for (size_t i; (i = next.fetch_add(1)) < chunks.size();) {
+        try {
+          parseChunk(chunks[i], fn, parts[i]);
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      }
+    };
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < std::min<size_t>(threads, chunks.size()); ++i)
+      pool.emplace_back(worker);
+    worker();
+    for (auto &t : pool)
+      t.join();
+    for (auto &e : errors)
+      if (e)
+        std::rethrow_exception(e);
+
+    if (parts.size() == 1)
+      return std::move(parts[0]);
+    size_t total = 0;
+    for (const auto &p : parts)
+      total += p.size();
+    std::vector<R> out;
+    out.reserve(total);
+    for (auto &p : parts)
+      std::move(p.begin(), p.end(), std::back_inserter(out));
+    return out;
+  }
+
+} // namespace netcli
@@ -46,5 +46,7 @@ public:
 
   std::vector<std::string> autoComplete(std::string_view) const override;
 
+  TokenKind kind() const override { return TokenKind::Show; }
+
   std::unique_ptr<Token> clone() const override;
 };
@@ -32,22 +32,25 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace strutil {
 
-  /// Split a string into lines (at '\n' boundaries).
-  std::vector<std::string> splitLines(const std::string &s);
+  /// Split a string into lines (at '\n' boundaries). The views point into
+  /// `s`; an empty string yields one empty line.
+  void splitLines(std::string_view s, std::pmr::vector<std::string_view> &out);
 
   /// Return the visible length of a string, ignoring ANSI escape sequences.
-  int visibleLength(const std::string &s);
+  int visibleLength(std::string_view s);
 
   /// Truncate a string to at most `w` visible characters, preserving ANSI
   /// codes.
-  std::string truncateVisible(const std::string &s, int w);
+  std::string truncateVisible(std::string_view s, int w);
 
   /// Strip all ANSI escape sequences from a string, returning plain text.
-  std::string stripAnsi(const std::string &s);
+  std::string stripAnsi(std::string_view s);
 
 } // namespace strutil
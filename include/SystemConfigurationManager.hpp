@@ -38,6 +38,7 @@
  * in ConfigurationManager instead.
  */
 
+#include <map>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -50,6 +51,8 @@ class SystemConfigurationManager : public ConfigurationManager {
 public:
   ~SystemConfigurationManager() override = default;
 
+  bool SupportsConcurrentQueries() const override { return true; }
+
   // Enumeration / query API
   std::vector<InterfaceConfig> GetInterfaces(
       const std::optional<VRFConfig> &vrf = std::nullopt) const override;
@@ -65,6 +68,8 @@ public:
 
   std::vector<TunInterfaceConfig>
   GetTunInterfaces(const std::vector<InterfaceConfig> &bases) const override;
+  std::vector<TapInterfaceConfig>
+  GetTapInterfaces(const std::vector<InterfaceConfig> &bases) const override;
   std::vector<GifInterfaceConfig>
   GetGifInterfaces(const std::vector<InterfaceConfig> &bases) const override;
   std::vector<OvpnInterfaceConfig>
@@ -85,6 +90,8 @@ public:
       const std::optional<VRFConfig> &vrf = std::nullopt) const override;
   std::vector<RouteConfig>
   GetRoutes(const std::optional<VRFConfig> &vrf = std::nullopt) const override;
+  RouteTable GetRouteTable(
+      const std::optional<VRFConfig> &vrf = std::nullopt) const override;
   std::vector<VRFConfig> GetVrfs() const override;
 
   std::vector<ArpConfig>
@@ -184,8 +191,16 @@ public:
 
   // Routes
   void AddRoute(const RouteConfig &route) const override;
+  void AddRoutes(const std::vector<RouteConfig> &routes) const override;
+  void ReplaceRoute(const RouteConfig &was,
+                    const RouteConfig &want) const override;
   void DeleteRoute(const RouteConfig &route) const override;
 
+  // Nexthop groups
+  std::vector<NexthopGroupConfig> GetNexthopGroups() const override;
+  void SetNexthopGroup(const NexthopGroupConfig &group) const override;
+  void DeleteNexthopGroup(const NexthopGroupConfig &group) const override;
+
   // Epair
   void CreateEpair(const std::string &name) const override;
   void SaveEpair(const EpairInterfaceConfig &epair) const override;
@@ -226,5 +241,25 @@ public:
   void populateInterfaceMetadata(InterfaceConfig &ic) const;
   bool matches_vrf(const InterfaceConfig &ic,
                    const std::optional<VRFConfig> &vrf) const;
+
+  // tun/tap driver state from an RTM_GETLINK dump and the shared create/
+  // update path for both types (src/system/linux/SystemTun.cpp)
+  struct TunTapLink {
+    bool tap = false;
+    bool pi = false;
+    bool vnet_hdr = false;
+    bool multi_queue = false;
+    std::optional<std::string> owner;
+    std::optional<std::string> group;
+    int tx_queues = 0;
+    int rx_queues = 0;
+    int attached_queues = 0;
+  };
+  std::map<std::string, TunTapLink> query_tuntap_links() const;
+  void configureTunTap(const std::string &name, bool tap,
+                       const std::optional<int> &queues,
+                       const std::optional<std::string> &owner,
+                       const std::optional<std::string> &group,
+                       const std::optional<bool> &vnet_hdr) const;
 #endif
 };
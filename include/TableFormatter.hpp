@@ -32,9 +32,25 @@
 
 #pragma once
 
+#include <cstdint>
+#include <initializer_list>
+#include <memory_resource>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
+/**
+ * Cell text is stored in a per-formatter monotonic arena: a format pass
+ * adds thousands of cells and discards them all together, so the bytes are
+ * carved out of a few large blocks and released at once by clearTable() or
+ * the destructor instead of being freed one by one. Each cell's display
+ * width is measured once, when the row is added.
+ *
+ * renderTable() sorts a permutation of row indices, takes column widths
+ * from the measured cells, and writes the table to the stream in chunks,
+ * so a large table is never held a second time as text.
+ */
 template <typename T> class TableFormatter {
 public:
   struct Column {
@@ -56,27 +72,49 @@ protected:
   void addColumn(const std::string &key, const std::string &title,
                  int priority = 1, int minWidth = 3, bool leftAlign = true);
 
-  void addRow(const std::vector<std::string> &cells);
+  // Cells are copied into the arena; the arguments may be temporaries.
+  void addRow(std::initializer_list<std::string_view> cells);
 
   void setSortColumn(int index);
 
   // Render accumulated rows/columns as formatted table string
   std::string renderTable(int maxWidth = 80);
+  // Same, written to `out` in chunks as the rows are formatted
+  void renderTable(std::ostream &out, int maxWidth = 80);
 
-  // Clear accumulated rows and columns
+  // Clear accumulated rows and columns and release the arena
   void clearTable();
 
 private:
+  struct Cell {
+    const char *data = nullptr;
+    uint32_t size = 0;
+    uint32_t width : 31 = 0;    // widest line, in visible characters
+    uint32_t multiLine : 1 = 0; // contains '\n'
+
+    std::string_view text() const { return {data, size}; }
+  };
+
+  /// Output is handed to the stream in blocks of about this size.
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  const Cell &cell(size_t row, size_t col) const {
+    return cells_[row * columns_.size() + col];
+  }
+
   std::vector<Column> columns_;
-  std::vector<std::vector<std::string>> rows_;
+  std::pmr::monotonic_buffer_resource arena_{16 * 1024};
+  std::vector<Cell> cells_; // row-major, columns_.size() per row
   int sortColumn_ = 0;
 };
 
 // Template implementation
 #include "StringUtils.hpp"
 #include <algorithm>
-#include <cctype>
+#include <charconv>
+#include <cstring>
 #include <numeric>
+#include <optional>
 #include <sstream>
 
 template <typename T>
@@ -93,10 +131,30 @@ void TableFormatter<T>::addColumn(const std::string &key,
 }
 
 template <typename T>
-void TableFormatter<T>::addRow(const std::vector<std::string> &cells) {
+void TableFormatter<T>::addRow(std::initializer_list<std::string_view> cells) {
   if (cells.size() != columns_.size())
     return;
-  rows_.push_back(cells);
+  for (auto c : cells) {
+    Cell &cell = cells_.emplace_back();
+    if (c.empty())
+      continue;
+    char *p = static_cast<char *>(arena_.allocate(c.size(), 1));
+    std::memcpy(p, c.data(), c.size());
+    cell.data = p;
+    cell.size = static_cast<uint32_t>(c.size());
+    if (c.find('\n') == std::string_view::npos) {
+      cell.width = static_cast<uint32_t>(strutil::visibleLength(c));
+      continue;
+    }
+    cell.multiLine = 1;
+    int w = 0;
+    for (size_t start = 0; start <= c.size();) {
+      size_t nl = std::min(c.find('\n', start), c.size());
+      w = std::max(w, strutil::visibleLength(c.substr(start, nl - start)));
+      start = nl + 1;
+    }
+    cell.width = static_cast<uint32_t>(w);
+  }
 }
 
 template <typename T> void TableFormatter<T>::setSortColumn(int index) {
@@ -105,27 +163,36 @@ template <typename T> void TableFormatter<T>::setSortColumn(int index) {
 
 template <typename T> void TableFormatter<T>::clearTable() {
   columns_.clear();
-  rows_.clear();
+  cells_ = {};
+  arena_.release();
   sortColumn_ = 0;
 }
 
 template <typename T> std::string TableFormatter<T>::renderTable(int maxWidth) {
+  std::ostringstream oss;
+  renderTable(oss, maxWidth);
+  return oss.str();
+}
+
+template <typename T>
+void TableFormatter<T>::renderTable(std::ostream &out, int maxWidth) {
   if (columns_.empty())
-    return std::string();
+    return;
 
   const size_t ncol = columns_.size();
+  const size_t nrow = cells_.size() / ncol;
+
+  // Scratch space for this pass: row order, sort keys and split lines.
+  std::pmr::monotonic_buffer_resource scratch(16 * 1024);
 
   std::vector<int> widths(ncol, 0);
   for (size_t i = 0; i < ncol; ++i) {
     widths[i] = strutil::visibleLength(columns_[i].title);
   }
 
-  for (const auto &r : rows_) {
-    for (size_t i = 0; i < ncol; ++i) {
-      auto lines = strutil::splitLines(r[i]);
-      for (const auto &l : lines)
-        widths[i] = std::max(widths[i], strutil::visibleLength(l));
-    }
+  for (size_t r = 0; r < nrow; ++r) {
+    for (size_t i = 0; i < ncol; ++i)
+      widths[i] = std::max(widths[i], static_cast<int>(cell(r, i).width));
   }
 
   auto totalWidth = std::accumulate(widths.begin(), widths.end(), 0) +
@@ -156,112 +223,119 @@ template <typename T> std::string TableFormatter<T>::renderTable(int maxWidth) {
     }
   }
 
-  std::ostringstream oss;
+  // Lines are assembled here and handed to the stream a chunk at a time.
+  std::string buf;
+  buf.reserve(kChunkSize + 1024);
+  auto flush = [&](size_t atLeast) {
+    if (buf.size() >= atLeast) {
+      out.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+      buf.clear();
+    }
+  };
 
-  auto pad = [&](const std::string &s, int w, bool left) {
-    int vis = strutil::visibleLength(s);
-    if (vis >= w)
-      return strutil::truncateVisible(s, w);
-    int padlen = w - vis;
-    if (left) {
-      std::string out = s;
-      out.append(padlen, ' ');
-      return out;
-    } else {
-      std::string out(padlen, ' ');
-      out += s;
-      return out;
+  // `vis` is the visible width of `s`, when already known.
+  auto pad = [&](std::string_view s, int vis, int w, bool left) {
+    if (vis < 0)
+      vis = strutil::visibleLength(s);
+    if (vis >= w) {
+      if (vis == w)
+        buf += s;
+      else
+        buf += strutil::truncateVisible(s, w);
+      return;
     }
+    if (!left)
+      buf.append(static_cast<size_t>(w - vis), ' ');
+    buf += s;
+    if (left)
+      buf.append(static_cast<size_t>(w - vis), ' ');
   };
 
   for (size_t i = 0; i < ncol; ++i) {
     if (i)
-      oss << ' ';
-    oss << pad(columns_[i].title, widths[i], columns_[i].leftAlign);
+      buf += ' ';
+    pad(columns_[i].title, -1, widths[i], columns_[i].leftAlign);
   }
-  oss << '\n';
+  buf += '\n';
 
   for (size_t i = 0; i < ncol; ++i) {
     if (i)
-      oss << ' ';
-    oss << std::string(widths[i], '-');
+      buf += ' ';
+    buf.append(static_cast<size_t>(widths[i]), '-');
   }
-  oss << '\n';
+  buf += '\n';
 
-  std::vector<std::vector<std::string>> sorted_rows = rows_;
-  int sc = sortColumn_;
-  if (sc < 0 || sc >= static_cast<int>(ncol))
+  // Sort row indices rather than copies of the rows.
+  std::pmr::vector<size_t> order(nrow, &scratch);
+  std::iota(order.begin(), order.end(), size_t(0));
+  size_t sc = static_cast<size_t>(sortColumn_);
+  if (sortColumn_ < 0 || sc >= ncol)
     sc = 0;
 
-  bool isIndexColumn = (sc >= 0 && sc < static_cast<int>(columns_.size()) &&
-                        columns_[sc].key == "Index");
-
-  if (isIndexColumn) {
-    std::stable_sort(
-        sorted_rows.begin(), sorted_rows.end(),
-        [&](const std::vector<std::string> &a,
-            const std::vector<std::string> &b) {
-          const std::string &sa =
-              (sc < static_cast<int>(a.size())) ? a[sc] : std::string();
-          const std::string &sb =
-              (sc < static_cast<int>(b.size())) ? b[sc] : std::string();
-          auto parseInt = [](const std::string &s, long long &out) -> bool {
-            if (s.empty() || s == "-")
-              return false;
-            std::string clean = strutil::stripAnsi(s);
-            if (clean.empty() || clean == "-")
-              return false;
-            try {
-              size_t pos = 0;
-              out = std::stoll(clean, &pos);
-              return pos == clean.size();
-            } catch (...) {
-              return false;
-            }
-          };
-          long long ia = 0, ib = 0;
-          bool ha = parseInt(sa, ia);
-          bool hb = parseInt(sb, ib);
-          if (ha && hb)
-            return ia < ib;
-          if (ha && !hb)
-            return true;
-          if (!ha && hb)
-            return false;
-          return sa < sb;
-        });
+  if (columns_[sc].key == "Index") {
+    // Numeric keys are parsed once per row; rows without one sort after
+    // the numbered ones, by text.
+    std::pmr::vector<std::optional<long long>> keys(&scratch);
+    keys.reserve(nrow);
+    for (size_t r = 0; r < nrow; ++r) {
+      std::string clean = strutil::stripAnsi(cell(r, sc).text());
+      long long v = 0;
+      auto [p, ec] =
+          std::from_chars(clean.data(), clean.data() + clean.size(), v);
+      bool ok = !clean.empty() && ec == std::errc() &&
+                p == clean.data() + clean.size();
+      keys.push_back(ok ? std::optional<long long>(v) : std::nullopt);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      const auto &ka = keys[a], &kb = keys[b];
+      if (ka && kb)
+        return *ka < *kb;
+      if (ka || kb)
+        return ka.has_value();
+      return cell(a, sc).text() < cell(b, sc).text();
+    });
   } else {
-    std::stable_sort(sorted_rows.begin(), sorted_rows.end(),
-                     [&](const std::vector<std::string> &a,
-                         const std::vector<std::string> &b) {
-                       const std::string &sa = (sc < static_cast<int>(a.size()))
-                                                   ? a[sc]
-                                                   : std::string();
-                       const std::string &sb = (sc < static_cast<int>(b.size()))
-                                                   ? b[sc]
-                                                   : std::string();
-                       return sa < sb;
-                     });
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return cell(a, sc).text() < cell(b, sc).text();
+    });
   }
 
-  for (const auto &r : sorted_rows) {
-    std::vector<std::vector<std::string>> cellLines(ncol);
+  std::pmr::vector<std::pmr::vector<std::string_view>> cellLines(&scratch);
+  for (size_t i = 0; i < ncol; ++i)
+    cellLines.emplace_back();
+  for (size_t ri : order) {
+    const Cell *row = &cells_[ri * ncol];
+    bool multiLine = std::any_of(row, row + ncol,
+                                 [](const Cell &c) { return c.multiLine; });
+    if (!multiLine) {
+      for (size_t i = 0; i < ncol; ++i) {
+        if (i)
+          buf += ' ';
+        pad(row[i].text(), static_cast<int>(row[i].width), widths[i],
+            columns_[i].leftAlign);
+      }
+      buf += '\n';
+      flush(kChunkSize);
+      continue;
+    }
+
     size_t maxLines = 1;
     for (size_t i = 0; i < ncol; ++i) {
-      cellLines[i] = strutil::splitLines(r[i]);
+      strutil::splitLines(row[i].text(), cellLines[i]);
       maxLines = std::max(maxLines, cellLines[i].size());
     }
 
     for (size_t ln = 0; ln < maxLines; ++ln) {
       for (size_t i = 0; i < ncol; ++i) {
         if (i)
-          oss << ' ';
-        std::string cell = (ln < cellLines[i].size()) ? cellLines[i][ln] : "";
-        oss << pad(cell, widths[i], columns_[i].leftAlign);
+          buf += ' ';
+        std::string_view text =
+            ln < cellLines[i].size() ? cellLines[i][ln] : std::string_view();
+        pad(text, -1, widths[i], columns_[i].leftAlign);
       }
-      oss << '\n';
+      buf += '\n';
     }
+    flush(kChunkSize);
   }
-
-  return oss.str();
+  flush(1);
 }
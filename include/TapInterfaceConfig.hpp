@@ -35,11 +35,29 @@
 #include "InterfaceConfig.hpp"
 
 #include "ConfigurationManager.hpp"
+#include <optional>
+#include <string>
 
 class TapInterfaceConfig : public InterfaceConfig {
 public:
   explicit TapInterfaceConfig(const InterfaceConfig &base)
       : InterfaceConfig(base) {}
+
+  // Requested device options (Linux /dev/net/tun). queues > 1 creates an
+  // IFF_MULTI_QUEUE device; owner/owner_group let an unprivileged VMM attach.
+  std::optional<int> queues;
+  std::optional<std::string> owner;
+  std::optional<std::string> owner_group;
+  std::optional<bool> vnet_hdr;
+
+  // Read back from the link dump. tx/rx_queues are the netdev queues the
+  // driver allocates (IFLA_NUM_TX_QUEUES, 256 for any multiqueue device);
+  // attached_queues counts the open queue fds (IFLA_TUN_NUM_QUEUES).
+  bool multi_queue = false;
+  std::optional<int> tx_queues;
+  std::optional<int> rx_queues;
+  std::optional<int> attached_queues;
+
   void save(ConfigurationManager &mgr) const override;
   void create(ConfigurationManager &mgr) const;
   void destroy(ConfigurationManager &mgr) const override;
@@ -32,12 +32,13 @@
 
 #pragma once
 
-#include "InterfaceConfig.hpp"
 #include "TableFormatter.hpp"
+#include "TapInterfaceConfig.hpp"
+#include <string>
 #include <vector>
 
-class TapTableFormatter : public TableFormatter<InterfaceConfig> {
+class TapTableFormatter : public TableFormatter<TapInterfaceConfig> {
 public:
   TapTableFormatter() = default;
-  std::string format(const std::vector<InterfaceConfig> &items) override;
+  std::string format(const std::vector<TapInterfaceConfig> &items) override;
 };
@@ -24,9 +24,12 @@ public:
   std::vector<std::string>
   autoComplete(const std::vector<std::string> &tokens [[maybe_unused]],
                std::string_view partial [[maybe_unused]],
-               ConfigurationManager *mgr [[maybe_unused]]) const override {
+               const CompletionCache *cache [[maybe_unused]]) const override {
     return {};
   }
+
+  TokenKind kind() const override { return TokenKind::Target; }
+
   std::unique_ptr<Token> clone() const override {
     return std::make_unique<TargetToken>(*this);
   }
@@ -36,7 +39,7 @@ public:
   // Parse tokens starting at `start` (pointing to "target") and set `next`
   // to the index after consumed tokens. Returns nullptr on parse error.
   static std::shared_ptr<TargetToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
   Type type = Type::Unknown;
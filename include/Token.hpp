@@ -40,6 +40,30 @@
 #include "ConfigData.hpp"
 #include "ConfigurationManager.hpp"
 
+class CompletionCache;
+
+/**
+ * @brief What a parsed token is
+ *
+ * Every concrete token reports its kind, so the dispatcher can index its
+ * handler table directly instead of probing with dynamic_cast.
+ */
+enum class TokenKind {
+  Other,
+  Show,
+  Set,
+  Delete,
+  Interface,
+  Route,
+  VRF,
+  Arp,
+  Ndp,
+  Policy,
+  Target,
+  Commit,
+  Count
+};
+
 /**
  * @brief Base class for command tokens in the parser chain
  *
@@ -64,6 +88,9 @@ public:
    */
   virtual std::string toString() const { return std::string(); }
 
+  /** @brief Which token this is (verb or object) */
+  virtual TokenKind kind() const { return TokenKind::Other; }
+
   /**
    * @brief Provide completion suggestions for partial input
    * @param partial Partial input string to complete
@@ -74,7 +101,7 @@ public:
 
   /**
    * @brief Context-aware completion with access to preceding tokens and
-   *        the runtime configuration manager.
+   *        cached system state.
    *
    * Subclasses that need dynamic data (e.g. interface names from the
    * system) override this.  The default implementation simply delegates
@@ -82,12 +109,12 @@ public:
    *
    * @param tokens  All tokens preceding the word being completed
    * @param partial The partially-typed word
-   * @param mgr     Configuration manager (may be nullptr)
+   * @param cache   Interface, group, VRF and prefix names (may be nullptr)
    * @return Vector of possible completions
    */
   virtual std::vector<std::string>
   autoComplete(const std::vector<std::string> &tokens, std::string_view partial,
-               ConfigurationManager *mgr) const;
+               const CompletionCache *cache) const;
 
   /**
    * @brief Clone token for copy/transform operations
@@ -105,3 +132,17 @@ public:
 protected:
   std::shared_ptr<Token> next_;
 };
+
+/**
+ * @brief Numeric value of a command token
+ *
+ * Tokens are views into the command line, which std::stoi cannot take.
+ * These keep std::stoi/std::stoul semantics, including the exceptions on
+ * malformed input. Numeric tokens are short, so the temporary string
+ * stays in the small-string buffer.
+ */
+inline int tokenInt(std::string_view s) { return std::stoi(std::string(s)); }
+
+inline unsigned long tokenULong(std::string_view s, int base = 10) {
+  return std::stoul(std::string(s), nullptr, base);
+}
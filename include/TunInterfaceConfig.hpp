@@ -25,8 +25,22 @@ public:
   std::optional<uint32_t> options;
   std::optional<int> tunnel_vrf;
 
+  // Multiqueue / vnet header options, same meaning as on TapInterfaceConfig.
+  std::optional<int> queues;
+  std::optional<std::string> owner;
+  std::optional<std::string> owner_group;
+  std::optional<bool> vnet_hdr;
+  bool multi_queue = false;
+  std::optional<int> tx_queues;
+  std::optional<int> rx_queues;
+  std::optional<int> attached_queues;
+
   TunInterfaceConfig(const TunInterfaceConfig &o)
-      : InterfaceConfig(o), options(o.options), tunnel_vrf(o.tunnel_vrf) {
+      : InterfaceConfig(o), options(o.options), tunnel_vrf(o.tunnel_vrf),
+        queues(o.queues), owner(o.owner), owner_group(o.owner_group),
+        vnet_hdr(o.vnet_hdr), multi_queue(o.multi_queue),
+        tx_queues(o.tx_queues), rx_queues(o.rx_queues),
+        attached_queues(o.attached_queues) {
     if (o.source)
       source = o.source->clone();
     if (o.destination)
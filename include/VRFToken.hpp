@@ -56,12 +56,19 @@ public:
   /** @brief Get autocomplete suggestions (none for VRF) */
   std::vector<std::string> autoComplete(std::string_view) const override;
 
+  /** @brief Complete VRF names after `name`, table ids after `vrf` */
+  std::vector<std::string>
+  autoComplete(const std::vector<std::string> &tokens, std::string_view partial,
+               const CompletionCache *cache) const override;
+
+  TokenKind kind() const override { return TokenKind::VRF; }
+
   /** @brief Clone the token */
   std::unique_ptr<Token> clone() const override;
 
   /** @brief Parse VRF tokens starting at `start` and return a VRFToken */
   static std::shared_ptr<VRFToken>
-  parseFromTokens(const std::vector<std::string> &tokens, size_t start,
+  parseFromTokens(const std::vector<std::string_view> &tokens, size_t start,
                   size_t &next);
 
   /** @brief Get VRF table ID */
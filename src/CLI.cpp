@@ -28,11 +28,13 @@
 #include "CLI.hpp"
 #include "CommandDispatcher.hpp"
 #include "DeleteCommand.hpp"
+#include "KeywordTrie.hpp"
+#include "OutputPipe.hpp"
 #include "Parser.hpp"
 #include <algorithm>
 #include <cstring>
-#include <fstream>
 #include <iostream>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -47,6 +49,41 @@ static volatile sig_atomic_t g_sigint_received = 0;
 
 static void cli_sigint_handler(int) { g_sigint_received = 1; }
 
+namespace {
+  /// Routes std::cout through an OutputPipe for one command, then flushes
+  /// the pipe and puts the terminal's buffer back.
+  class PipeScope {
+  public:
+    explicit PipeScope(OutputPipe *pipe) : pipe_(pipe) {
+      if (pipe_)
+        saved_ = std::cout.rdbuf(pipe_);
+    }
+    ~PipeScope() {
+      if (!pipe_)
+        return;
+      try {
+        std::cout.flush();
+        pipe_->finish();
+      } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << "\n";
+      }
+      std::cout.rdbuf(saved_);
+    }
+
+  private:
+    OutputPipe *pipe_;
+    std::streambuf *saved_ = nullptr;
+  };
+
+  /// Terminal height for paging, or 0 when stdout is not a terminal.
+  unsigned terminalRows() {
+    winsize ws{};
+    if (!isatty(STDOUT_FILENO) || ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0)
+      return 0;
+    return ws.ws_row;
+  }
+} // namespace
+
 // =====================================================================
 // Construction / destruction / history
 // =====================================================================
@@ -61,27 +98,21 @@ CLI::CLI(std::unique_ptr<ConfigurationManager> mgr)
 CLI::~CLI() { cleanupEditLine(); }
 
 void CLI::loadHistory() {
-  if (!hist_ || historyFile_.empty())
+  if (!hist_)
     return;
-  history(hist_, &ev_, H_LOAD, historyFile_.c_str());
+  history_ = std::make_unique<HistoryLog>(historyFile_);
+  // libedit only needs the tail for up/down recall; Ctrl-R searches the
+  // whole log.
+  size_t n = history_->size();
+  for (size_t i = n > kEditHistorySize ? n - kEditHistorySize : 0; i < n; ++i)
+    history(hist_, &ev_, H_ENTER, (*history_)[i].c_str());
 }
 
 void CLI::saveHistory(const std::string &line) {
-  if (!hist_ || historyFile_.empty() || line.empty())
+  if (!hist_ || !history_ || line.empty())
     return;
   history(hist_, &ev_, H_ENTER, line.c_str());
-  history(hist_, &ev_, H_SAVE, historyFile_.c_str());
-}
-
-std::vector<std::string> CLI::loadHistoryLines() const {
-  std::vector<std::string> lines;
-  if (historyFile_.empty())
-    return lines;
-  std::ifstream hf(historyFile_);
-  std::string l;
-  while (std::getline(hf, l))
-    lines.push_back(l);
-  return lines;
+  history_->append(line);
 }
 
 // =====================================================================
@@ -96,17 +127,29 @@ void CLI::processLine(const std::string &line) {
 
   saveHistory(line);
 
-  netcli::Parser parser;
-  auto toks = parser.tokenize(line);
+  std::vector<std::string_view> pipes;
+  auto toks = parser_.tokenize(OutputPipe::split(line, pipes), scratch_);
   try {
-    auto cmd = parser.parse(toks);
+    auto cmd = parser_.parse(toks);
     if (!cmd || !cmd->head()) {
       std::cerr << "Error: Invalid command\n";
       return;
     }
 
-    netcli::CommandDispatcher dispatcher;
-    dispatcher.dispatch(cmd->head(), mgr_.get());
+    // Interactive output is paged; "| no-more" turns that off.
+    unsigned rows = completions_ ? terminalRows() : 0;
+    std::unique_ptr<OutputPipe> pipe;
+    if (!pipes.empty() || rows > 0) {
+      pipe = std::make_unique<OutputPipe>(std::cout.rdbuf());
+      pipe->setPager(rows);
+      for (auto p : pipes)
+        pipe->addStage(p);
+    }
+
+    PipeScope scope(pipe.get());
+    dispatcher_.dispatch(cmd->head(), mgr_.get());
+    if (completions_)
+      completions_->invalidate();
   } catch (const std::exception &e) {
     std::cerr << "Error: " << e.what() << "\n";
   }
@@ -127,9 +170,9 @@ char *CLI::searchPromptFunc(EditLine *el) {
   // Build the search prompt: (reverse-i-search)`query':
   // We use a static buffer that persists across calls.
   static char buf[256];
-  if (cli)
+  if (cli && cli->search_)
     snprintf(buf, sizeof(buf),
-             "(reverse-i-search)`%s': ", cli->search_query_.c_str());
+             "(reverse-i-search)`%s': ", cli->search_->query().c_str());
   else
     snprintf(buf, sizeof(buf), "(reverse-i-search)`': ");
   return buf;
@@ -200,13 +243,14 @@ void CLI::setupEditLine() {
   // ── History ────────────────────────────────────────────────────────
   hist_ = history_init();
   if (hist_) {
-    history(hist_, &ev_, H_SETSIZE, 1000);
+    history(hist_, &ev_, H_SETSIZE, static_cast<int>(kEditHistorySize));
     el_set(el_, EL_HIST, history, hist_);
     loadHistory();
   }
 }
 
 void CLI::cleanupEditLine() {
+  history_.reset();
   if (hist_) {
     history_end(hist_);
     hist_ = nullptr;
@@ -223,18 +267,29 @@ void CLI::cleanupEditLine() {
 // =====================================================================
 
 std::vector<std::string>
-CLI::getCompletions(const std::vector<std::string> &tokens,
+CLI::getCompletions(const std::vector<std::string_view> &tokens,
                     const std::string &partial) const {
   if (tokens.empty()) {
-    std::vector<std::string> top = {"show", "set", "delete", "exit", "quit"};
-    std::vector<std::string> m;
-    for (const auto &c : top)
-      if (c.rfind(partial, 0) == 0)
-        m.push_back(c);
+    static const KeywordTrie<> builtins{"exit", "quit"};
+    auto m = netcli::Parser::completeVerb(partial);
+    for (auto &c : builtins.complete(partial))
+      m.push_back(std::move(c));
     return m;
   }
 
-  auto cmd = parser_.parse(tokens);
+  // After a '|' only the pipe command itself is completed.
+  auto bar = std::find(tokens.rbegin(), tokens.rend(), "|");
+  if (bar == tokens.rbegin())
+    return OutputPipe::completeStage(partial);
+  if (bar != tokens.rend())
+    return {};
+
+  std::unique_ptr<Command> cmd;
+  try {
+    cmd = parser_.parse(tokens);
+  } catch (const std::exception &) {
+    return {}; // e.g. an out-of-range value typed so far
+  }
   if (!cmd || !cmd->head())
     return {};
 
@@ -245,10 +300,11 @@ CLI::getCompletions(const std::vector<std::string> &tokens,
   if (!tok)
     return {};
 
-  // Use the context-aware virtual — tokens that need the manager (e.g.
-  // InterfaceToken) override it; all others fall through to
-  // autoComplete(partial).
-  return tok->autoComplete(tokens, partial, mgr_.get());
+  // Use the context-aware virtual — tokens that complete system names (e.g.
+  // InterfaceToken, RouteToken) override it and read the completion cache;
+  // all others fall through to autoComplete(partial).
+  return tok->autoComplete({tokens.begin(), tokens.end()}, partial,
+                          completions_.get());
 }
 
 /// Remove the inline preview from the edit buffer.
@@ -284,11 +340,14 @@ void CLI::computeAndShowPreview() {
     return;
 
   // Tokenize everything before the current word.
-  std::string before(start, word);
-  auto tokens = parser_.tokenize(before);
+  std::string before(start, word), scratch;
+  auto tokens = parser_.tokenize(before, scratch);
 
+  // Only a prefix match can be previewed as a suffix; fuzzy matches wait
+  // for Tab.
   auto completions = getCompletions(tokens, partial);
-  if (completions.empty() || completions[0].size() <= partial.size())
+  if (completions.empty() || completions[0].size() <= partial.size() ||
+      !completions[0].starts_with(partial))
     return;
 
   std::string suffix = completions[0].substr(partial.size());
@@ -338,8 +397,8 @@ unsigned char CLI::completeCommand(EditLine *el, int ch [[maybe_unused]]) {
     --word;
 
   std::string partial(word, cursor - word);
-  std::string before(start, word);
-  auto tokens = cli->parser_.tokenize(before);
+  std::string before(start, word), scratch;
+  auto tokens = cli->parser_.tokenize(before, scratch);
   auto completions = cli->getCompletions(tokens, partial);
 
   if (completions.empty()) {
@@ -348,6 +407,12 @@ unsigned char CLI::completeCommand(EditLine *el, int ch [[maybe_unused]]) {
   }
 
   if (completions.size() == 1) {
+    // A fuzzy match does not extend the typed word; replace it instead.
+    if (!completions[0].starts_with(partial)) {
+      el_deletestr(el, static_cast<int>(partial.size()));
+      el_insertstr(el, completions[0].c_str());
+      return CC_REFRESH;
+    }
     std::string ins = completions[0].substr(partial.size());
     if (!ins.empty())
       el_insertstr(el, ins.c_str());
@@ -492,12 +557,11 @@ void CLI::runReverseSearch() {
   if (li)
     saved_line.assign(li->buffer, std::strlen(li->buffer));
 
-  // Load all history lines (most-recent last).
-  auto history_lines = loadHistoryLines();
+  if (!history_)
+    return;
 
   // Initialise search state.
-  search_query_.clear();
-  search_matches_.clear();
+  search_ = std::make_unique<HistoryLog::Search>(*history_);
   search_index_ = -1;
   in_search_ = true;
 
@@ -508,27 +572,19 @@ void CLI::runReverseSearch() {
   clearLineBuffer();
   el_set(el_, EL_REFRESH);
 
-  // Helper: recompute matches for the current query.
-  auto recomputeMatches = [&]() {
-    search_matches_.clear();
-    search_index_ = -1;
-    if (search_query_.empty())
-      return;
-    // Walk history in reverse (most-recent first).
-    for (auto it = history_lines.rbegin(); it != history_lines.rend(); ++it) {
-      if (it->find(search_query_) != std::string::npos)
-        search_matches_.push_back(*it);
-    }
-    if (!search_matches_.empty())
-      search_index_ = 0;
+  // Helper: restart at the most recent match after the query changed.
+  auto resetIndex = [&]() {
+    search_index_ = search_->matches().empty() ? -1 : 0;
   };
 
-  // Helper: display the current match in the buffer.
+  // Helper: display the current match in the buffer.  Matches are oldest
+  // first; search_index_ counts back from the most recent.
   auto showMatch = [&]() {
     clearLineBuffer();
-    if (search_index_ >= 0 &&
-        search_index_ < static_cast<int>(search_matches_.size())) {
-      el_insertstr(el_, search_matches_[search_index_].c_str());
+    const auto &ids = search_->matches();
+    if (search_index_ >= 0 && search_index_ < static_cast<int>(ids.size())) {
+      size_t id = ids[ids.size() - 1 - static_cast<size_t>(search_index_)];
+      el_insertstr(el_, (*history_)[id].c_str());
     }
   };
 
@@ -546,9 +602,9 @@ void CLI::runReverseSearch() {
 
     if (c == '\x12') {
       // Ctrl-R again: cycle to next match.
-      if (!search_matches_.empty()) {
+      if (!search_->matches().empty()) {
         search_index_ =
-            (search_index_ + 1) % static_cast<int>(search_matches_.size());
+            (search_index_ + 1) % static_cast<int>(search_->matches().size());
       }
       continue;
     }
@@ -569,17 +625,17 @@ void CLI::runReverseSearch() {
 
     // Backspace (0x08, 0x7f): shrink query.
     if (c == '\x08' || c == '\x7f') {
-      if (!search_query_.empty()) {
-        search_query_.pop_back();
-        recomputeMatches();
+      if (!search_->query().empty()) {
+        search_->pop();
+        resetIndex();
       }
       continue;
     }
 
     // Printable character: extend query.
     if (c >= 0x20 && c <= 0x7e) {
-      search_query_ += c;
-      recomputeMatches();
+      search_->push(c);
+      resetIndex();
       continue;
     }
 
@@ -588,6 +644,7 @@ void CLI::runReverseSearch() {
 
   // Restore normal prompt.
   in_search_ = false;
+  search_.reset();
   el_set(el_, EL_PROMPT, &CLI::promptFunc);
 }
 
@@ -613,6 +670,9 @@ void CLI::run() {
     std::cerr << "Failed to initialize interactive mode\n";
     return;
   }
+  // Completion previews run on every keystroke; keep what they need in
+  // memory instead of enumerating interfaces from the editline callback.
+  completions_ = std::make_unique<CompletionCache>(*mgr_);
 
   int count;
   const char *line;
@@ -651,7 +711,6 @@ void CLI::run() {
     if (cmd == "exit" || cmd == "quit")
       break;
 
-    saveHistory(cmd);
     processLine(cmd);
   }
 }
@@ -29,9 +29,9 @@
 #include "ConfigurationManager.hpp"
 
 void ArpConfig::save(ConfigurationManager &mgr) const {
-  mgr.SetArpEntry(ip, mac, iface, !permanent, published);
+  mgr.SetArpEntry(ip.addressString(), mac, iface, !permanent, published);
 }
 
 void ArpConfig::destroy(ConfigurationManager &mgr) const {
-  mgr.DeleteArpEntry(ip, iface);
+  mgr.DeleteArpEntry(ip.addressString(), iface);
 }
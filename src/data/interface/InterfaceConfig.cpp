@@ -60,11 +60,12 @@
 // and constructing `InterfaceConfig` instances.
 
 InterfaceConfig::InterfaceConfig(
-    std::string name_, InterfaceType type_, std::unique_ptr<IPNetwork> address_,
-    std::vector<std::unique_ptr<IPNetwork>> aliases_,
-    std::unique_ptr<VRFConfig> vrf_, std::optional<uint32_t> flags_,
+    std::string name_, InterfaceType type_,
+    std::optional<InterfaceAddress> address_,
+    std::vector<InterfaceAddress> aliases_,
+    std::shared_ptr<const VRFConfig> vrf_, std::optional<uint32_t> flags_,
     std::vector<std::string> groups_, std::optional<int> mtu_)
-    : name(std::move(name_)), type(type_), address(std::move(address_)),
+    : name(std::move(name_)), type(type_), address(address_),
       aliases(std::move(aliases_)), vrf(std::move(vrf_)), flags(flags_),
       groups(std::move(groups_)), mtu(mtu_) {}
 
@@ -83,45 +84,6 @@ void InterfaceConfig::removeAddress(ConfigurationManager &mgr,
   mgr.RemoveInterfaceAddress(name, addr);
 }
 
-// Copy constructor and assignment defined out-of-line to avoid instantiating
-// unique_ptr destructors against incomplete types in headers.
-InterfaceConfig::InterfaceConfig(const InterfaceConfig &o) {
-  name = o.name;
-  type = o.type;
-  if (o.address)
-    address = o.address->clone();
-  else
-    address.reset();
-  aliases.clear();
-  for (const auto &a : o.aliases) {
-    if (a)
-      aliases.emplace_back(a->clone());
-    else
-      aliases.emplace_back(nullptr);
-  }
-  if (o.vrf)
-    vrf = std::make_unique<VRFConfig>(*o.vrf);
-  else
-    vrf.reset();
-  flags = o.flags;
-  index = o.index;
-  groups = o.groups;
-  mtu = o.mtu;
-  metric = o.metric;
-  nd6_options = o.nd6_options;
-  description = o.description;
-  hwaddr = o.hwaddr;
-  capabilities = o.capabilities;
-  req_capabilities = o.req_capabilities;
-  media = o.media;
-  media_active = o.media_active;
-  media_status = o.media_status;
-  status_str = o.status_str;
-  phys = o.phys;
-  baudrate = o.baudrate;
-  link_state = o.link_state;
-}
-
 // Static helper: check whether a named interface exists.
 bool InterfaceConfig::exists(const ConfigurationManager &mgr,
                              std::string_view name) {
@@ -230,7 +192,7 @@ InterfaceConfig::formatInterfaces(const std::vector<InterfaceConfig> &ifaces,
   }
   if (checkType == InterfaceType::Tap) {
     TapTableFormatter formatter;
-    return formatter.format(ifaces);
+    return formatter.format(mgr->GetTapInterfaces(ifaces));
   }
   if (checkType == InterfaceType::Carp) {
     CarpTableFormatter formatter;
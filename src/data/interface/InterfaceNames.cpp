@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "InterfaceNames.hpp"
+#include <mutex>
+#include <net/if.h>
+
+InterfaceNames &InterfaceNames::instance() {
+  static InterfaceNames table;
+  return table;
+}
+
+InterfaceId InterfaceNames::intern(std::string_view name) {
+  if (name.empty())
+    return kNone;
+  {
+    std::shared_lock lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end())
+      return it->second;
+  }
+  std::unique_lock lock(mutex_);
+  auto it = ids_.find(name);
+  if (it != ids_.end())
+    return it->second;
+  // The map keys view the deque's strings, which never move.
+  const std::string &stored = names_.emplace_back(name);
+  auto id = static_cast<InterfaceId>(names_.size());
+  ids_.emplace(stored, id);
+  return id;
+}
+
+InterfaceId InterfaceNames::find(std::string_view name) const {
+  std::shared_lock lock(mutex_);
+  auto it = ids_.find(name);
+  return it == ids_.end() ? kNone : it->second;
+}
+
+const std::string &InterfaceNames::name(InterfaceId id) const {
+  static const std::string empty;
+  std::shared_lock lock(mutex_);
+  if (id == kNone || id > names_.size())
+    return empty;
+  return names_[id - 1];
+}
+
+InterfaceId InterfaceIndexCache::id(unsigned int ifindex) {
+  if (ifindex == 0)
+    return InterfaceNames::kNone;
+  auto [it, inserted] = ids_.try_emplace(ifindex, InterfaceNames::kNone);
+  if (inserted) {
+    char buf[IF_NAMESIZE] = {};
+    if (if_indextoname(ifindex, buf))
+      it->second = InterfaceNames::instance().intern(buf);
+  }
+  return it->second;
+}
+
+const std::string *InterfaceIndexCache::name(unsigned int ifindex) {
+  InterfaceId i = id(ifindex);
+  return i == InterfaceNames::kNone ? nullptr
+                                    : &InterfaceNames::instance().name(i);
+}
@@ -17,17 +17,9 @@ void PfsyncInterfaceConfig::destroy(ConfigurationManager &mgr) const {
 PfsyncInterfaceConfig::PfsyncInterfaceConfig(const InterfaceConfig &base) {
   name = base.name;
   type = InterfaceType::Unknown; // set appropriate type if defined elsewhere
-  if (base.address)
-    address = base.address->clone();
-  aliases.clear();
-  for (const auto &a : base.aliases) {
-    if (a)
-      aliases.emplace_back(a->clone());
-    else
-      aliases.emplace_back(nullptr);
-  }
-  if (base.vrf)
-    vrf = std::make_unique<VRFConfig>(*base.vrf);
+  address = base.address;
+  aliases = base.aliases;
+  vrf = base.vrf;
   flags = base.flags;
   groups = base.groups;
   mtu = base.mtu;
@@ -29,9 +29,9 @@
 #include "ConfigurationManager.hpp"
 
 void NdpConfig::save(ConfigurationManager &mgr) const {
-  mgr.SetNdpEntry(ip, mac, iface, !permanent);
+  mgr.SetNdpEntry(ip.addressString(), mac, iface, !permanent);
 }
 
 void NdpConfig::destroy(ConfigurationManager &mgr) const {
-  mgr.DeleteNdpEntry(ip, iface);
+  mgr.DeleteNdpEntry(ip.addressString(), iface);
 }
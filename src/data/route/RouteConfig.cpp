@@ -10,3 +10,20 @@ void RouteConfig::save(ConfigurationManager &mgr) const { mgr.AddRoute(*this); }
 void RouteConfig::destroy(ConfigurationManager &mgr) const {
   mgr.DeleteRoute(*this);
 }
+
+void ConfigurationManager::AddRoutes(
+    const std::vector<RouteConfig> &routes) const {
+  for (const auto &r : routes)
+    AddRoute(r);
+}
+
+void ConfigurationManager::ReplaceRoute(const RouteConfig &was,
+                                        const RouteConfig &want) const {
+  DeleteRoute(was);
+  try {
+    AddRoute(want);
+  } catch (...) {
+    AddRoute(was);
+    throw;
+  }
+}
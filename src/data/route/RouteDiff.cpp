@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "RouteDiff.hpp"
+#include "NexthopGroupConfig.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+
+namespace {
+
+  constexpr size_t kTaken = SIZE_MAX;
+
+  // (table, prefix) group of a desired route or a live row.
+  std::pair<int, IPPrefix> groupOf(const RouteConfig &r) {
+    return {r.vrf.value_or(0), r.prefix};
+  }
+  std::pair<int, IPPrefix> groupOf(const RouteTable &t, size_t row) {
+    return {t.table(row), t.prefix(row)};
+  }
+
+  // Sort key; routes without a nexthop sort before those with one.
+  auto keyOf(const RouteConfig &r) {
+    return std::make_tuple(r.vrf.value_or(0), r.prefix, r.nexthop.has_value(),
+                           r.nexthop.value_or(IPPrefix{}));
+  }
+  auto keyOf(const RouteTable &t, size_t row) {
+    auto nh = t.nexthop(row);
+    return std::make_tuple(t.table(row), t.prefix(row), nh.has_value(),
+                           nh.value_or(IPPrefix{}));
+  }
+
+  // rtm_protocol values of routes this tool installs: SIOCADDRT sets
+  // RTPROT_BOOT, netlink requests RTPROT_STATIC.
+  constexpr int kProtoBoot = 3;
+  constexpr int kProtoStatic = 4;
+
+  bool managed(const RouteTable &t, size_t row) {
+    if (t.flags(row) & RouteConfig::Flag(RouteConfig::PINNED))
+      return false;
+    if (auto proto = t.protocol(row)) {
+      if (*proto != kProtoBoot && *proto != kProtoStatic)
+        return false;
+    } else if (!(t.flags(row) & RouteConfig::Flag(RouteConfig::STATIC))) {
+      return false;
+    }
+    return t.nexthop(row) || t.nexthopGroup(row) || t.blackhole(row) ||
+           t.reject(row);
+  }
+
+  // True when live row `row` already provides everything `want` asks for.
+  bool satisfies(const RouteTable &t, size_t row, const RouteConfig &want) {
+    if (t.nexthop(row) != want.nexthop)
+      return false;
+    auto group = t.nexthopGroup(row);
+    if (group.has_value() != want.nexthop_group.has_value() ||
+        (group && !NexthopGroupConfig::sameId(std::string(*group),
+                                              *want.nexthop_group)))
+      return false;
+    if (t.blackhole(row) != want.blackhole || t.reject(row) != want.reject)
+      return false;
+    if (want.iface) {
+      InterfaceId id = t.interface(row);
+      if (id == InterfaceNames::kNone ||
+          InterfaceNames::instance().find(*want.iface) != id)
+        return false;
+    }
+    return true;
+  }
+
+} // namespace
+
+RouteDiff RouteDiff::compute(std::vector<RouteConfig> desired,
+                             const RouteTable &current) {
+  std::sort(desired.begin(), desired.end(),
+            [](const RouteConfig &a, const RouteConfig &b) {
+              return keyOf(a) < keyOf(b);
+            });
+  std::vector<size_t> order(current.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return keyOf(current, a) < keyOf(current, b);
+  });
+
+  RouteDiff diff;
+  std::vector<RouteConfig *> wants;
+  std::vector<size_t> lives; // rows of the group; kTaken once paired
+  size_t i = 0, j = 0;
+  while (i < desired.size() || j < order.size()) {
+    // Next (table, prefix) group on either side.
+    std::pair<int, IPPrefix> head;
+    if (j == order.size())
+      head = groupOf(desired[i]);
+    else if (i == desired.size())
+      head = groupOf(current, order[j]);
+    else
+      head = std::min(groupOf(desired[i]), groupOf(current, order[j]));
+
+    size_t di = i, cj = j;
+    while (di < desired.size() && groupOf(desired[di]) == head)
+      ++di;
+    while (cj < order.size() && groupOf(current, order[cj]) == head)
+      ++cj;
+
+    wants.clear();
+    for (size_t k = i; k < di; ++k)
+      wants.push_back(&desired[k]);
+    lives.assign(order.begin() + j, order.begin() + cj);
+
+    // Exact nexthop matches first, then pair the rest with managed live
+    // routes as replacements.
+    for (auto &w : wants) {
+      auto it = std::find_if(lives.begin(), lives.end(), [&](size_t l) {
+        return l != kTaken && current.nexthop(l) == w->nexthop;
+      });
+      if (it == lives.end())
+        continue;
+      if (satisfies(current, *it, *w))
+        ++diff.unchanged;
+      else
+        diff.replace.emplace_back(current.at(*it), std::move(*w));
+      *it = kTaken;
+      w = nullptr;
+    }
+    auto live = lives.begin();
+    for (auto *w : wants) {
+      if (!w)
+        continue;
+      while (live != lives.end() &&
+             (*live == kTaken || !managed(current, *live)))
+        ++live;
+      if (live != lives.end()) {
+        diff.replace.emplace_back(current.at(*live), std::move(*w));
+        *live = kTaken;
+      } else {
+        diff.add.push_back(std::move(*w));
+      }
+    }
+    for (size_t l : lives) {
+      if (l != kTaken && managed(current, l))
+        diff.remove.push_back(current.at(l));
+    }
+
+    i = di;
+    j = cj;
+  }
+  return diff;
+}
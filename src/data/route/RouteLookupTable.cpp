@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "RouteLookupTable.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace {
+
+  constexpr int kStride = 6;
+  constexpr int kDirectBits = 18;
+  constexpr uint32_t kNodeBit = 0x80000000u;
+
+  // Keys are addresses left-aligned in an unsigned integer of W bits:
+  // IPv4 in the top half of a uint64_t, IPv6 in an unsigned __int128.
+  template <typename K> constexpr int kWidth = sizeof(K) * 8;
+
+  template <typename K> inline unsigned slotAt(K key, int off) {
+    constexpr int W = kWidth<K>;
+    if (off + kStride <= W)
+      return static_cast<unsigned>(key >> (W - kStride - off)) & 63u;
+    return static_cast<unsigned>(key << (off + kStride - W)) & 63u;
+  }
+
+  template <typename K> inline unsigned bitAt(K key, int off) {
+    return static_cast<unsigned>(key >> (kWidth<K> - 1 - off)) & 1u;
+  }
+
+  // Plain binary trie used only while building.
+  struct BinNode {
+    std::array<int32_t, 2> child{-1, -1};
+    uint32_t route = 0; // route index + 1
+  };
+
+  template <typename K> class TrieBuilder {
+  public:
+    TrieBuilder(const std::vector<RouteConfig> &routes,
+                RouteLookupTable::Trie &out)
+        : routes_(routes), out_(out) {
+      bin_.emplace_back();
+    }
+
+    void insert(K key, int len, uint32_t index) {
+      int32_t cur = 0;
+      for (int i = 0; i < len; ++i) {
+        unsigned b = bitAt(key, i);
+        if (bin_[cur].child[b] < 0) {
+          bin_[cur].child[b] = static_cast<int32_t>(bin_.size());
+          bin_.emplace_back();
+        }
+        cur = bin_[cur].child[b];
+      }
+      uint32_t &slot = bin_[cur].route;
+      if (slot == 0 || (!isUp(slot - 1) && isUp(index)))
+        slot = index + 1;
+    }
+
+    void build() {
+      out_.direct.assign(size_t(1) << kDirectBits, 0);
+      out_.nodes.clear();
+      out_.leaves.clear();
+      direct(0, 0, 0, bin_[0].route);
+    }
+
+  private:
+    bool isUp(uint32_t index) const {
+      return routes_[index].flags & RouteConfig::Flag(RouteConfig::UP);
+    }
+
+    bool hasChildren(int32_t n) const {
+      return bin_[n].child[0] >= 0 || bin_[n].child[1] >= 0;
+    }
+
+    // Fill the direct-pointing table for the subtree of `bin`, which
+    // covers direct[index << (kDirectBits - depth) ...].
+    void direct(int32_t bin, int depth, uint32_t index, uint32_t best) {
+      if (depth == kDirectBits) {
+        if (!hasChildren(bin)) {
+          out_.direct[index] = best;
+          return;
+        }
+        uint32_t ni = static_cast<uint32_t>(out_.nodes.size());
+        out_.nodes.emplace_back();
+        fill(ni, bin, best);
+        out_.direct[index] = ni | kNodeBit;
+        return;
+      }
+      for (unsigned b = 0; b < 2; ++b) {
+        uint32_t sub = index << 1 | b;
+        int32_t c = bin_[bin].child[b];
+        if (c >= 0) {
+          direct(c, depth + 1, sub, bin_[c].route ? bin_[c].route : best);
+          continue;
+        }
+        int shift = kDirectBits - depth - 1;
+        std::fill_n(out_.direct.begin() + (size_t(sub) << shift),
+                    size_t(1) << shift, best);
+      }
+    }
+
+    // Expand the 6-bit stride below binary node `bin` into compiled node
+    // `ni`. `best` already includes bin's own route.
+    void fill(uint32_t ni, int32_t bin, uint32_t best) {
+      std::array<int32_t, 64> childBin;
+      std::array<uint32_t, 64> result;
+      for (unsigned s = 0; s < 64; ++s) {
+        int32_t cur = bin;
+        uint32_t b = best;
+        for (int k = kStride - 1; k >= 0 && cur >= 0; --k) {
+          cur = bin_[cur].child[(s >> k) & 1u];
+          if (cur >= 0 && bin_[cur].route)
+            b = bin_[cur].route;
+        }
+        childBin[s] = cur >= 0 && hasChildren(cur) ? cur : -1;
+        result[s] = b;
+      }
+
+      RouteLookupTable::Node node;
+      node.base0 = static_cast<uint32_t>(out_.leaves.size());
+      bool first = true;
+      uint32_t prev = 0;
+      for (unsigned s = 0; s < 64; ++s) {
+        if (childBin[s] >= 0) {
+          node.vector |= uint64_t(1) << s;
+          continue;
+        }
+        if (first || result[s] != prev) {
+          node.leafvec |= uint64_t(1) << s;
+          out_.leaves.push_back(result[s]);
+          prev = result[s];
+          first = false;
+        }
+      }
+      node.base1 = static_cast<uint32_t>(out_.nodes.size());
+      out_.nodes.resize(out_.nodes.size() + std::popcount(node.vector));
+      out_.nodes[ni] = node;
+
+      uint32_t rank = 0;
+      for (unsigned s = 0; s < 64; ++s) {
+        if (childBin[s] >= 0)
+          fill(node.base1 + rank++, childBin[s], result[s]);
+      }
+    }
+
+    const std::vector<RouteConfig> &routes_;
+    RouteLookupTable::Trie &out_;
+    std::vector<BinNode> bin_;
+  };
+
+  template <typename K>
+  uint32_t find(const RouteLookupTable::Trie &t, K key) {
+    uint32_t top = static_cast<uint32_t>(key >> (kWidth<K> - kDirectBits));
+    uint32_t e = t.direct[top];
+    if (!(e & kNodeBit))
+      return e;
+    const RouteLookupTable::Node *n = &t.nodes[e & ~kNodeBit];
+    for (int off = kDirectBits;; off += kStride) {
+      unsigned s = slotAt(key, off);
+      uint64_t bit = uint64_t(1) << s;
+      if (n->vector & bit) {
+        n = &t.nodes[n->base1 + std::popcount(n->vector & (bit - 1))];
+        continue;
+      }
+      uint64_t upto = ~uint64_t(0) >> (63 - s);
+      return t.leaves[n->base0 + std::popcount(n->leafvec & upto) - 1];
+    }
+  }
+
+  uint64_t keyV4(const IPPrefix &p) { return uint64_t(p.v4Value()) << 32; }
+
+} // namespace
+
+RouteLookupTable::RouteLookupTable(std::vector<RouteConfig> routes)
+    : routes_(std::move(routes)) {
+  TrieBuilder<uint64_t> b4(routes_, v4_);
+  TrieBuilder<unsigned __int128> b6(routes_, v6_);
+  for (uint32_t i = 0; i < routes_.size(); ++i) {
+    const IPPrefix &p = routes_[i].prefix;
+    if (p.isV4())
+      b4.insert(keyV4(p), p.length(), i);
+    else if (p.isV6())
+      b6.insert(p.v6Value(), p.length(), i);
+  }
+  b4.build();
+  b6.build();
+}
+
+const RouteConfig *RouteLookupTable::lookup(const IPPrefix &addr) const {
+  uint32_t r = 0;
+  if (addr.isV4() && !v4_.direct.empty())
+    r = find(v4_, keyV4(addr));
+  else if (addr.isV6() && !v6_.direct.empty())
+    r = find(v6_, addr.v6Value());
+  return r ? &routes_[r - 1] : nullptr;
+}
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file RouteTable.cpp
+ * @brief Columnar route table storage
+ */
+
+#include "RouteTable.hpp"
+#include "ConfigurationManager.hpp"
+#include <cstring>
+
+RouteTable::RouteTable(const std::vector<RouteConfig> &routes) {
+  reserve(routes.size());
+  for (const auto &rc : routes)
+    push_back(rc);
+}
+
+void RouteTable::reserve(size_t n) {
+  dst_.reserve(n);
+  family_.reserve(n);
+  length_.reserve(n);
+  bits_.reserve(n);
+  protocol_.reserve(n);
+  table_.reserve(n);
+  flags_.reserve(n);
+  nexthop_.reserve(n);
+  iface_.reserve(n);
+  mtu_.reserve(n);
+  extra_.reserve(n);
+}
+
+size_t RouteTable::append(const IPPrefix &prefix) {
+  size_t row = size();
+  dst_.push_back(prefix.bytes());
+  family_.push_back(prefix.isV6() ? 6 : prefix.isV4() ? 4 : 0);
+  length_.push_back(prefix.length());
+  bits_.push_back(0);
+  protocol_.push_back(0);
+  table_.push_back(0);
+  flags_.push_back(0);
+  nexthop_.push_back(0);
+  iface_.push_back(InterfaceNames::kNone);
+  mtu_.push_back(0);
+  extra_.push_back(0);
+  return row;
+}
+
+size_t RouteTable::push_back(const RouteConfig &rc) {
+  size_t row = append(rc.prefix);
+  assign(row, rc);
+  return row;
+}
+
+size_t RouteTable::push_back(const RouteTable &other, size_t row) {
+  size_t r = append(other.prefix(row));
+  setNexthop(r, other.nexthop(row));
+  iface_[r] = other.iface_[row];
+  bits_[r] = other.bits_[row];
+  protocol_[r] = other.protocol_[row];
+  table_[r] = other.table_[row];
+  flags_[r] = other.flags_[row];
+  mtu_[r] = other.mtu_[row];
+  if (const Extra *src = other.extra(row)) {
+    // Re-intern the strings: each table has its own pool.
+    Extra &e = ensureExtra(r);
+    e = *src;
+    auto copy = [&](uint32_t id) {
+      auto s = other.lookup(id);
+      return s ? intern(*s) : 0;
+    };
+    e.nexthopGroup = copy(src->nexthopGroup);
+    e.scope = copy(src->scope);
+    e.ifa = copy(src->ifa);
+    e.ifp = copy(src->ifp);
+    e.gatewayHw = copy(src->gatewayHw);
+    e.author = copy(src->author);
+    e.brd = copy(src->brd);
+  }
+  return r;
+}
+
+void RouteTable::assign(size_t row, const RouteConfig &rc) {
+  const IPPrefix &p = rc.prefix;
+  dst_[row] = p.bytes();
+  family_[row] = p.isV6() ? 6 : p.isV4() ? 4 : 0;
+  length_[row] = p.length();
+  bits_[row] = 0;
+  setNexthop(row, rc.nexthop);
+  iface_[row] = InterfaceNames::kNone;
+  if (rc.iface)
+    setInterface(row, *rc.iface);
+  setVrf(row, rc.vrf);
+  if (rc.blackhole)
+    bits_[row] |= kBlackhole;
+  if (rc.reject)
+    bits_[row] |= kReject;
+  flags_[row] = rc.flags;
+  setProtocol(row, rc.protocol);
+  mtu_[row] = static_cast<uint32_t>(rc.rmx_mtu);
+
+  std::array<unsigned long, 7> rmx = {
+      rc.rmx_hopcount, rc.rmx_rtt,      rc.rmx_rttvar, rc.rmx_recvpipe,
+      rc.rmx_sendpipe, rc.rmx_ssthresh, rc.rmx_pksent};
+  bool rare = rc.nexthop_group || rc.gateway_link || rc.scope ||
+              rc.expire || rc.iface_index || rc.ifa || rc.ifp ||
+              rc.gateway_hw || rc.author || rc.brd ||
+              rmx != std::array<unsigned long, 7>{};
+  if (!rare) {
+    // A replaced row's old side entry is simply left unreferenced.
+    extra_[row] = 0;
+    return;
+  }
+  Extra &e = ensureExtra(row);
+  e.nexthopGroup = internOptional(rc.nexthop_group);
+  e.scope = internOptional(rc.scope);
+  e.ifa = internOptional(rc.ifa);
+  e.ifp = internOptional(rc.ifp);
+  e.gatewayHw = internOptional(rc.gateway_hw);
+  e.author = internOptional(rc.author);
+  e.brd = internOptional(rc.brd);
+  e.gatewayLink = rc.gateway_link;
+  e.expire = rc.expire;
+  e.ifaceIndex = rc.iface_index;
+  e.rmx = rmx;
+}
+
+void RouteTable::setNexthop(size_t row,
+                            const std::optional<IPPrefix> &nexthop) {
+  if (!nexthop) {
+    nexthop_[row] = 0;
+    return;
+  }
+  auto [it, inserted] = nexthopIds_.try_emplace(
+      *nexthop, static_cast<uint32_t>(nexthops_.size() + 1));
+  if (inserted)
+    nexthops_.push_back(*nexthop);
+  nexthop_[row] = it->second;
+}
+
+void RouteTable::setInterface(size_t row, std::string_view name) {
+  iface_[row] = InterfaceNames::instance().intern(name);
+}
+
+void RouteTable::setVrf(size_t row, std::optional<int> vrf) {
+  table_[row] = vrf.value_or(0);
+  if (vrf)
+    bits_[row] |= kHasVrf;
+  else
+    bits_[row] &= static_cast<uint8_t>(~kHasVrf);
+}
+
+void RouteTable::setNexthopGroup(size_t row, std::string_view group) {
+  ensureExtra(row).nexthopGroup = intern(group);
+}
+
+IPPrefix RouteTable::prefix(size_t row) const {
+  const auto &b = dst_[row];
+  if (family_[row] == 6)
+    return IPPrefix::v6Bytes(b.data(), length_[row]);
+  if (family_[row] == 4)
+    return IPPrefix::v4((uint32_t(b[0]) << 24) | (uint32_t(b[1]) << 16) |
+                            (uint32_t(b[2]) << 8) | uint32_t(b[3]),
+                        length_[row]);
+  return IPPrefix{};
+}
+
+std::optional<IPPrefix> RouteTable::nexthop(size_t row) const {
+  if (!nexthop_[row])
+    return std::nullopt;
+  return nexthops_[nexthop_[row] - 1];
+}
+
+std::optional<int> RouteTable::vrf(size_t row) const {
+  if (!(bits_[row] & kHasVrf))
+    return std::nullopt;
+  return table_[row];
+}
+
+std::optional<std::string_view> RouteTable::nexthopGroup(size_t row) const {
+  const Extra *e = extra(row);
+  return e ? lookup(e->nexthopGroup) : std::nullopt;
+}
+
+std::optional<int> RouteTable::gatewayLink(size_t row) const {
+  const Extra *e = extra(row);
+  return e ? e->gatewayLink : std::nullopt;
+}
+
+std::optional<std::string_view> RouteTable::scope(size_t row) const {
+  const Extra *e = extra(row);
+  return e ? lookup(e->scope) : std::nullopt;
+}
+
+std::optional<std::string_view> RouteTable::author(size_t row) const {
+  const Extra *e = extra(row);
+  return e ? lookup(e->author) : std::nullopt;
+}
+
+std::optional<int> RouteTable::expire(size_t row) const {
+  const Extra *e = extra(row);
+  return e ? e->expire : std::nullopt;
+}
+
+RouteConfig RouteTable::at(size_t row) const {
+  RouteConfig rc;
+  rc.prefix = prefix(row);
+  rc.nexthop = nexthop(row);
+  if (iface_[row] != InterfaceNames::kNone)
+    rc.iface = InterfaceNames::instance().name(iface_[row]);
+  rc.vrf = vrf(row);
+  rc.blackhole = blackhole(row);
+  rc.reject = reject(row);
+  rc.flags = flags_[row];
+  rc.protocol = protocol(row);
+  rc.rmx_mtu = mtu_[row];
+  if (const Extra *e = extra(row)) {
+    auto str = [&](uint32_t id) -> std::optional<std::string> {
+      if (auto s = lookup(id))
+        return std::string(*s);
+      return std::nullopt;
+    };
+    rc.nexthop_group = str(e->nexthopGroup);
+    rc.scope = str(e->scope);
+    rc.ifa = str(e->ifa);
+    rc.ifp = str(e->ifp);
+    rc.gateway_hw = str(e->gatewayHw);
+    rc.author = str(e->author);
+    rc.brd = str(e->brd);
+    rc.gateway_link = e->gatewayLink;
+    rc.expire = e->expire;
+    rc.iface_index = e->ifaceIndex;
+    rc.rmx_hopcount = e->rmx[0];
+    rc.rmx_rtt = e->rmx[1];
+    rc.rmx_rttvar = e->rmx[2];
+    rc.rmx_recvpipe = e->rmx[3];
+    rc.rmx_sendpipe = e->rmx[4];
+    rc.rmx_ssthresh = e->rmx[5];
+    rc.rmx_pksent = e->rmx[6];
+  }
+  return rc;
+}
+
+std::vector<RouteConfig> RouteTable::toVector() const {
+  std::vector<RouteConfig> out;
+  out.reserve(size());
+  for (size_t row = 0; row < size(); ++row)
+    out.push_back(at(row));
+  return out;
+}
+
+size_t RouteTable::memoryUsage() const {
+  size_t bytes = dst_.capacity() * sizeof(dst_[0]) + family_.capacity() +
+                 length_.capacity() + bits_.capacity() +
+                 protocol_.capacity() +
+                 table_.capacity() * sizeof(int32_t) +
+                 (flags_.capacity() + nexthop_.capacity() +
+                  mtu_.capacity() + extra_.capacity()) *
+                     sizeof(uint32_t) +
+                 iface_.capacity() * sizeof(InterfaceId);
+  bytes += nexthops_.capacity() * sizeof(IPPrefix) +
+           nexthopIds_.size() * (sizeof(IPPrefix) + 2 * sizeof(void *));
+  bytes += extras_.capacity() * sizeof(Extra);
+  for (const auto &s : strings_)
+    bytes += sizeof(s) + s.capacity();
+  return bytes;
+}
+
+RouteTable::Extra *RouteTable::extra(size_t row) {
+  return extra_[row] ? &extras_[extra_[row] - 1] : nullptr;
+}
+
+const RouteTable::Extra *RouteTable::extra(size_t row) const {
+  return extra_[row] ? &extras_[extra_[row] - 1] : nullptr;
+}
+
+RouteTable::Extra &RouteTable::ensureExtra(size_t row) {
+  if (!extra_[row]) {
+    extras_.emplace_back();
+    extra_[row] = static_cast<uint32_t>(extras_.size());
+  }
+  return extras_[extra_[row] - 1];
+}
+
+uint32_t RouteTable::intern(std::string_view s) {
+  auto [it, inserted] = stringIds_.try_emplace(
+      std::string(s), static_cast<uint32_t>(strings_.size() + 1));
+  if (inserted)
+    strings_.push_back(it->first);
+  return it->second;
+}
+
+uint32_t RouteTable::internOptional(const std::optional<std::string> &s) {
+  return s ? intern(*s) : 0;
+}
+
+std::optional<std::string_view> RouteTable::lookup(uint32_t id) const {
+  if (!id)
+    return std::nullopt;
+  return std::string_view(strings_[id - 1]);
+}
+
+RouteTable
+ConfigurationManager::GetRouteTable(const std::optional<VRFConfig> &vrf) const {
+  return RouteTable(GetRoutes(vrf));
+}
@@ -27,19 +27,18 @@
 
 #include "CommandDispatcher.hpp"
 #include "ArpToken.hpp"
-#include "DeleteToken.hpp"
 #include "InterfaceToken.hpp"
 #include "NdpToken.hpp"
 #include "PolicyToken.hpp"
 #include "RouteToken.hpp"
-#include "SetToken.hpp"
-#include "ShowToken.hpp"
 #include "Socket.hpp"
 #include "VRFToken.hpp"
 #ifdef STELLERI_NETCONF
 #include "CommitToken.hpp"
 #include "TargetToken.hpp"
 #endif
+#include <array>
+#include <iostream>
 
 namespace netcli {
 
@@ -69,57 +68,58 @@ namespace netcli {
   void executeSetPolicy(const PolicyToken &, ConfigurationManager *);
   void executeDeletePolicy(const PolicyToken &, ConfigurationManager *);
 
-  // Helper: wrap a typed handler into the type-erased Handler signature.
-  template <typename TokenT>
-  static Handler wrap(void (*fn)(const TokenT &, ConfigurationManager *)) {
-    return [fn](const Token &tok, ConfigurationManager *mgr) {
-      fn(static_cast<const TokenT &>(tok), mgr);
-    };
-  }
-
-  CommandDispatcher::CommandDispatcher() { registerDefaults(); }
-
-  void CommandDispatcher::registerDefaults() {
-    // Interface handlers
-    registerHandler<InterfaceToken>(Verb::Show, wrap(&executeShowInterface));
-    registerHandler<InterfaceToken>(Verb::Set, wrap(&executeSetInterface));
-    registerHandler<InterfaceToken>(Verb::Delete,
-                                    wrap(&executeDeleteInterface));
-
-    // Route handlers
-    registerHandler<RouteToken>(Verb::Show, wrap(&executeShowRoute));
-    registerHandler<RouteToken>(Verb::Set, wrap(&executeSetRoute));
-    registerHandler<RouteToken>(Verb::Delete, wrap(&executeDeleteRoute));
-
-    // VRF handlers
-    registerHandler<VRFToken>(Verb::Show, wrap(&executeShowVRF));
-    registerHandler<VRFToken>(Verb::Set, wrap(&executeSetVRF));
-    registerHandler<VRFToken>(Verb::Delete, wrap(&executeDeleteVRF));
+#ifdef STELLERI_NETCONF
+  void executeTarget(const TargetToken &, ConfigurationManager *);
+  void executeCommit(const CommitToken &, ConfigurationManager *);
+#endif
 
-    // ARP handlers
-    registerHandler<ArpToken>(Verb::Show, wrap(&executeShowArp));
-    registerHandler<ArpToken>(Verb::Set, wrap(&executeSetArp));
-    registerHandler<ArpToken>(Verb::Delete, wrap(&executeDeleteArp));
+  namespace {
+    // Adapt a typed handler to the table's Handler signature.
+    template <typename TokenT,
+              void (*Fn)(const TokenT &, ConfigurationManager *)>
+    void call(const Token &tok, ConfigurationManager *mgr) {
+      Fn(static_cast<const TokenT &>(tok), mgr);
+    }
 
-    // NDP handlers
-    registerHandler<NdpToken>(Verb::Show, wrap(&executeShowNdp));
-    registerHandler<NdpToken>(Verb::Set, wrap(&executeSetNdp));
-    registerHandler<NdpToken>(Verb::Delete, wrap(&executeDeleteNdp));
+    using Row = std::array<Handler, 3>; // indexed by Verb
 
-    // Policy handlers
-    registerHandler<PolicyToken>(Verb::Show, wrap(&executeShowPolicy));
-    registerHandler<PolicyToken>(Verb::Set, wrap(&executeSetPolicy));
-    registerHandler<PolicyToken>(Verb::Delete, wrap(&executeDeletePolicy));
+    template <typename TokenT,
+              void (*Show)(const TokenT &, ConfigurationManager *),
+              void (*Set)(const TokenT &, ConfigurationManager *),
+              void (*Delete)(const TokenT &, ConfigurationManager *)>
+    constexpr Row row() {
+      return {call<TokenT, Show>, call<TokenT, Set>, call<TokenT, Delete>};
+    }
 
+    constexpr auto kHandlers = [] {
+      std::array<Row, size_t(TokenKind::Count)> t{};
+      t[size_t(TokenKind::Interface)] =
+          row<InterfaceToken, executeShowInterface, executeSetInterface,
+              executeDeleteInterface>();
+      t[size_t(TokenKind::Route)] =
+          row<RouteToken, executeShowRoute, executeSetRoute,
+              executeDeleteRoute>();
+      t[size_t(TokenKind::VRF)] =
+          row<VRFToken, executeShowVRF, executeSetVRF, executeDeleteVRF>();
+      t[size_t(TokenKind::Arp)] =
+          row<ArpToken, executeShowArp, executeSetArp, executeDeleteArp>();
+      t[size_t(TokenKind::Ndp)] =
+          row<NdpToken, executeShowNdp, executeSetNdp, executeDeleteNdp>();
+      t[size_t(TokenKind::Policy)] =
+          row<PolicyToken, executeShowPolicy, executeSetPolicy,
+              executeDeletePolicy>();
 #ifdef STELLERI_NETCONF
-    // NETCONF-specific handlers
-    // Forward declarations in this file; implementations in
-    // ExecuteTarget.cpp/ExecuteCommit.cpp
-    extern void executeTarget(const TargetToken &, ConfigurationManager *);
-    extern void executeCommit(const CommitToken &, ConfigurationManager *);
-    registerHandler<TargetToken>(Verb::Set, wrap(&executeTarget));
-    registerHandler<CommitToken>(Verb::Set, wrap(&executeCommit));
+      t[size_t(TokenKind::Target)][size_t(Verb::Set)] =
+          call<TargetToken, executeTarget>;
+      t[size_t(TokenKind::Commit)][size_t(Verb::Set)] =
+          call<CommitToken, executeCommit>;
 #endif
+      return t;
+    }();
+  } // namespace
+
+  Handler CommandDispatcher::handler(Verb verb, TokenKind object) {
+    return kHandlers[size_t(object)][size_t(verb)];
   }
 
   void CommandDispatcher::dispatch(const std::shared_ptr<Token> &head,
@@ -129,13 +129,17 @@ namespace netcli {
 
     // Identify the verb from the head token.
     Verb verb;
-    if (dynamic_cast<ShowToken *>(head.get()))
+    switch (head->kind()) {
+    case TokenKind::Show:
       verb = Verb::Show;
-    else if (dynamic_cast<SetToken *>(head.get()))
+      break;
+    case TokenKind::Set:
       verb = Verb::Set;
-    else if (dynamic_cast<DeleteToken *>(head.get()))
+      break;
+    case TokenKind::Delete:
       verb = Verb::Delete;
-    else {
+      break;
+    default:
       std::cerr << "execute: unknown or unsupported command\n";
       return;
     }
@@ -146,17 +150,14 @@ namespace netcli {
       return;
     }
 
-    // Look up the handler by (verb, target token type).
-    const Token &ref = *next;
-    Key key{verb, std::type_index(typeid(ref))};
-    auto it = handlers_.find(key);
-    if (it == handlers_.end()) {
+    Handler fn = handler(verb, next->kind());
+    if (!fn) {
       std::cerr << head->toString() << ": unknown object type\n";
       return;
     }
 
     try {
-      it->second(*next, mgr);
+      fn(*next, mgr);
     } catch (const SocketException &e) {
       std::cerr << "socket error: " << e.what() << "\n";
     }
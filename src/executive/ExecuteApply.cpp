@@ -0,0 +1,564 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ConfigurationApply.hpp"
+#include "ArpToken.hpp"
+#include "CommandDispatcher.hpp"
+#include "CommandGenerator.hpp"
+#include "InterfaceNames.hpp"
+#include "InterfaceToken.hpp"
+#include "NdpToken.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "Parser.hpp"
+#include "PolicyToken.hpp"
+#include "RouteDiff.hpp"
+#include "RouteToken.hpp"
+#include "ScriptFile.hpp"
+#include "VRFToken.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+namespace netcli {
+
+  namespace {
+
+    void applyUsage() {
+      std::cerr << "Usage: net apply [--routes-only] [-n|--dry-run] FILE|-\n";
+    }
+
+    // Object types in dependency order: everything a later type may refer
+    // to is created first and deleted last.
+    enum class Kind { VRF, Interface, Route, Arp, Ndp, Policy, Count };
+
+    constexpr std::array<const char *, size_t(Kind::Count)> kKindNames = {
+        "vrf", "interface", "route", "arp", "ndp", "policy"};
+
+    struct Tally {
+      size_t unchanged = 0, add = 0, change = 0, remove = 0;
+    };
+
+    // One change to the running system.
+    struct Step {
+      char mark; ///< '+' add, '~' change, '-' delete
+      std::string text;
+      std::function<void()> run;
+    };
+
+    struct Plan {
+      std::array<std::vector<Step>, size_t(Kind::Count)> sets, deletes;
+      std::array<Tally, size_t(Kind::Count)> tally;
+      int status = 0;
+
+      void add(Kind k, char mark, std::string text, std::function<void()> fn) {
+        auto &t = tally[size_t(k)];
+        (mark == '+' ? t.add : mark == '~' ? t.change : t.remove)++;
+        auto &v = mark == '-' ? deletes[size_t(k)] : sets[size_t(k)];
+        v.push_back({mark, std::move(text), std::move(fn)});
+      }
+      void same(Kind k) { tally[size_t(k)].unchanged++; }
+    };
+
+    // One line of the input as the parse workers leave it.
+    struct ParsedLine {
+      size_t lineno;
+      std::string text;            ///< whitespace-normalised command
+      std::shared_ptr<Token> head; ///< null when the line did not parse
+      std::optional<RouteConfig> route; ///< `set route`, converted
+    };
+
+    // A parsed `set` line of the input.
+    struct DesiredLine {
+      size_t lineno;
+      std::string text; ///< whitespace-normalised command
+      std::shared_ptr<Token> head;
+    };
+
+    std::string join(const std::vector<std::string_view> &tokens) {
+      std::string out;
+      for (const auto &t : tokens) {
+        if (!out.empty())
+          out += ' ';
+        out += t;
+      }
+      return out;
+    }
+
+    std::string ipKey(const std::string &ip) {
+      auto p = IPPrefix::fromString(ip);
+      return p ? p->addressString() : ip;
+    }
+
+    bool sameMac(const std::string &a, const std::string &b) {
+      return a.size() == b.size() &&
+             std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return std::tolower(static_cast<unsigned char>(x)) ==
+                      std::tolower(static_cast<unsigned char>(y));
+             });
+    }
+
+    // Everything the diff compares against, read once up front.
+    struct LiveState {
+      std::unordered_set<std::string> lines; ///< `net -g` output
+      std::unordered_set<InterfaceId> interfaces;
+      std::map<int, VRFConfig> vrfs;
+      std::map<std::string, ArpConfig> arp; ///< permanent entries only
+      std::map<std::string, NdpConfig> ndp; ///< permanent entries only
+      std::map<uint32_t, PolicyConfig> policies;
+      std::vector<NexthopGroupConfig> groups;
+
+      void snapshot(ConfigurationManager &mgr, const Parser &parser,
+                    bool routesOnly) {
+        groups = mgr.GetNexthopGroups();
+        if (routesOnly)
+          return;
+
+        // Interfaces have too many per-type attributes to compare field by
+        // field, so they are compared as the canonical lines `net -g`
+        // emits for them.
+        std::ostringstream buf;
+        CommandGenerator().generateInterfaces(mgr, buf);
+        std::istringstream in(buf.str());
+        std::string line, scratch;
+        while (std::getline(in, line))
+          lines.insert(join(parser.tokenize(line, scratch)));
+
+        for (const auto &ifc : mgr.GetInterfaces())
+          interfaces.insert(InterfaceNames::instance().intern(ifc.name));
+        for (auto &v : mgr.GetVrfs())
+          vrfs.emplace(v.table, v);
+        for (auto &e : mgr.GetArpEntries())
+          if (e.permanent)
+            arp.emplace(e.ip.addressString(), e);
+        for (auto &e : mgr.GetNdpEntries())
+          if (e.permanent)
+            ndp.emplace(e.ip.addressString(), e);
+        for (auto &p : mgr.GetPolicies())
+          policies.emplace(p.access_list.id, p);
+      }
+    };
+
+    bool sameGroup(const NexthopGroupConfig &live,
+                   const NexthopGroupConfig &want) {
+      if (live.members.size() != want.members.size())
+        return false;
+      auto key = [](const NexthopGroupMember &m) {
+        return std::make_pair(m.gateway, m.weight);
+      };
+      auto a = live.members, b = want.members;
+      auto byKey = [&](const auto &x, const auto &y) {
+        return key(x) < key(y);
+      };
+      std::sort(a.begin(), a.end(), byKey);
+      std::sort(b.begin(), b.end(), byKey);
+      for (size_t i = 0; i < a.size(); ++i) {
+        if (key(a[i]) != key(b[i]))
+          return false;
+        if (b[i].iface && a[i].iface != b[i].iface)
+          return false;
+      }
+      return true;
+    }
+
+    template <typename Fn>
+    std::function<void()> guarded(Plan &plan, std::string what, Fn fn) {
+      return [&plan, what = std::move(what), fn = std::move(fn)] {
+        try {
+          fn();
+        } catch (const std::exception &e) {
+          std::cerr << "apply: " << what << " failed: " << e.what() << "\n";
+          plan.status = 1;
+        }
+      };
+    }
+
+    void planRoutes(std::vector<RouteConfig> desired,
+                    std::vector<NexthopGroupConfig> groups,
+                    const LiveState &live, ConfigurationManager &mgr,
+                    Plan &plan) {
+      // One snapshot of every table the file mentions (plus the main one).
+      std::set<int> tables{0};
+      for (const auto &r : desired)
+        tables.insert(r.vrf.value_or(0));
+      // Only rows the backend reports in table t count as live there: a
+      // backend that cannot list a VRF returns its main table instead, and
+      // those routes must not be planned for deletion from the VRF.
+      RouteTable current;
+      for (int t : tables) {
+        auto routes = t == 0 ? mgr.GetRouteTable()
+                             : mgr.GetRouteTable(VRFConfig(t));
+        for (size_t row = 0; row < routes.size(); ++row)
+          if (routes.table(row) == t)
+            current.push_back(routes, row);
+      }
+
+      // Nexthop groups first: routes may reference them.
+      for (auto &g : groups) {
+        auto it = std::find_if(
+            live.groups.begin(), live.groups.end(),
+            [&](const auto &lg) {
+              return NexthopGroupConfig::sameId(lg.name, g.name);
+            });
+        if (it != live.groups.end() && sameGroup(*it, g))
+          continue;
+        std::string text = "set " + RouteToken::toString(&g);
+        plan.add(Kind::Route, it == live.groups.end() ? '+' : '~', text,
+                 guarded(plan, "nexthop-group " + g.name,
+                         [&mgr, g] { g.save(mgr); }));
+      }
+
+      RouteDiff diff = RouteDiff::compute(std::move(desired), current);
+      plan.tally[size_t(Kind::Route)].unchanged += diff.unchanged;
+      for (auto &r : diff.add) {
+        plan.add(Kind::Route, '+', "set " + RouteToken::toString(&r),
+                 guarded(plan, "add route " + r.prefix.toString(),
+                         [&mgr, r] { r.save(mgr); }));
+      }
+      for (auto &[was, want] : diff.replace) {
+        plan.add(Kind::Route, '~',
+                 "set " + RouteToken::toString(&want) +
+                     "\n    (was: " + RouteToken::toString(&was) + ")",
+                 guarded(plan, "replace route " + want.prefix.toString(),
+                         [&mgr, was, want] { mgr.ReplaceRoute(was, want); }));
+      }
+      for (auto &r : diff.remove) {
+        plan.add(Kind::Route, '-', "delete " + RouteToken::toString(&r),
+                 guarded(plan, "delete route " + r.prefix.toString(),
+                         [&mgr, r] { r.destroy(mgr); }));
+      }
+    }
+
+    // Neighbour entries (ARP and NDP) share everything but the manager
+    // calls; Set/Del wrap those.
+    template <typename TokT, typename CfgT, typename SetFn, typename DelFn>
+    void planNeighbours(Kind kind, const std::vector<DesiredLine> &lines,
+                        const std::map<std::string, CfgT> &live, Plan &plan,
+                        SetFn set, DelFn del) {
+      std::set<std::string> wanted;
+      for (const auto &d : lines) {
+        const auto &tok = static_cast<const TokT &>(*d.head->getNext());
+        std::string key = ipKey(tok.ip());
+        wanted.insert(key);
+        auto it = live.find(key);
+        if (it != live.end() && tok.mac && sameMac(it->second.mac, *tok.mac) &&
+            !tok.temp && (!tok.iface || it->second.iface == tok.iface)) {
+          if constexpr (std::is_same_v<TokT, ArpToken>) {
+            if (it->second.published == tok.pub) {
+              plan.same(kind);
+              continue;
+            }
+          } else {
+            plan.same(kind);
+            continue;
+          }
+        }
+        plan.add(kind, it == live.end() ? '+' : '~', d.text,
+                 guarded(plan, d.text, [&tok, set] {
+                   if (!tok.mac || !set(tok))
+                     throw std::runtime_error("kernel rejected entry");
+                 }));
+      }
+      for (const auto &[key, cfg] : live) {
+        if (wanted.count(key))
+          continue;
+        std::string text = std::string("delete ") + kKindNames[size_t(kind)] +
+                           " ip " + key;
+        plan.add(kind, '-', text, guarded(plan, text, [cfg, del] {
+                   if (!del(cfg))
+                     throw std::runtime_error("kernel rejected delete");
+                 }));
+      }
+    }
+
+    void planPolicies(const std::vector<DesiredLine> &lines,
+                      const LiveState &live, const CommandDispatcher &disp,
+                      ConfigurationManager &mgr, Plan &plan) {
+      std::set<std::pair<uint32_t, uint32_t>> wanted;
+      std::set<uint32_t> wantedAcls;
+      for (const auto &d : lines) {
+        const auto &tok =
+            static_cast<const PolicyToken &>(*d.head->getNext());
+        if (!tok.acl_id)
+          continue;
+        wantedAcls.insert(*tok.acl_id);
+        if (tok.rule_seq)
+          wanted.emplace(*tok.acl_id, *tok.rule_seq);
+        auto acl = live.policies.find(*tok.acl_id);
+        const PolicyAccessListRule *rule = nullptr;
+        if (acl != live.policies.end() && tok.rule_seq) {
+          for (const auto &r : acl->second.access_list.rules)
+            if (r.seq == *tok.rule_seq)
+              rule = &r;
+        }
+        bool same = acl != live.policies.end() &&
+                    (!tok.rule_seq ||
+                     (rule && rule->action == tok.action.value_or("permit") &&
+                      rule->source == tok.source &&
+                      rule->destination == tok.destination &&
+                      rule->protocol == tok.protocol));
+        if (same) {
+          plan.same(Kind::Policy);
+          continue;
+        }
+        plan.add(Kind::Policy, rule || acl != live.policies.end() ? '~' : '+',
+                 d.text, guarded(plan, d.text, [&disp, &mgr, head = d.head] {
+                   disp.dispatch(head, &mgr);
+                 }));
+      }
+      for (const auto &[id, pc] : live.policies) {
+        PolicyConfig gone;
+        gone.policy_type = PolicyConfig::Type::AccessList;
+        gone.access_list.id = id;
+        if (!wantedAcls.count(id)) {
+          std::string text =
+              "delete policy access-list " + std::to_string(id);
+          plan.add(Kind::Policy, '-', text,
+                   guarded(plan, text, [&mgr, gone] { gone.destroy(mgr); }));
+          continue;
+        }
+        for (const auto &r : pc.access_list.rules) {
+          if (wanted.count({id, r.seq}))
+            continue;
+          gone.access_list.rules = {r};
+          std::string text = "delete policy access-list " +
+                             std::to_string(id) + " rule " +
+                             std::to_string(r.seq);
+          plan.add(Kind::Policy, '-', text,
+                   guarded(plan, text, [&mgr, gone] { gone.destroy(mgr); }));
+        }
+      }
+    }
+
+  } // namespace
+
+  bool parseApplyOptions(int argc, char *argv[], ApplyOptions &opts) {
+    struct option longopts[] = {{"routes-only", no_argument, nullptr, 'r'},
+                                {"diff", no_argument, nullptr, 'd'},
+                                {"dry-run", no_argument, nullptr, 'n'},
+                                {"help", no_argument, nullptr, 'h'},
+                                {0, 0, 0, 0}};
+    optind = 1;
+    int ch;
+    while ((ch = getopt_long(argc, argv, "nh", longopts, nullptr)) != -1) {
+      switch (ch) {
+      case 'r':
+        opts.routesOnly = true;
+        break;
+      case 'd':
+        // Diffing is the only mode; accepted for older scripts.
+        break;
+      case 'n':
+        opts.dryRun = true;
+        break;
+      default:
+        applyUsage();
+        return false;
+      }
+    }
+    if (optind + 1 != argc) {
+      applyUsage();
+      return false;
+    }
+    opts.file = argv[optind];
+    return true;
+  }
+
+  int executeApply(const ApplyOptions &opts, ConfigurationManager &mgr) {
+    // Parse the whole file before touching anything. Tokenizing, parsing
+    // and route conversion run on a worker pool, chunk by chunk.
+    std::vector<ParsedLine> parsed;
+    try {
+      ScriptFile script(opts.file);
+      parsed = script.map([](ScriptFile::Line &l) {
+        ParsedLine p{l.lineno, join(l.tokens), nullptr, std::nullopt};
+        if (!l.cmd || !l.cmd->head())
+          return p;
+        p.head = l.cmd->head();
+        const Token *target = p.head->getNext().get();
+        if (p.head->kind() == TokenKind::Set && target &&
+            target->kind() == TokenKind::Route) {
+          const auto &rt = static_cast<const RouteToken &>(*target);
+          if (!rt.isNexthopGroup())
+            p.route = rt.toConfig();
+        }
+        return p;
+      });
+    } catch (const std::exception &e) {
+      std::cerr << "apply: " << e.what() << "\n";
+      return 1;
+    }
+
+    Parser parser;
+    Plan plan;
+    // Routes are reduced to RouteConfig straight away; the other kinds
+    // keep their parsed command for the executor that applies them.
+    std::array<std::vector<DesiredLine>, size_t(Kind::Count)> byKind;
+    std::vector<RouteConfig> routes;
+    std::vector<NexthopGroupConfig> groups;
+    for (auto &p : parsed) {
+      size_t lineno = p.lineno;
+      if (!p.head || !p.head->getNext()) {
+        std::cerr << "apply: line " << lineno << ": invalid command\n";
+        plan.status = 1;
+        continue;
+      }
+      if (p.head->kind() != TokenKind::Set) {
+        std::cerr << "apply: line " << lineno
+                  << ": only `set` commands describe a configuration, "
+                     "ignored\n";
+        continue;
+      }
+      Token *target = p.head->getNext().get();
+      std::optional<Kind> kind;
+      if (target->kind() == TokenKind::Route) {
+        auto *rt = static_cast<RouteToken *>(target);
+        if (rt->isNexthopGroup()) {
+          NexthopGroupConfig ng;
+          ng.name = *rt->group_name;
+          ng.members = rt->group_members;
+          groups.push_back(std::move(ng));
+        } else if (p.route) {
+          routes.push_back(std::move(*p.route));
+        } else {
+          std::cerr << "apply: line " << lineno << ": invalid route\n";
+          plan.status = 1;
+        }
+        continue;
+      } else if (opts.routesOnly) {
+        continue;
+      } else if (target->kind() == TokenKind::VRF) {
+        kind = Kind::VRF;
+      } else if (target->kind() == TokenKind::Interface) {
+        kind = Kind::Interface;
+      } else if (target->kind() == TokenKind::Arp) {
+        kind = Kind::Arp;
+      } else if (target->kind() == TokenKind::Ndp) {
+        kind = Kind::Ndp;
+      } else if (target->kind() == TokenKind::Policy) {
+        kind = Kind::Policy;
+      } else {
+        std::cerr << "apply: line " << lineno << ": not supported, ignored\n";
+        continue;
+      }
+      byKind[size_t(*kind)].push_back({lineno, std::move(p.text), p.head});
+    }
+    if (plan.status)
+      return plan.status;
+
+    LiveState live;
+    live.snapshot(mgr, parser, opts.routesOnly);
+    CommandDispatcher dispatcher;
+    auto dispatch = [&](const DesiredLine &d) {
+      return guarded(plan, d.text, [&dispatcher, &mgr, head = d.head] {
+        dispatcher.dispatch(head, &mgr);
+      });
+    };
+
+    // VRFs and interfaces are only ever created or changed here: neither
+    // can safely be removed just because a file does not mention it.
+    for (const auto &d : byKind[size_t(Kind::VRF)]) {
+      const auto &tok = static_cast<const VRFToken &>(*d.head->getNext());
+      auto it = live.vrfs.find(tok.table());
+      if (it != live.vrfs.end() &&
+          (tok.name().empty() || it->second.name == tok.name()))
+        plan.same(Kind::VRF);
+      else
+        plan.add(Kind::VRF, it == live.vrfs.end() ? '+' : '~', d.text,
+                 dispatch(d));
+    }
+    auto &names = InterfaceNames::instance();
+    for (const auto &d : byKind[size_t(Kind::Interface)]) {
+      const auto &tok =
+          static_cast<const InterfaceToken &>(*d.head->getNext());
+      if (live.lines.count(d.text))
+        plan.same(Kind::Interface);
+      else
+        plan.add(Kind::Interface,
+                 live.interfaces.count(names.find(tok.name())) ? '~' : '+',
+                 d.text, dispatch(d));
+    }
+
+    planRoutes(std::move(routes), std::move(groups), live, mgr, plan);
+
+    planNeighbours<ArpToken>(
+        Kind::Arp, byKind[size_t(Kind::Arp)], live.arp, plan,
+        [&mgr](const ArpToken &t) {
+          return mgr.SetArpEntry(t.ip(), *t.mac, t.iface, t.temp, t.pub);
+        },
+        [&mgr](const ArpConfig &c) {
+          return mgr.DeleteArpEntry(c.ip.addressString(), c.iface);
+        });
+    planNeighbours<NdpToken>(
+        Kind::Ndp, byKind[size_t(Kind::Ndp)], live.ndp, plan,
+        [&mgr](const NdpToken &t) {
+          return mgr.SetNdpEntry(t.ip(), *t.mac, t.iface, t.temp);
+        },
+        [&mgr](const NdpConfig &c) {
+          return mgr.DeleteNdpEntry(c.ip.addressString(), c.iface);
+        });
+
+    if (!opts.routesOnly)
+      planPolicies(byKind[size_t(Kind::Policy)], live, dispatcher, mgr, plan);
+
+    // Creations in dependency order, then deletions in reverse.
+    std::vector<Step *> order;
+    for (auto &v : plan.sets)
+      for (auto &s : v)
+        order.push_back(&s);
+    for (size_t k = plan.deletes.size(); k-- > 0;)
+      for (auto &s : plan.deletes[k])
+        order.push_back(&s);
+
+    for (const auto *s : order)
+      std::cout << s->mark << ' ' << s->text << "\n";
+    for (size_t k = 0; k < plan.tally.size(); ++k) {
+      const auto &t = plan.tally[k];
+      if (t.unchanged + t.add + t.change + t.remove == 0)
+        continue;
+      std::cout << kKindNames[k] << ": " << t.unchanged << " unchanged, "
+                << t.add << " to add, " << t.change << " to change, "
+                << t.remove << " to delete\n";
+    }
+
+    if (opts.dryRun)
+      return 0;
+    for (auto *s : order)
+      s->run();
+    return plan.status;
+  }
+
+} // namespace netcli
@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ConfigurationBatch.hpp"
+#include "ArpToken.hpp"
+#include "InterfaceToken.hpp"
+#include "NdpToken.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "Parser.hpp"
+#include "PolicyToken.hpp"
+#include "RouteTable.hpp"
+#include "RouteToken.hpp"
+#include "ScriptFile.hpp"
+#include "VRFToken.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+namespace netcli {
+
+  namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double msSince(Clock::time_point t0) {
+      return std::chrono::duration<double, std::milli>(Clock::now() - t0)
+          .count();
+    }
+
+    // Object types a command can touch, in the order the snapshot phase
+    // reads them.
+    enum class Object { Interface, Route, Group, VRF, Arp, Ndp, Policy, Count };
+
+    // Everything the undo log takes pre-images from, read once.
+    struct Live {
+      std::map<std::string, InterfaceConfig> interfaces;
+      std::map<std::string, std::vector<RouteConfig>> routes; ///< routeKey
+      std::map<uint32_t, NexthopGroupConfig> groups; ///< by kernel id
+      std::map<int, VRFConfig> vrfs;
+      std::map<std::string, ArpConfig> arp; ///< permanent entries only
+      std::map<std::string, NdpConfig> ndp; ///< permanent entries only
+      std::map<uint32_t, PolicyConfig> policies;
+    };
+
+    // How to put one object back the way it was.
+    struct Undo {
+      std::string what;
+      std::function<void()> run;
+    };
+
+    // One validated command of the script.
+    struct Op {
+      size_t lineno = 0;
+      std::string text;
+      Object object = Object::Count;
+      std::string key; ///< the touched object, unique across types
+      std::optional<RouteConfig> addRoute; ///< `set route`; sent in batches
+      std::function<void()> run;           ///< everything else; throws
+      std::function<Undo(const Live &)> undo;
+      std::string error; ///< why the line was rejected
+    };
+
+    std::string routeKey(const RouteConfig &r) {
+      return std::to_string(r.vrf.value_or(0)) + ' ' + r.prefix.toString();
+    }
+
+    std::string ipKey(const std::string &ip) {
+      auto p = IPPrefix::fromString(ip);
+      return p ? p->addressString() : ip;
+    }
+
+    // Undo steps that remove what the batch created may find nothing to
+    // remove: the failing command may never have taken effect.
+    template <typename Fn> void quietly(Fn fn) {
+      try {
+        fn();
+      } catch (const std::exception &) {
+      }
+    }
+
+    template <typename Map, typename Key>
+    std::optional<typename Map::mapped_type> before(const Map &m,
+                                                    const Key &k) {
+      auto it = m.find(k);
+      if (it == m.end())
+        return std::nullopt;
+      return it->second;
+    }
+
+    std::string makeRouteOp(const RouteToken &tok, bool set,
+                            ConfigurationManager &mgr, Op &op) {
+      if (tok.isNexthopGroup()) {
+        NexthopGroupConfig ng;
+        ng.name = *tok.group_name;
+        if (ng.name.empty())
+          return "missing nexthop-group name";
+        if (set) {
+          if (tok.group_members.empty())
+            return "nexthop-group needs at least one nexthop";
+          for (const auto &m : tok.group_members)
+            if (m.weight < 1 || m.weight > 256)
+              return "nexthop-group weight must be 1-256";
+          ng.members = tok.group_members;
+          op.run = [&mgr, ng] { ng.save(mgr); };
+        } else {
+          op.run = [&mgr, ng] { ng.destroy(mgr); };
+        }
+        // Groups are keyed by kernel id: a backend that keeps no names
+        // reads "core" back under its id.
+        uint32_t id = NexthopGroupConfig::idFromName(ng.name);
+        op.object = Object::Group;
+        op.key = "nexthop-group " + std::to_string(id);
+        op.undo = [&mgr, name = ng.name, id](const Live &live) {
+          auto was = before(live.groups, id);
+          // Saving the old group over the new one re-points its routes;
+          // deleting it first would take them down with it.
+          return Undo{"nexthop-group " + name, [&mgr, name, was] {
+                        if (was) {
+                          was->save(mgr);
+                          return;
+                        }
+                        NexthopGroupConfig gone;
+                        gone.name = name;
+                        quietly([&] { gone.destroy(mgr); });
+                      }};
+        };
+        return {};
+      }
+
+      auto rc = tok.toConfig();
+      if (!rc)
+        return "invalid destination prefix";
+      if (rc->nexthop_group && rc->nexthop)
+        return "nexthop and nexthop-group are exclusive";
+      if (set)
+        op.addRoute = *rc;
+      else
+        op.run = [&mgr, r = *rc] { r.destroy(mgr); };
+      op.object = Object::Route;
+      op.key = "route " + routeKey(*rc);
+      op.undo = [&mgr, r = *rc](const Live &live) {
+        auto was = before(live.routes, routeKey(r));
+        return Undo{"route " + r.prefix.toString(), [&mgr, r, was] {
+                      RouteConfig gone;
+                      gone.prefix = r.prefix;
+                      gone.vrf = r.vrf;
+                      quietly([&] { gone.destroy(mgr); });
+                      if (was)
+                        mgr.AddRoutes(*was);
+                    }};
+      };
+      return {};
+    }
+
+    template <typename TokT>
+    std::string makeNeighbourOp(const TokT &tok, bool set,
+                                ConfigurationManager &mgr, Op &op) {
+      constexpr bool arp = std::is_same_v<TokT, ArpToken>;
+      if (set && !tok.mac)
+        return "a MAC address is required";
+      std::string ip = tok.ip(), name = arp ? "arp " : "ndp ";
+      auto iface = tok.iface;
+      if (set) {
+        if constexpr (arp)
+          op.run = [&mgr, ip, mac = *tok.mac, iface, temp = tok.temp,
+                    pub = tok.pub] {
+            if (!mgr.SetArpEntry(ip, mac, iface, temp, pub))
+              throw std::runtime_error("kernel rejected entry");
+          };
+        else
+          op.run = [&mgr, ip, mac = *tok.mac, iface, temp = tok.temp] {
+            if (!mgr.SetNdpEntry(ip, mac, iface, temp))
+              throw std::runtime_error("kernel rejected entry");
+          };
+      } else {
+        op.run = [&mgr, ip, iface] {
+          bool ok;
+          if constexpr (arp)
+            ok = mgr.DeleteArpEntry(ip, iface);
+          else
+            ok = mgr.DeleteNdpEntry(ip, iface);
+          if (!ok)
+            throw std::runtime_error("kernel rejected delete");
+        };
+      }
+      op.object = arp ? Object::Arp : Object::Ndp;
+      op.key = name + ipKey(ip);
+      op.undo = [&mgr, ip, name](const Live &live) {
+        std::function<void()> fn;
+        if constexpr (arp) {
+          auto was = before(live.arp, ipKey(ip));
+          fn = [&mgr, ip, was] {
+            mgr.DeleteArpEntry(ip);
+            if (was && !mgr.SetArpEntry(ip, was->mac, was->iface, false,
+                                        was->published))
+              throw std::runtime_error("kernel rejected entry");
+          };
+        } else {
+          auto was = before(live.ndp, ipKey(ip));
+          fn = [&mgr, ip, was] {
+            mgr.DeleteNdpEntry(ip);
+            if (was && !mgr.SetNdpEntry(ip, was->mac, was->iface, false))
+              throw std::runtime_error("kernel rejected entry");
+          };
+        }
+        return Undo{name + ip, std::move(fn)};
+      };
+      return {};
+    }
+
+    std::string makePolicyOp(const PolicyToken &tok, bool set,
+                             ConfigurationManager &mgr, Op &op) {
+      if (!tok.acl_id)
+        return "access-list number is required";
+      PolicyConfig pc;
+      pc.policy_type = PolicyConfig::Type::AccessList;
+      pc.access_list.id = *tok.acl_id;
+      if (tok.rule_seq) {
+        PolicyAccessListRule rule;
+        rule.seq = *tok.rule_seq;
+        if (set) {
+          rule.action = tok.action.value_or("permit");
+          rule.source = tok.source;
+          rule.destination = tok.destination;
+          rule.protocol = tok.protocol;
+        }
+        pc.access_list.rules.push_back(std::move(rule));
+      }
+      if (set)
+        op.run = [&mgr, pc] { pc.save(mgr); };
+      else
+        op.run = [&mgr, pc] { pc.destroy(mgr); };
+      op.object = Object::Policy;
+      op.key = "policy " + std::to_string(*tok.acl_id);
+      op.undo = [&mgr, id = *tok.acl_id](const Live &live) {
+        auto was = before(live.policies, id);
+        return Undo{"access-list " + std::to_string(id), [&mgr, id, was] {
+                      PolicyConfig gone;
+                      gone.policy_type = PolicyConfig::Type::AccessList;
+                      gone.access_list.id = id;
+                      quietly([&] { gone.destroy(mgr); });
+                      if (was)
+                        was->save(mgr);
+                    }};
+      };
+      return {};
+    }
+
+    // Put an interface that existed before the batch back: drop the
+    // addresses and groups it gained, then save its old base settings.
+    void restoreInterface(ConfigurationManager &mgr,
+                          const InterfaceConfig &was) {
+      std::set<std::string> hadAddrs;
+      if (was.address)
+        hadAddrs.insert(was.address->toString());
+      for (const auto &a : was.aliases)
+        hadAddrs.insert(a.toString());
+      for (const auto &now : mgr.GetInterfaces()) {
+        if (now.name != was.name)
+          continue;
+        std::vector<InterfaceAddress> addrs = now.aliases;
+        if (now.address)
+          addrs.push_back(*now.address);
+        for (const auto &a : addrs)
+          if (!hadAddrs.count(a.toString()))
+            mgr.RemoveInterfaceAddress(was.name, a.toString());
+        for (const auto &g : now.groups)
+          if (std::find(was.groups.begin(), was.groups.end(), g) ==
+              was.groups.end())
+            mgr.RemoveInterfaceGroup(was.name, g);
+      }
+      was.save(mgr);
+    }
+
+    // Validate one parsed command and fill in @p op. Returns why the
+    // command is unusable, or an empty string.
+    std::string makeOp(const std::shared_ptr<Token> &head,
+                       ConfigurationManager &mgr, Op &op) {
+      bool set = head->kind() == TokenKind::Set;
+      if (!set && head->kind() != TokenKind::Delete)
+        return "only `set` and `delete` commands may appear in a batch";
+      const Token *target = head->getNext().get();
+      if (!target)
+        return "incomplete command";
+
+      switch (target->kind()) {
+      case TokenKind::Route:
+        return makeRouteOp(static_cast<const RouteToken &>(*target), set,
+                           mgr, op);
+      case TokenKind::Arp:
+        return makeNeighbourOp(static_cast<const ArpToken &>(*target), set,
+                               mgr, op);
+      case TokenKind::Ndp:
+        return makeNeighbourOp(static_cast<const NdpToken &>(*target), set,
+                               mgr, op);
+      case TokenKind::Policy:
+        return makePolicyOp(static_cast<const PolicyToken &>(*target), set,
+                            mgr, op);
+      case TokenKind::VRF: {
+        if (!set)
+          return "`delete vrf` is not supported";
+        const auto &tok = static_cast<const VRFToken &>(*target);
+        VRFConfig cfg(tok.name(), tok.table());
+        op.run = [&mgr, cfg] { cfg.save(mgr); };
+        op.object = Object::VRF;
+        op.key = "vrf " + std::to_string(cfg.table);
+        op.undo = [&mgr, table = cfg.table](const Live &live) {
+          auto was = before(live.vrfs, table);
+          return Undo{"vrf " + std::to_string(table), [&mgr, table, was] {
+                        if (was)
+                          was->save(mgr);
+                        else
+                          quietly([&] { VRFConfig(table).destroy(mgr); });
+                      }};
+        };
+        return {};
+      }
+      case TokenKind::Interface: {
+        const auto &tok = static_cast<const InterfaceToken &>(*target);
+        if (tok.name().empty())
+          return "missing interface name";
+        if (set && tok.address && !IPPrefix::fromString(*tok.address))
+          return "invalid address '" + *tok.address + "'";
+        // The token outlives the op through `head`. applySet/applyDelete
+        // throw where the interactive executors only print.
+        op.run = [&mgr, head, set] {
+          const auto &t = static_cast<const InterfaceToken &>(*head->getNext());
+          if (set)
+            t.applySet(mgr);
+          else
+            t.applyDelete(mgr);
+        };
+        op.object = Object::Interface;
+        op.key = "interface " + tok.name();
+        op.undo = [&mgr, name = tok.name()](const Live &live) {
+          auto was = before(live.interfaces, name);
+          return Undo{"interface " + name, [&mgr, name, was] {
+                        if (was)
+                          restoreInterface(mgr, *was);
+                        else if (mgr.InterfaceExists(name))
+                          mgr.DestroyInterface(name);
+                      }};
+        };
+        return {};
+      }
+      default:
+        return "not supported in a batch";
+      }
+    }
+
+    // Read the live state of every object type @p ops touch.
+    Live readLive(const std::vector<Op> &ops, ConfigurationManager &mgr) {
+      std::array<bool, size_t(Object::Count)> used{};
+      std::set<int> tables;
+      std::unordered_set<std::string> routeKeys;
+      for (const auto &op : ops) {
+        used[size_t(op.object)] = true;
+        if (op.object == Object::Route) {
+          routeKeys.insert(op.key.substr(6)); // drop "route "
+          tables.insert(std::stoi(op.key.substr(6)));
+        }
+      }
+
+      Live live;
+      if (used[size_t(Object::Interface)])
+        for (auto &ifc : mgr.GetInterfaces())
+          live.interfaces.emplace(ifc.name, std::move(ifc));
+      for (int t : tables) {
+        auto routes =
+            t == 0 ? mgr.GetRouteTable() : mgr.GetRouteTable(VRFConfig(t));
+        // A backend that cannot list a VRF returns its main table; only
+        // rows it reports in table t are that VRF's pre-image.
+        for (size_t row = 0; row < routes.size(); ++row) {
+          if (routes.table(row) != t)
+            continue;
+          std::string key =
+              std::to_string(t) + ' ' + routes.prefix(row).toString();
+          if (routeKeys.count(key))
+            live.routes[key].push_back(routes.at(row));
+        }
+      }
+      if (used[size_t(Object::Group)])
+        for (auto &g : mgr.GetNexthopGroups()) {
+          uint32_t id = g.id.value_or(NexthopGroupConfig::idFromName(g.name));
+          live.groups.emplace(id, std::move(g));
+        }
+      if (used[size_t(Object::VRF)])
+        for (auto &v : mgr.GetVrfs())
+          live.vrfs.emplace(v.table, std::move(v));
+      if (used[size_t(Object::Arp)])
+        for (auto &e : mgr.GetArpEntries())
+          if (e.permanent)
+            live.arp.emplace(e.ip.addressString(), std::move(e));
+      if (used[size_t(Object::Ndp)])
+        for (auto &e : mgr.GetNdpEntries())
+          if (e.permanent)
+            live.ndp.emplace(e.ip.addressString(), std::move(e));
+      if (used[size_t(Object::Policy)])
+        for (auto &p : mgr.GetPolicies())
+          live.policies.emplace(p.access_list.id, std::move(p));
+      return live;
+    }
+
+  } // namespace
+
+  int executeBatch(const std::string &file, ConfigurationManager &mgr) {
+    // ── parse: validate every line before touching anything ──────────
+    // Lines are tokenized, parsed and validated chunk by chunk on a
+    // worker pool; the ops come back in file order.
+    auto t0 = Clock::now();
+    std::vector<Op> ops;
+    try {
+      ScriptFile script(file);
+      ops = script.map([&](ScriptFile::Line &l) {
+        Op op;
+        op.lineno = l.lineno;
+        op.text = l.text;
+        if (!l.error.empty())
+          op.error = l.error;
+        else if (!l.cmd || !l.cmd->head())
+          op.error = "invalid command";
+        else
+          op.error = makeOp(l.cmd->head(), mgr, op);
+        return op;
+      });
+    } catch (const std::exception &e) {
+      std::cerr << "batch: " << e.what() << "\n";
+      return 1;
+    }
+    size_t errors = 0;
+    for (const auto &op : ops) {
+      if (op.error.empty())
+        continue;
+      std::cerr << "batch: line " << op.lineno << ": " << op.error << "\n";
+      ++errors;
+    }
+    double parseMs = msSince(t0);
+    if (errors) {
+      std::cerr << "batch: " << errors << " invalid line"
+                << (errors == 1 ? "" : "s") << ", nothing applied\n";
+      return 1;
+    }
+
+    // ── snapshot: pre-images for the undo log ───────────────────────
+    t0 = Clock::now();
+    Live live = readLive(ops, mgr);
+    double snapshotMs = msSince(t0);
+
+    // ── apply ────────────────────────────────────────────────────────
+    t0 = Clock::now();
+    std::vector<Undo> undo;
+    std::unordered_set<std::string> recorded;
+    auto record = [&](const Op &op) {
+      if (recorded.insert(op.key).second)
+        undo.push_back(op.undo(live));
+    };
+    bool failed = false;
+    for (size_t i = 0; i < ops.size() && !failed;) {
+      // A run of `set route` lines becomes one AddRoutes call.
+      size_t end = i;
+      std::vector<RouteConfig> routes;
+      while (end < ops.size() && ops[end].addRoute) {
+        record(ops[end]);
+        routes.push_back(*ops[end].addRoute);
+        ++end;
+      }
+      try {
+        if (!routes.empty()) {
+          mgr.AddRoutes(routes);
+          i = end;
+          continue;
+        }
+        record(ops[i]);
+        ops[i].run();
+        ++i;
+      } catch (const std::exception &e) {
+        if (!routes.empty() && end - i > 1)
+          std::cerr << "batch: lines " << ops[i].lineno << "-"
+                    << ops[end - 1].lineno << " (routes): " << e.what()
+                    << "\n";
+        else
+          std::cerr << "batch: line " << ops[i].lineno << ": " << ops[i].text
+                    << ": " << e.what() << "\n";
+        failed = true;
+      }
+    }
+    double applyMs = msSince(t0);
+
+    std::ostringstream timing;
+    timing << std::fixed << std::setprecision(1) << "parse " << parseMs
+           << " ms, snapshot " << snapshotMs << " ms, apply " << applyMs
+           << " ms";
+    if (!failed) {
+      std::cout << "batch: " << ops.size() << " commands applied ("
+                << timing.str() << ")\n";
+      return 0;
+    }
+
+    // ── rollback: newest first ──────────────────────────────────────
+    t0 = Clock::now();
+    size_t lost = 0;
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it) {
+      try {
+        it->run();
+      } catch (const std::exception &e) {
+        std::cerr << "batch: rollback of " << it->what
+                  << " failed: " << e.what() << "\n";
+        ++lost;
+      }
+    }
+    timing << ", rollback " << msSince(t0) << " ms";
+    if (lost)
+      std::cerr << "batch: rollback incomplete, " << lost << " of "
+                << undo.size() << " objects not restored (" << timing.str()
+                << ")\n";
+    else
+      std::cerr << "batch: rolled back " << undo.size() << " objects ("
+                << timing.str() << ")\n";
+    return 1;
+  }
+
+} // namespace netcli
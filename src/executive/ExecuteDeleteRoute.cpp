@@ -26,7 +26,7 @@
  */
 
 #include "ConfigurationManager.hpp"
-#include "IPNetwork.hpp"
+#include "NexthopGroupConfig.hpp"
 #include "RouteConfig.hpp"
 #include "RouteToken.hpp"
 #include <iostream>
@@ -39,26 +39,36 @@
 namespace netcli {
 
   void executeDeleteRoute(const RouteToken &tok, ConfigurationManager *mgr) {
-    RouteConfig rc;
-    rc.prefix = tok.prefix();
-    if (tok.nexthop)
-      rc.nexthop = tok.nexthop->toString();
-    if (tok.interface)
-      rc.iface = tok.interface->name();
-    if (tok.vrf)
-      rc.vrf = tok.vrf->table();
-    rc.blackhole = tok.blackhole;
-    rc.reject = tok.reject;
+    if (tok.isNexthopGroup()) {
+      if (tok.group_name->empty()) {
+        std::cout << "delete nexthop-group: missing group name\n";
+        return;
+      }
+      NexthopGroupConfig ng;
+      ng.name = *tok.group_name;
+      try {
+        ng.destroy(*mgr);
+        std::cout << "delete nexthop-group: " << ng.name << " removed\n";
+      } catch (const std::exception &e) {
+        std::cout << "delete nexthop-group: failed: " << e.what() << "\n";
+      }
+      return;
+    }
 
-    auto net = IPNetwork::fromString(rc.prefix);
-    if (!net) {
-      std::cout << "delete route: invalid prefix: " << rc.prefix << "\n";
+    auto cfg = tok.toConfig();
+    if (!cfg) {
+      if (tok.prefix().empty())
+        std::cout << "delete route: missing or invalid destination prefix\n";
+      else
+        std::cout << "delete route: invalid prefix: " << tok.prefix() << "\n";
       return;
     }
 
+    RouteConfig &rc = *cfg;
+
     try {
       rc.destroy(*mgr);
-      std::cout << "delete route: " << rc.prefix << " removed\n";
+      std::cout << "delete route: " << rc.prefix.toString() << " removed\n";
     } catch (const std::exception &e) {
       std::cout << "delete route: failed: " << e.what() << "\n";
     }
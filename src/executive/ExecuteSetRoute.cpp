@@ -29,7 +29,7 @@
 // Implement RTM_ADD via routing socket (pack rt_msghdr + sockaddrs)
 
 #include "ConfigurationManager.hpp"
-#include "IPNetwork.hpp"
+#include "NexthopGroupConfig.hpp"
 #include "RouteConfig.hpp"
 #include "RouteToken.hpp"
 
@@ -41,20 +41,52 @@
 
 namespace netcli {
 
+  static void executeSetNexthopGroup(const RouteToken &tok,
+                                     ConfigurationManager *mgr) {
+    if (tok.group_name->empty() || tok.group_members.empty()) {
+      std::cout << "set nexthop-group: usage: set nexthop-group <name> "
+                   "nexthop <ip> [interface <if>] [weight <n>] ...\n";
+      return;
+    }
+    NexthopGroupConfig ng;
+    ng.name = *tok.group_name;
+    for (const auto &m : tok.group_members) {
+      if (m.weight < 1 || m.weight > 256) {
+        std::cout << "set nexthop-group: weight must be 1-256\n";
+        return;
+      }
+      ng.members.push_back(m);
+    }
+    try {
+      ng.save(*mgr);
+      std::cout << "set nexthop-group: " << ng.name << " updated\n";
+    } catch (const std::exception &e) {
+      std::cout << "set nexthop-group: failed: " << e.what() << "\n";
+    }
+  }
+
   void executeSetRoute(const RouteToken &tok, ConfigurationManager *mgr) {
-    RouteConfig rc;
-    rc.prefix = tok.prefix();
-    if (tok.nexthop)
-      rc.nexthop = tok.nexthop->toString();
-    if (tok.interface)
-      rc.iface = tok.interface->name();
-    if (tok.vrf)
-      rc.vrf = tok.vrf->table();
-    rc.blackhole = tok.blackhole;
-    rc.reject = tok.reject;
+    if (tok.isNexthopGroup()) {
+      executeSetNexthopGroup(tok, mgr);
+      return;
+    }
+    auto cfg = tok.toConfig();
+    if (!cfg) {
+      if (tok.prefix().empty())
+        std::cout << "set route: missing or invalid destination prefix\n";
+      else
+        std::cout << "set route: invalid prefix: " << tok.prefix() << "\n";
+      return;
+    }
+
+    RouteConfig &rc = *cfg;
+    if (rc.nexthop_group && rc.nexthop) {
+      std::cout << "set route: nexthop and nexthop-group are exclusive\n";
+      return;
+    }
     try {
       rc.save(*mgr);
-      std::cout << "set route: " << rc.prefix << " added\n";
+      std::cout << "set route: " << rc.prefix.toString() << " added\n";
     } catch (const std::exception &e) {
       std::cout << "set route: failed: " << e.what() << "\n";
     }
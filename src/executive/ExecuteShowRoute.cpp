@@ -26,20 +26,112 @@
  */
 
 #include "ConfigurationManager.hpp"
+#include "IPPrefix.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "NexthopGroupTableFormatter.hpp"
+#include "RouteLookupFormatter.hpp"
+#include "RouteLookupTable.hpp"
 #include "RouteTableFormatter.hpp"
 #include "RouteToken.hpp"
 #include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
 namespace netcli {
 
+  namespace {
+    // Read one address per line; blank lines and '#' comments are skipped.
+    bool readLookupFile(const std::string &path, std::vector<IPPrefix> &out) {
+      std::ifstream in(path);
+      if (!in) {
+        std::cout << "show route lookup: cannot open '" << path << "'\n";
+        return false;
+      }
+      std::string line;
+      size_t lineno = 0;
+      while (std::getline(in, line)) {
+        ++lineno;
+        std::string_view v(line);
+        v = v.substr(0, v.find('#'));
+        while (!v.empty() && std::isspace(static_cast<unsigned char>(v[0])))
+          v.remove_prefix(1);
+        while (!v.empty() && std::isspace(static_cast<unsigned char>(v.back())))
+          v.remove_suffix(1);
+        if (v.empty())
+          continue;
+        auto a = IPPrefix::fromString(v);
+        if (!a) {
+          std::cout << "show route lookup: " << path << ":" << lineno
+                    << ": invalid address '" << v << "'\n";
+          continue;
+        }
+        out.push_back(a->address());
+      }
+      return true;
+    }
+
+    void executeRouteLookup(const RouteToken &tok,
+                            std::vector<RouteConfig> routes) {
+      std::vector<IPPrefix> addrs;
+      if (tok.lookup_address) {
+        auto a = IPPrefix::fromString(*tok.lookup_address);
+        if (!a) {
+          std::cout << "show route lookup: invalid address: "
+                    << *tok.lookup_address << "\n";
+          return;
+        }
+        addrs.push_back(a->address());
+      } else if (!readLookupFile(*tok.lookup_file, addrs)) {
+        return;
+      }
+
+      RouteLookupTable table(std::move(routes));
+      std::vector<RouteLookupResult> results(addrs.size());
+      size_t misses = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < addrs.size(); ++i) {
+        results[i].address = addrs[i];
+        results[i].route = table.lookup(addrs[i]);
+        misses += results[i].route == nullptr;
+      }
+      std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+
+      RouteLookupFormatter formatter;
+      formatter.format(results, std::cout);
+      if (tok.lookup_file && !results.empty()) {
+        std::cout << "\n"
+                  << results.size() << " lookups, " << misses
+                  << " unreachable, " << std::fixed << std::setprecision(1)
+                  << elapsed.count() / static_cast<double>(results.size())
+                  << " ns/lookup\n";
+      }
+    }
+  } // namespace
+
   void executeShowRoute(const RouteToken &tok, ConfigurationManager *mgr) {
     if (!mgr) {
       std::cout << "No ConfigurationManager provided\n";
       return;
     }
+
+    if (tok.isNexthopGroup()) {
+      auto groups = mgr->GetNexthopGroups();
+      if (!tok.group_name->empty()) {
+        uint32_t id = NexthopGroupConfig::idFromName(*tok.group_name);
+        std::erase_if(groups, [&](const NexthopGroupConfig &g) {
+          return g.name != *tok.group_name && g.id != id;
+        });
+      }
+      NexthopGroupTableFormatter formatter;
+      std::cout << formatter.format(groups);
+      return;
+    }
+
     // If a VRF token was provided, build a VRFConfig to request routes from
     // that routing table. Otherwise request global routes.
     std::optional<VRFConfig> vrfOpt = std::nullopt;
@@ -48,24 +140,29 @@ namespace netcli {
       vrfOpt = std::move(v);
     }
 
-    std::vector<RouteConfig> routes;
-    // Retrieve RouteConfig entries for the requested VRF (or global).
-    auto routeConfs = mgr->GetRoutes(vrfOpt);
+    if (tok.isLookup()) {
+      executeRouteLookup(tok, mgr->GetRoutes(vrfOpt));
+      return;
+    }
+
+    // Retrieve the routes for the requested VRF (or global).
+    RouteTable routes = mgr->GetRouteTable(vrfOpt);
     // Debug: report how many entries were returned by backend
-    std::cerr << "[debug] GetRoutes returned " << routeConfs.size()
+    std::cerr << "[debug] GetRoutes returned " << routes.size()
               << " entries for VRF '"
               << (vrfOpt ? std::to_string(vrfOpt->table)
                          : std::string("(global)"))
               << "'\n";
-    if (tok.prefix().empty()) {
-      routes = std::move(routeConfs);
-    } else {
-      for (auto &rc : routeConfs) {
-        if (rc.prefix == tok.prefix()) {
-          routes.push_back(std::move(rc));
+    if (!tok.prefix().empty()) {
+      auto want = IPPrefix::fromString(tok.prefix());
+      RouteTable match;
+      for (size_t row = 0; want && row < routes.size(); ++row) {
+        if (routes.prefix(row) == want->network()) {
+          match.push_back(routes, row);
           break;
         }
       }
+      routes = std::move(match);
     }
 
     if (routes.empty()) {
@@ -73,12 +170,7 @@ namespace netcli {
       return;
     }
 
-    std::string vrfContext = "Global";
-    if (!routes.empty() && routes[0].vrf) {
-      vrfContext = *routes[0].vrf;
-    }
-
     RouteTableFormatter formatter;
-    std::cout << formatter.format(routes);
+    formatter.format(routes, std::cout);
   }
 } // namespace netcli
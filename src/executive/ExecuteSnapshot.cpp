@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ConfigurationSnapshot.hpp"
+#include "ArpConfig.hpp"
+#include "CommandDispatcher.hpp"
+#include "CommandGenerator.hpp"
+#include "NdpConfig.hpp"
+#include "Parser.hpp"
+#include "RouteConfig.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace netcli {
+
+  namespace {
+
+    using namespace snapshot;
+
+    // Routes handed to the backend per AddRoutes() call; bounds the
+    // RouteConfig objects alive at once during restore.
+    constexpr size_t kRouteBatch = 1024;
+
+    class SnapshotWriter {
+    public:
+      uint32_t intern(std::string_view s) {
+        auto it = index_.find(std::string(s));
+        if (it != index_.end())
+          return it->second;
+        if (strings_.size() + s.size() + 1 > kNoString)
+          throw std::runtime_error("string table too large");
+        auto off = static_cast<uint32_t>(strings_.size());
+        strings_.append(s);
+        strings_.push_back('\0');
+        index_.emplace(std::string(s), off);
+        return off;
+      }
+
+      uint32_t internOptional(const std::optional<std::string> &s) {
+        return s ? intern(*s) : kNoString;
+      }
+
+      template <typename T> void add(SectionKind kind, const T &rec) {
+        auto &sec = sections_[kind];
+        sec.count++;
+        sec.data.append(reinterpret_cast<const char *>(&rec), sizeof(rec));
+      }
+
+      void write(std::ostream &out) {
+        sections_[SectionKind::Strings] = {0, strings_};
+
+        auto align = [](uint64_t v) { return (v + 7) & ~uint64_t(7); };
+        Header h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version = kVersion;
+        h.byteOrder = kByteOrder;
+        h.sections = static_cast<uint32_t>(sections_.size());
+
+        std::vector<SectionEntry> dir;
+        uint64_t pos = align(sizeof(Header) + sections_.size() *
+                                                  sizeof(SectionEntry));
+        for (const auto &[kind, sec] : sections_) {
+          dir.push_back({uint32_t(kind), sec.count, pos, sec.data.size()});
+          pos = align(pos + sec.data.size());
+        }
+        h.size = pos;
+
+        static const char pad[8] = {};
+        uint64_t written = 0;
+        auto put = [&](const void *p, size_t n) {
+          out.write(static_cast<const char *>(p), std::streamsize(n));
+          written += n;
+        };
+        put(&h, sizeof(h));
+        put(dir.data(), dir.size() * sizeof(SectionEntry));
+        auto it = dir.begin();
+        for (const auto &[kind, sec] : sections_) {
+          put(pad, it->offset - written);
+          put(sec.data.data(), sec.data.size());
+          ++it;
+        }
+        put(pad, h.size - written);
+      }
+
+    private:
+      struct Section {
+        uint32_t count = 0;
+        std::string data;
+      };
+      std::string strings_;
+      std::unordered_map<std::string, uint32_t> index_;
+      std::map<SectionKind, Section> sections_;
+    };
+
+    void copyAddress(const IPPrefix &p, uint8_t &family, uint8_t *bytes) {
+      family = p.isV4() ? 4 : 6;
+      std::memcpy(bytes, p.bytes().data(), 16);
+    }
+
+    IPPrefix address(uint8_t family, const uint8_t *bytes, uint8_t len) {
+      if (family == 4)
+        return IPPrefix::v4(uint32_t(bytes[0]) << 24 |
+                                uint32_t(bytes[1]) << 16 |
+                                uint32_t(bytes[2]) << 8 | uint32_t(bytes[3]),
+                            len);
+      return IPPrefix::v6Bytes(bytes, len);
+    }
+
+    bool bulkLine(std::string_view line) {
+      return line.starts_with("set route ") || line.starts_with("set arp ") ||
+             line.starts_with("set ndp ");
+    }
+
+    /// Read-only mapping of a snapshot file with its sections validated.
+    class SnapshotView {
+    public:
+      explicit SnapshotView(const std::string &file) {
+        int fd = ::open(file.c_str(), O_RDONLY);
+        if (fd < 0)
+          throw std::runtime_error(std::strerror(errno));
+        struct stat st{};
+        if (fstat(fd, &st) < 0 || st.st_size < off_t(sizeof(Header))) {
+          ::close(fd);
+          throw std::runtime_error("not a snapshot (too short)");
+        }
+        size_ = size_t(st.st_size);
+        void *p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED)
+          throw std::runtime_error(std::string("mmap: ") +
+                                   std::strerror(errno));
+        base_ = static_cast<const char *>(p);
+        try {
+          validate();
+        } catch (...) {
+          munmap(const_cast<char *>(base_), size_);
+          throw;
+        }
+      }
+
+      ~SnapshotView() { munmap(const_cast<char *>(base_), size_); }
+
+      SnapshotView(const SnapshotView &) = delete;
+      SnapshotView &operator=(const SnapshotView &) = delete;
+
+      template <typename T> std::span<const T> records(SectionKind kind) const {
+        const SectionEntry *e = entries_[size_t(kind)];
+        if (!e)
+          return {};
+        return {reinterpret_cast<const T *>(base_ + e->offset), e->count};
+      }
+
+      /// String at @p off, or nullopt for kNoString.
+      std::optional<std::string> string(uint32_t off) const {
+        if (off == kNoString)
+          return std::nullopt;
+        if (off >= strings_.size())
+          throw std::runtime_error("string offset out of range");
+        return std::string(strings_.data() + off);
+      }
+
+    private:
+      void validate() {
+        const auto *h = reinterpret_cast<const Header *>(base_);
+        if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0)
+          throw std::runtime_error("not a snapshot (bad magic)");
+        if (h->byteOrder != kByteOrder)
+          throw std::runtime_error("snapshot was written on a host with a "
+                                   "different byte order");
+        if (h->version != kVersion)
+          throw std::runtime_error("unsupported snapshot version " +
+                                   std::to_string(h->version));
+        if (h->size != size_)
+          throw std::runtime_error("truncated snapshot");
+        if (h->sections > (size_ - sizeof(Header)) / sizeof(SectionEntry))
+          throw std::runtime_error("corrupt section directory");
+
+        const auto *dir =
+            reinterpret_cast<const SectionEntry *>(base_ + sizeof(Header));
+        for (uint32_t i = 0; i < h->sections; ++i) {
+          const SectionEntry &e = dir[i];
+          if (e.offset % 8 || e.offset > size_ || e.size > size_ - e.offset)
+            throw std::runtime_error("section out of bounds");
+          size_t rec = recordSize(SectionKind(e.kind));
+          if (rec && e.size != uint64_t(e.count) * rec)
+            throw std::runtime_error("section size does not match count");
+          if (e.kind < entries_.size())
+            entries_[e.kind] = &e;
+        }
+        if (const SectionEntry *s = entries_[size_t(SectionKind::Strings)]) {
+          strings_ = {base_ + s->offset, size_t(s->size)};
+          if (!strings_.empty() && strings_.back() != '\0')
+            throw std::runtime_error("unterminated string table");
+        }
+        for (const auto &t : records<RouteTable>(SectionKind::RouteTables))
+          if (t.first > records<Route>(SectionKind::Routes).size() ||
+              t.count > records<Route>(SectionKind::Routes).size() - t.first)
+            throw std::runtime_error("route table out of range");
+      }
+
+      static size_t recordSize(SectionKind kind) {
+        switch (kind) {
+        case SectionKind::Commands:
+          return sizeof(uint32_t);
+        case SectionKind::RouteTables:
+          return sizeof(RouteTable);
+        case SectionKind::Routes:
+          return sizeof(Route);
+        case SectionKind::Arp:
+        case SectionKind::Ndp:
+          return sizeof(Neighbour);
+        default:
+          return 0;
+        }
+      }
+
+      const char *base_ = nullptr;
+      size_t size_ = 0;
+      std::string_view strings_;
+      std::array<const SectionEntry *, 7> entries_{};
+    };
+
+  } // namespace
+
+  int saveSnapshot(const std::string &file, ConfigurationManager &mgr) {
+    SnapshotWriter w;
+    try {
+      // Everything but routes and neighbours is kept as the commands
+      // `net -g` prints for it.
+      std::stringstream text;
+      CommandGenerator().generateConfiguration(mgr, text);
+      std::string line;
+      while (std::getline(text, line))
+        if (!bulkLine(line))
+          w.add(SectionKind::Commands, w.intern(line));
+
+      // Same selection as the generator: no pinned routes, published ARP
+      // and permanent NDP entries only.
+      auto routes = mgr.GetRoutes();
+      std::erase_if(routes, [](const RouteConfig &r) {
+        return r.flags & RouteConfig::Flag(RouteConfig::PINNED);
+      });
+      std::stable_sort(routes.begin(), routes.end(),
+                       [](const RouteConfig &a, const RouteConfig &b) {
+                         return a.vrf.value_or(-1) < b.vrf.value_or(-1);
+                       });
+      uint32_t index = 0;
+      for (size_t i = 0; i < routes.size();) {
+        RouteTable t{routes[i].vrf.value_or(-1), index, 0};
+        for (; i < routes.size() && routes[i].vrf.value_or(-1) == t.vrf; ++i) {
+          const RouteConfig &rc = routes[i];
+          Route r{};
+          copyAddress(rc.prefix, r.family, r.dest);
+          r.length = rc.prefix.length();
+          if (rc.nexthop) {
+            copyAddress(*rc.nexthop, r.nexthopFamily, r.nexthop);
+            r.flags |= Route::Nexthop;
+          }
+          if (rc.blackhole)
+            r.flags |= Route::Blackhole;
+          if (rc.reject)
+            r.flags |= Route::Reject;
+          r.iface = w.internOptional(rc.iface);
+          r.group = w.internOptional(rc.nexthop_group);
+          w.add(SectionKind::Routes, r);
+          ++t.count;
+        }
+        index += t.count;
+        w.add(SectionKind::RouteTables, t);
+      }
+
+      for (const auto &a : mgr.GetArpEntries()) {
+        if (!a.published)
+          continue;
+        Neighbour n{};
+        copyAddress(a.ip, n.family, n.ip);
+        n.flags = Neighbour::Published;
+        n.iface = w.internOptional(a.iface);
+        n.mac = w.intern(a.mac);
+        w.add(SectionKind::Arp, n);
+      }
+      for (const auto &e : mgr.GetNdpEntries()) {
+        if (!e.permanent)
+          continue;
+        Neighbour n{};
+        copyAddress(e.ip, n.family, n.ip);
+        n.iface = w.internOptional(e.iface);
+        n.mac = w.intern(e.mac);
+        w.add(SectionKind::Ndp, n);
+      }
+    } catch (const std::exception &e) {
+      std::cerr << "snapshot: reading configuration failed: " << e.what()
+                << "\n";
+      return 1;
+    }
+
+    // Write next to the target and rename, so a crash never leaves a
+    // half-written snapshot behind.
+    std::string tmp = file + ".tmp";
+    {
+      std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+      if (out)
+        w.write(out);
+      if (!out || !out.flush()) {
+        std::cerr << "snapshot: cannot write '" << tmp << "'\n";
+        std::remove(tmp.c_str());
+        return 1;
+      }
+    }
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::cerr << "snapshot: cannot rename to '" << file
+                << "': " << std::strerror(errno) << "\n";
+      std::remove(tmp.c_str());
+      return 1;
+    }
+    return 0;
+  }
+
+  int restoreSnapshot(const std::string &file, ConfigurationManager &mgr) {
+    std::optional<SnapshotView> view;
+    try {
+      view.emplace(file);
+    } catch (const std::exception &e) {
+      std::cerr << "snapshot: " << file << ": " << e.what() << "\n";
+      return 1;
+    }
+
+    int status = 0;
+    auto guarded = [&](const std::string &what, auto fn) {
+      try {
+        fn();
+      } catch (const std::exception &e) {
+        std::cerr << "snapshot: " << what << " failed: " << e.what() << "\n";
+        status = 1;
+      }
+    };
+
+    // VRFs, interfaces, nexthop groups and policies, in generation order
+    // so nexthop groups exist before the routes that use them.
+    Parser parser;
+    CommandDispatcher dispatcher;
+    auto commands = view->records<uint32_t>(SectionKind::Commands);
+    std::string scratch;
+    for (uint32_t off : commands) {
+      std::string text = view->string(off).value_or("");
+      guarded(text, [&] {
+        auto cmd = parser.parse(parser.tokenize(text, scratch));
+        if (!cmd || !cmd->head())
+          throw std::runtime_error("invalid command");
+        dispatcher.dispatch(cmd->head(), &mgr);
+      });
+    }
+
+    auto routes = view->records<Route>(SectionKind::Routes);
+    auto tables = view->records<RouteTable>(SectionKind::RouteTables);
+    std::vector<RouteConfig> batch;
+    batch.reserve(kRouteBatch);
+    for (const auto &t : tables) {
+      std::string what = t.vrf < 0 ? std::string("routes")
+                                   : "routes in vrf " + std::to_string(t.vrf);
+      for (uint32_t i = 0; i < t.count; i += kRouteBatch) {
+        batch.clear();
+        guarded(what, [&] {
+          uint32_t n = std::min<uint32_t>(kRouteBatch, t.count - i);
+          for (const Route &r : routes.subspan(t.first + i, n)) {
+            RouteConfig &rc = batch.emplace_back();
+            rc.prefix = address(r.family, r.dest, r.length);
+            if (r.flags & Route::Nexthop)
+              rc.nexthop = address(r.nexthopFamily, r.nexthop,
+                                   r.nexthopFamily == 4 ? 32 : 128);
+            rc.blackhole = r.flags & Route::Blackhole;
+            rc.reject = r.flags & Route::Reject;
+            rc.iface = view->string(r.iface);
+            rc.nexthop_group = view->string(r.group);
+            if (t.vrf >= 0)
+              rc.vrf = t.vrf;
+          }
+          mgr.AddRoutes(batch);
+        });
+      }
+    }
+
+    auto arp = view->records<Neighbour>(SectionKind::Arp);
+    for (const Neighbour &n : arp) {
+      std::string ip = address(n.family, n.ip, 32).addressString();
+      guarded("arp " + ip, [&] {
+        mgr.SetArpEntry(ip, view->string(n.mac).value_or(""),
+                        view->string(n.iface), false,
+                        n.flags & Neighbour::Published);
+      });
+    }
+    auto ndp = view->records<Neighbour>(SectionKind::Ndp);
+    for (const Neighbour &n : ndp) {
+      std::string ip = address(n.family, n.ip, 128).addressString();
+      guarded("ndp " + ip, [&] {
+        mgr.SetNdpEntry(ip, view->string(n.mac).value_or(""),
+                        view->string(n.iface));
+      });
+    }
+
+    std::cout << "restored " << commands.size() << " commands, "
+              << routes.size() << " routes in " << tables.size()
+              << " tables, " << arp.size() << " arp and " << ndp.size()
+              << " ndp entries\n";
+    return status;
+  }
+
+} // namespace netcli
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ScriptFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace netcli {
+
+  namespace {
+    // Below this a chunk is not worth a thread.
+    constexpr size_t kMinChunk = 64 * 1024;
+  } // namespace
+
+  ScriptFile::ScriptFile(const std::string &file) {
+    if (file == "-") {
+      buffer_.assign(std::istreambuf_iterator<char>(std::cin), {});
+      text_ = buffer_;
+      return;
+    }
+
+    int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      throw std::runtime_error("cannot open '" + file +
+                               "': " + std::strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      void *p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE,
+                     fd, 0);
+      if (p != MAP_FAILED) {
+        ::close(fd);
+        map_ = static_cast<const char *>(p);
+        mapSize_ = size_t(st.st_size);
+        madvise(const_cast<char *>(map_), mapSize_, MADV_WILLNEED);
+        text_ = std::string_view(map_, mapSize_);
+        return;
+      }
+    }
+
+    // Not a regular file (a FIFO, /dev/stdin, ...) or mmap failed: read it.
+    char buf[65536];
+    for (ssize_t n; (n = ::read(fd, buf, sizeof(buf))) != 0;) {
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        int err = errno;
+        ::close(fd);
+        throw std::runtime_error("cannot read '" + file +
+                                 "': " + std::strerror(err));
+      }
+      buffer_.append(buf, size_t(n));
+    }
+    ::close(fd);
+    text_ = buffer_;
+  }
+
+  ScriptFile::~ScriptFile() {
+    if (map_)
+      munmap(const_cast<char *>(map_), mapSize_);
+  }
+
+  std::vector<ScriptFile::Chunk> ScriptFile::split(unsigned threads) const {
+    // A few chunks per worker even out lines that are slower to parse.
+    size_t want = std::clamp<size_t>(text_.size() / kMinChunk, 1,
+                                     size_t(threads) * 4);
+    size_t target = text_.size() / want + 1;
+
+    std::vector<Chunk> chunks;
+    size_t pos = 0, line = 1;
+    while (pos < text_.size()) {
+      size_t end = std::min(pos + target, text_.size());
+      if (end < text_.size()) {
+        end = text_.find('\n', end);
+        end = end == std::string_view::npos ? text_.size() : end + 1;
+      }
+      std::string_view piece = text_.substr(pos, end - pos);
+      chunks.push_back({piece, line});
+      line += size_t(std::count(piece.begin(), piece.end(), '\n'));
+      pos = end;
+    }
+    if (chunks.empty())
+      chunks.push_back({{}, 1});
+    return chunks;
+  }
+
+} // namespace netcli
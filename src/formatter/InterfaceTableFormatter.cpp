@@ -65,10 +65,8 @@ std::string InterfaceTableFormatter::format(
     std::vector<std::string> addrLines;
     if (ic.address)
       addrLines.push_back(ic.address->toString());
-    for (const auto &a : ic.aliases) {
-      if (a)
-        addrLines.push_back(a->toString());
-    }
+    for (const auto &a : ic.aliases)
+      addrLines.push_back(a.toString());
     if (!addrLines.empty()) {
       std::ostringstream aoss;
       for (size_t i = 0; i < addrLines.size(); ++i) {
@@ -41,7 +41,7 @@ std::string NdpTableFormatter::format(const std::vector<NdpConfig> &entries) {
   addColumn("Flags", "Flags", 3, 2, true);
 
   for (const auto &entry : entries) {
-    std::string ip = entry.ip;
+    std::string ip = entry.ip.addressString();
     std::string mac = entry.mac;
     std::string iface = entry.iface.value_or("-");
     std::string expire = "-";
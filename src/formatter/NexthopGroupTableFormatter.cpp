@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "NexthopGroupTableFormatter.hpp"
+#include "NexthopGroupConfig.hpp"
+
+std::string NexthopGroupTableFormatter::format(
+    const std::vector<NexthopGroupConfig> &groups) {
+  if (groups.empty())
+    return "No nexthop groups found.\n";
+
+  addColumn("Group", "Group", 4, 5, true);
+  addColumn("Id", "Id", 3, 4, true);
+  addColumn("Nexthop", "Nexthop", 6, 15, true);
+  addColumn("Interface", "Interface", 5, 9, true);
+  addColumn("Weight", "Weight", 3, 6, false);
+
+  for (const auto &g : groups) {
+    std::string id = g.id ? std::to_string(*g.id) : "-";
+    for (const auto &m : g.members) {
+      addRow({g.name, id, m.gateway.empty() ? "-" : m.gateway,
+              m.iface.value_or("-"), std::to_string(m.weight)});
+    }
+  }
+
+  auto out = std::string("Nexthop Groups\n\n");
+  out += renderTable(80);
+  return out;
+}
@@ -44,10 +44,8 @@ PflogTableFormatter::format(const std::vector<InterfaceConfig> &items) {
     std::vector<std::string> addrs;
     if (ic.address)
       addrs.push_back(ic.address->toString());
-    for (const auto &a : ic.aliases) {
-      if (a)
-        addrs.push_back(a->toString());
-    }
+    for (const auto &a : ic.aliases)
+      addrs.push_back(a.toString());
 
     std::ostringstream aoss;
     for (size_t i = 0; i < addrs.size(); ++i) {
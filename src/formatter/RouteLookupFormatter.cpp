@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "RouteLookupFormatter.hpp"
+#include "RouteTableFormatter.hpp"
+#include <sstream>
+
+std::string
+RouteLookupFormatter::format(const std::vector<RouteLookupResult> &results) {
+  std::ostringstream oss;
+  format(results, oss);
+  return oss.str();
+}
+
+void RouteLookupFormatter::format(
+    const std::vector<RouteLookupResult> &results, std::ostream &out) {
+  if (results.empty()) {
+    out << "No lookups performed.\n";
+    return;
+  }
+
+  addColumn("Address", "Address", 8, 7, true);
+  addColumn("Destination", "Destination", 8, 10, true);
+  addColumn("Gateway", "Gateway", 6, 7, true);
+  addColumn("Interface", "Interface", 6, 4, true);
+  addColumn("Flags", "Flags", 3, 2, true);
+
+  for (const auto &r : results) {
+    if (!r.route) {
+      addRow({r.address.addressString(), "unreachable", "-", "-", "-"});
+      continue;
+    }
+    addRow({r.address.addressString(), r.route->prefix.toString(),
+            RouteTableFormatter::gatewayString(*r.route),
+            r.route->iface.value_or("-"),
+            RouteTableFormatter::flagsString(*r.route)});
+  }
+  renderTable(out, 80);
+}
@@ -26,18 +26,68 @@
  */
 
 #include "RouteTableFormatter.hpp"
+#include "InterfaceNames.hpp"
 #include "RouteConfig.hpp"
+#include <charconv>
+#include <cstring>
 #include <iomanip>
+#include <sstream>
+
+std::string RouteTableFormatter::gatewayString(const RouteConfig &route) {
+  if (route.nexthop)
+    return route.nexthop->addressString();
+  if (route.gateway_link)
+    return "link#" + std::to_string(*route.gateway_link);
+  if (route.nexthop_group)
+    return "group " + *route.nexthop_group;
+  return "-";
+}
+
+std::string RouteTableFormatter::flagsString(const RouteConfig &route) {
+  return flagsString(route.flags, route.blackhole, route.reject);
+}
+
+std::string RouteTableFormatter::flagsString(unsigned routeFlags,
+                                             bool blackhole, bool reject) {
+  // Build flags in netstat order: U G H S B R (plain letters — legend is
+  // bold). Use portable constants from RouteConfig.
+  std::string flags;
+  if (routeFlags & RouteConfig::Flag(RouteConfig::UP))
+    flags += "U";
+  if (routeFlags & RouteConfig::Flag(RouteConfig::GATEWAY))
+    flags += "G";
+  if (routeFlags & RouteConfig::Flag(RouteConfig::HOST))
+    flags += "H";
+  if (routeFlags & RouteConfig::Flag(RouteConfig::STATIC))
+    flags += "S";
+  if (blackhole)
+    flags += "B";
+  if (reject)
+    flags += "R";
+  return flags;
+}
 
 std::string
 RouteTableFormatter::format(const std::vector<RouteConfig> &routes) {
-  if (routes.empty())
-    return "No routes found.\n";
+  return format(RouteTable(routes));
+}
+
+std::string RouteTableFormatter::format(const RouteTable &routes) {
+  std::ostringstream oss;
+  format(routes, oss);
+  return oss.str();
+}
+
+void RouteTableFormatter::format(const RouteTable &routes, std::ostream &out) {
+  if (routes.empty()) {
+    out << "No routes found.\n";
+    return;
+  }
 
   // Determine VRF context (first route's VRF if present)
   std::string vrfContext = "Global";
-  if (!routes.empty() && routes[0].vrf)
-    vrfContext = *routes[0].vrf;
+  if (auto vrf = routes.vrf(0))
+    vrfContext = std::to_string(*vrf);
 
   addColumn("Destination", "Destination", 8, 10, true);
   addColumn("Gateway", "Gateway", 6, 7, true);
@@ -47,35 +97,51 @@ RouteTableFormatter::format(const std::vector<RouteConfig> &routes) {
   addColumn("Scope", "Scope", 5, 6, true);
   addColumn("Expire", "Expire", 6, 8, true);
 
-  for (const auto &route : routes) {
-    std::string dest = route.prefix.empty() ? "-" : route.prefix;
-    std::string gateway = route.nexthop.value_or("-");
-    std::string iface = route.iface.value_or("-");
-    std::string author = route.author.value_or("-");
-    std::string scope = route.scope.value_or("-");
-    std::string expire = "-";
-    if (route.expire)
-      expire = std::to_string(*route.expire);
+  // Cells are formatted into stack buffers; addRow copies them into the
+  // formatter's arena.
+  auto &names = InterfaceNames::instance();
+  char dest[ipchars::kMaxPrefixChars];
+  char gateway[ipchars::kMaxPrefixChars];
+  char expire[16];
+  auto cell = [](const char *buf, std::to_chars_result r) {
+    return std::string_view(buf, r.ptr);
+  };
+  for (size_t row = 0; row < routes.size(); ++row) {
+    IPPrefix prefix = routes.prefix(row);
+    std::string_view destCell = "-";
+    if (!prefix.empty())
+      destCell = cell(dest, prefix.toChars(dest, dest + sizeof(dest)));
 
-    // Build flags in netstat order: U G H S B R (plain letters — legend is
-    // bold). Use portable constants from RouteConfig.
-    std::string flags;
-    if (route.flags & RouteConfig::Flag(RouteConfig::UP))
-      flags += "U";
-    if (route.flags & RouteConfig::Flag(RouteConfig::GATEWAY))
-      flags += "G";
-    if (route.flags & RouteConfig::Flag(RouteConfig::HOST))
-      flags += "H";
-    if (route.flags & RouteConfig::Flag(RouteConfig::STATIC))
-      flags += "S";
-    if (route.blackhole)
-      flags += "B";
-    if (route.reject)
-      flags += "R";
+    std::string group;
+    std::string_view gatewayCell = "-";
+    if (auto nh = routes.nexthop(row)) {
+      gatewayCell = cell(
+          gateway, nh->addressToChars(gateway, gateway + sizeof(gateway)));
+    } else if (auto link = routes.gatewayLink(row)) {
+      std::memcpy(gateway, "link#", 5);
+      gatewayCell = cell(gateway, std::to_chars(gateway + 5,
+                                                gateway + sizeof(gateway),
+                                                *link));
+    } else if (auto g = routes.nexthopGroup(row)) {
+      group = "group " + std::string(*g);
+      gatewayCell = group;
+    }
 
-    addRow({dest, gateway, author, iface, flags, scope, expire});
-  }
+    std::string_view ifaceCell = "-";
+    if (routes.interface(row) != InterfaceNames::kNone)
+      ifaceCell = names.name(routes.interface(row));
 
+    std::string_view expireCell = "-";
+    if (auto e = routes.expire(row))
+      expireCell =
+          cell(expire, std::to_chars(expire, expire + sizeof(expire), *e));
+
+    std::string flags = flagsString(routes.flags(row), routes.blackhole(row),
+                                    routes.reject(row));
+
+    addRow({destCell, gatewayCell, routes.author(row).value_or("-"),
+            ifaceCell, flags, routes.scope(row).value_or("-"), expireCell});
+  }
   // Display VRF header: if kernel reported a fib name like "fibN", show
   // numeric VRF id. Treat global as VRF 0.
   std::string vrfLabel;
@@ -87,12 +153,10 @@ RouteTableFormatter::format(const std::vector<RouteConfig> &routes) {
   } else {
     vrfLabel = std::string("VRF: ") + vrfContext;
   }
-  auto out = std::string("Routes (") + vrfLabel + ")\n\n";
+  out << "Routes (" << vrfLabel << ")\n\n";
   // Legend for route flags (abbrev letters are bold)
-  out += std::string("Flags: ") + "\x1b[1mU\x1b[0m=up, " +
-         "\x1b[1mG\x1b[0m=gateway, " + "\x1b[1mH\x1b[0m=host, " +
-         "\x1b[1mS\x1b[0m=static, " + "\x1b[1mB\x1b[0m=blackhole, " +
-         "\x1b[1mR\x1b[0m=reject\n\n";
-  out += renderTable(80);
-  return out;
+  out << "Flags: " << "\x1b[1mU\x1b[0m=up, " << "\x1b[1mG\x1b[0m=gateway, "
+      << "\x1b[1mH\x1b[0m=host, " << "\x1b[1mS\x1b[0m=static, "
+      << "\x1b[1mB\x1b[0m=blackhole, " << "\x1b[1mR\x1b[0m=reject\n\n";
+  renderTable(out, 80);
 }
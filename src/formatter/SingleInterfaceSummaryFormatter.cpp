@@ -36,12 +36,11 @@
 
 namespace {
 
-  void formatIPv6Annotations(std::ostringstream &oss, const IPNetwork *net) {
-    if (!net || net->family() != AddressFamily::IPv6)
-      return;
-    auto *v6 = dynamic_cast<const IPv6Network *>(net);
-    if (!v6)
+  void formatIPv6Annotations(std::ostringstream &oss,
+                             const InterfaceAddress &addr) {
+    if (addr.family() != AddressFamily::IPv6)
       return;
+    const InterfaceAddress *v6 = &addr;
     if (v6->scopeid)
       oss << " scopeid 0x" << std::hex << *v6->scopeid << std::dec;
     if (v6->addr_flags) {
@@ -142,13 +141,13 @@ SingleInterfaceSummaryFormatter::format(const InterfaceConfig &ic) const {
 
   if (ic.address) {
     oss << "Address:   " << ic.address->toString();
-    formatIPv6Annotations(oss, ic.address.get());
+    formatIPv6Annotations(oss, *ic.address);
     oss << "\n";
   }
 
   for (const auto &alias : ic.aliases) {
-    oss << "           " << alias->toString();
-    formatIPv6Annotations(oss, alias.get());
+    oss << "           " << alias.toString();
+    formatIPv6Annotations(oss, alias);
     oss << "\n";
   }
 
@@ -26,22 +26,25 @@
  */
 
 #include "StringUtils.hpp"
-#include <sstream>
 
 namespace strutil {
 
-  std::vector<std::string> splitLines(const std::string &s) {
-    std::vector<std::string> out;
-    std::string line;
-    std::istringstream iss(s);
-    while (std::getline(iss, line))
-      out.push_back(line);
+  void splitLines(std::string_view s,
+                  std::pmr::vector<std::string_view> &out) {
+    out.clear();
+    size_t start = 0;
+    while (start < s.size()) {
+      size_t nl = s.find('\n', start);
+      if (nl == std::string_view::npos)
+        nl = s.size();
+      out.push_back(s.substr(start, nl - start));
+      start = nl + 1;
+    }
     if (out.empty())
-      out.push_back("");
-    return out;
+      out.push_back({});
   }
 
-  int visibleLength(const std::string &s) {
+  int visibleLength(std::string_view s) {
     int len = 0;
     for (size_t i = 0; i < s.size();) {
       if (s[i] == '\x1b' && i + 1 < s.size() && s[i + 1] == '[') {
@@ -58,7 +61,7 @@ namespace strutil {
     return len;
   }
 
-  std::string truncateVisible(const std::string &s, int w) {
+  std::string truncateVisible(std::string_view s, int w) {
     std::string out;
     int vis = 0;
     for (size_t i = 0; i < s.size() && vis < w;) {
@@ -79,7 +82,7 @@ namespace strutil {
     return out;
   }
 
-  std::string stripAnsi(const std::string &s) {
+  std::string stripAnsi(std::string_view s) {
     std::string clean;
     bool inEscape = false;
     for (char c : s) {
@@ -26,16 +26,19 @@
  */
 
 #include "TapTableFormatter.hpp"
-#include "InterfaceConfig.hpp"
 #include "InterfaceFlags.hpp"
+#include "TapInterfaceConfig.hpp"
 #include <sstream>
 
 std::string
-TapTableFormatter::format(const std::vector<InterfaceConfig> &items) {
+TapTableFormatter::format(const std::vector<TapInterfaceConfig> &items) {
   addColumn("Interface", "Interface", 10, 4, true);
   addColumn("Address", "Address", 5, 7, true);
   addColumn("Status", "Status", 6, 6, true);
   addColumn("MTU", "MTU", 6, 6, true);
+  addColumn("Queues", "Queues", 4, 6, true);
+  addColumn("Owner", "Owner", 3, 5, true);
+  addColumn("Flags", "Flags", 3, 5, true);
 
   for (const auto &ic : items) {
 
@@ -45,10 +48,8 @@ TapTableFormatter::format(const std::vector<InterfaceConfig> &items) {
     std::vector<std::string> addrs;
     if (ic.address)
       addrs.push_back(ic.address->toString());
-    for (const auto &a : ic.aliases) {
-      if (a)
-        addrs.push_back(a->toString());
-    }
+    for (const auto &a : ic.aliases)
+      addrs.push_back(a.toString());
 
     std::ostringstream aoss;
     for (size_t i = 0; i < addrs.size(); ++i) {
@@ -70,7 +71,25 @@ TapTableFormatter::format(const std::vector<InterfaceConfig> &items) {
 
     std::string mtu = ic.mtu ? std::to_string(*ic.mtu) : std::string("-");
 
-    addRow({ic.name, addrCell, status, mtu});
+    // tx/rx queue counts as allocated by the driver
+    std::string queues = "-";
+    if (ic.tx_queues && ic.rx_queues)
+      queues = std::to_string(*ic.tx_queues) + "/" +
+               std::to_string(*ic.rx_queues);
+
+    std::string owner = ic.owner.value_or("-");
+    if (ic.owner_group)
+      owner += ":" + *ic.owner_group;
+
+    std::string flags;
+    if (ic.multi_queue)
+      flags = "multi-queue";
+    if (ic.vnet_hdr && *ic.vnet_hdr)
+      flags += flags.empty() ? "vnet-hdr" : "\nvnet-hdr";
+    if (flags.empty())
+      flags = "-";
+
+    addRow({ic.name, addrCell, status, mtu, queues, owner, flags});
   }
 
   return renderTable(80);
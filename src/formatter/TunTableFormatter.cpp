@@ -14,6 +14,7 @@ TunTableFormatter::format(const std::vector<TunInterfaceConfig> &interfaces) {
   addColumn("Destination", "Destination", 5, 6, true);
   addColumn("VRF", "VRF", 5, 3, false);
   addColumn("Tunnel VRF", "Tunnel VRF", 4, 3, false);
+  addColumn("Queues", "Queues", 4, 6, true);
 
   for (const auto &tun : interfaces) {
     std::string source = tun.source ? tun.source->toString() : "-";
@@ -23,7 +24,14 @@ TunTableFormatter::format(const std::vector<TunInterfaceConfig> &interfaces) {
     std::string tunnelVrfStr =
         tun.tunnel_vrf ? std::to_string(*tun.tunnel_vrf) : "-";
 
-    addRow({tun.name, source, destination, vrfStr, tunnelVrfStr});
+    std::string queues = "-";
+    if (tun.tx_queues && tun.rx_queues)
+      queues = std::to_string(*tun.tx_queues) + "/" +
+               std::to_string(*tun.rx_queues);
+    if (tun.multi_queue)
+      queues += " mq";
+
+    addRow({tun.name, source, destination, vrfStr, tunnelVrfStr, queues});
   }
 
   auto out = renderTable(80);
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ConfigurationFingerprint.hpp"
+#include "CommandGenerator.hpp"
+#include <charconv>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace netcli {
+
+  namespace {
+
+    using Hash = ConfigurationFingerprint::Hash;
+
+    // 64-bit FNV-1a. Not collision resistant against a deliberate attacker;
+    // the tree detects drift, it does not authenticate configuration.
+    constexpr Hash kOffset = 0xcbf29ce484222325ULL;
+    constexpr Hash kPrime = 0x100000001b3ULL;
+
+    Hash mix(Hash h, std::string_view s) {
+      for (unsigned char c : s) {
+        h ^= c;
+        h *= kPrime;
+      }
+      return h;
+    }
+
+    Hash mix(Hash h, Hash v) {
+      for (int i = 0; i < 8; ++i) {
+        h ^= (v >> (i * 8)) & 0xff;
+        h *= kPrime;
+      }
+      return h;
+    }
+
+    std::string hex(Hash h) {
+      char buf[17];
+      std::snprintf(buf, sizeof(buf), "%016llx",
+                    static_cast<unsigned long long>(h));
+      return buf;
+    }
+
+    Hash parseHex(std::string_view s) {
+      Hash h = 0;
+      auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), h, 16);
+      if (ec != std::errc() || p != s.data() + s.size())
+        throw std::runtime_error("invalid hash '" + std::string(s) + "'");
+      return h;
+    }
+
+    std::vector<std::string_view> words(std::string_view line) {
+      std::vector<std::string_view> out;
+      size_t i = 0;
+      while (i < line.size()) {
+        while (i < line.size() && line[i] == ' ')
+          ++i;
+        size_t start = i;
+        while (i < line.size() && line[i] != ' ')
+          ++i;
+        if (i > start)
+          out.push_back(line.substr(start, i - start));
+      }
+      return out;
+    }
+
+    /// Section and object name a generated command belongs to.
+    std::pair<std::string, std::string>
+    classify(const std::vector<std::string_view> &w) {
+      auto after = [&](std::string_view key) -> std::string {
+        for (size_t i = 1; i + 1 < w.size(); ++i)
+          if (w[i] == key)
+            return std::string(w[i + 1]);
+        return {};
+      };
+      std::string_view kind = w.size() > 1 ? w[1] : std::string_view{};
+      if (kind == "interface")
+        return {"interface", after("name")};
+      if (kind == "route") {
+        std::string vrf = after("vrf");
+        return {"route", vrf.empty() ? "main" : vrf};
+      }
+      if (kind == "nexthop-group")
+        return {"nexthop-group", w.size() > 2 ? std::string(w[2]) : ""};
+      if (kind == "policy")
+        return {"policy", after("access-list")};
+      if (kind == "vrf")
+        return {"vrf", "fibs"};
+      if (kind == "arp" || kind == "ndp")
+        return {std::string(kind), "static"};
+      return {std::string(kind), "other"};
+    }
+
+  } // namespace
+
+  ConfigurationFingerprint
+  ConfigurationFingerprint::fromCommands(std::istream &in) {
+    ConfigurationFingerprint fp;
+    std::string line;
+    while (std::getline(in, line)) {
+      auto w = words(line);
+      if (w.empty() || w[0] != "set")
+        continue;
+      auto [section, name] = classify(w);
+      // An object line must stay four words for read() to accept it.
+      if (name.empty())
+        name = "-";
+      auto it =
+          fp.sections_[section].objects.try_emplace(name, kOffset).first;
+      // Hash the re-joined words so spacing differences don't count as drift.
+      for (auto word : w)
+        it->second = mix(mix(it->second, word), std::string_view(" "));
+      it->second = mix(it->second, std::string_view("\n"));
+    }
+    for (auto &[name, sec] : fp.sections_)
+      sec.count = sec.objects.size();
+    fp.seal();
+    return fp;
+  }
+
+  ConfigurationFingerprint
+  ConfigurationFingerprint::fromSystem(ConfigurationManager &mgr) {
+    std::stringstream commands;
+    CommandGenerator().generateConfiguration(mgr, commands);
+    return fromCommands(commands);
+  }
+
+  void ConfigurationFingerprint::seal() {
+    root_ = kOffset;
+    for (auto &[name, sec] : sections_) {
+      sec.hash = kOffset;
+      for (const auto &[obj, h] : sec.objects)
+        sec.hash = mix(mix(sec.hash, std::string_view(obj)), h);
+      root_ = mix(mix(root_, std::string_view(name)), sec.hash);
+    }
+  }
+
+  ConfigurationFingerprint ConfigurationFingerprint::read(std::istream &in) {
+    ConfigurationFingerprint fp;
+    bool header = false;
+    std::string line;
+    size_t lineno = 0;
+    while (std::getline(in, line)) {
+      ++lineno;
+      auto w = words(line);
+      if (w.empty() || w[0].front() == '#')
+        continue;
+      auto fail = [&](const std::string &why) {
+        return std::runtime_error("line " + std::to_string(lineno) + ": " +
+                                  why);
+      };
+      try {
+        if (w[0] == "fingerprint" && w.size() == 3) {
+          if (w[1] != "1")
+            throw fail("unsupported fingerprint version " +
+                       std::string(w[1]));
+          fp.root_ = parseHex(w[2]);
+          header = true;
+        } else if (w[0] == "section" && w.size() == 4) {
+          auto &sec = fp.sections_[std::string(w[1])];
+          sec.hash = parseHex(w[2]);
+          sec.count = std::stoul(std::string(w[3]));
+        } else if (w[0] == "object" && w.size() == 4) {
+          fp.sections_[std::string(w[1])].objects[std::string(w[2])] =
+              parseHex(w[3]);
+        } else {
+          throw fail("unrecognised line '" + line + "'");
+        }
+      } catch (const std::invalid_argument &) {
+        throw fail("invalid number in '" + line + "'");
+      }
+    }
+    if (!header)
+      throw std::runtime_error("missing 'fingerprint' header");
+    return fp;
+  }
+
+  void ConfigurationFingerprint::write(std::ostream &out,
+                                       bool objects) const {
+    out << "fingerprint 1 " << hex(root_) << "\n";
+    for (const auto &[name, sec] : sections_)
+      out << "section " << name << " " << hex(sec.hash) << " " << sec.count
+          << "\n";
+    if (!objects)
+      return;
+    for (const auto &[name, sec] : sections_)
+      for (const auto &[obj, h] : sec.objects)
+        out << "object " << name << " " << obj << " " << hex(h) << "\n";
+  }
+
+  bool
+  ConfigurationFingerprint::verify(const ConfigurationFingerprint &expected,
+                                   std::ostream &out) const {
+    if (root_ == expected.root_) {
+      out << "in sync (" << hex(root_) << ")\n";
+      return true;
+    }
+
+    static const Section empty;
+    auto find = [&](const std::map<std::string, Section> &m,
+                    const std::string &name) -> const Section & {
+      auto it = m.find(name);
+      return it == m.end() ? empty : it->second;
+    };
+
+    std::vector<std::string> names;
+    for (const auto &[name, sec] : sections_)
+      names.push_back(name);
+    for (const auto &[name, sec] : expected.sections_)
+      if (!sections_.count(name))
+        names.push_back(name);
+
+    size_t drifted = 0;
+    for (const auto &name : names) {
+      const Section &live = find(sections_, name);
+      const Section &want = find(expected.sections_, name);
+      if (live.hash == want.hash && live.count == want.count)
+        continue;
+      ++drifted;
+      // Without object hashes in the file only the section can be named.
+      if (want.objects.empty() && want.count != 0) {
+        out << "~ " << name << " (objects: " << want.count << " expected, "
+            << live.count << " present)\n";
+        continue;
+      }
+      for (const auto &[obj, h] : live.objects) {
+        auto it = want.objects.find(obj);
+        if (it == want.objects.end())
+          out << "+ " << name << " " << obj << "\n";
+        else if (it->second != h)
+          out << "~ " << name << " " << obj << "\n";
+      }
+      for (const auto &[obj, h] : want.objects)
+        if (!live.objects.count(obj))
+          out << "- " << name << " " << obj << "\n";
+    }
+    out << "drift: " << drifted << " section" << (drifted == 1 ? "" : "s")
+        << " differ (root " << hex(root_) << ", expected "
+        << hex(expected.root_) << ")\n";
+    return false;
+  }
+
+} // namespace netcli
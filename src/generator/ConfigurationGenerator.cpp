@@ -35,50 +35,140 @@
 #include "GenerateOvpnCommands.hpp"
 #include "GeneratePflogCommands.hpp"
 #include "GeneratePfsyncCommands.hpp"
+#include "GeneratePolicyCommands.hpp"
 #include "GenerateSixToFourCommands.hpp"
 #include "GenerateTapCommands.hpp"
 #include "GenerateTunCommands.hpp"
 #include "GenerateVxlanCommands.hpp"
 #include "GenerateWireGuardCommands.hpp"
 #include "GenerateWlanCommands.hpp"
+#include "InterfaceNames.hpp"
+#include "InterfaceToken.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
 
 namespace netcli {
 
+  namespace {
+
+    // Run every task once, spread over up to hardware_concurrency threads
+    // (inline when !parallel). The first failure, in task order, is
+    // rethrown once all tasks are done.
+    void runTasks(const std::vector<std::function<void()>> &tasks,
+                  bool parallel) {
+      std::vector<std::exception_ptr> errors(tasks.size());
+      std::atomic<size_t> next{0};
+      auto worker = [&] {
+        for (size_t i; (i = next.fetch_add(1)) < tasks.size();) {
+          try {
+            tasks[i]();
+          } catch (...) {
+            errors[i] = std::current_exception();
+          }
+        }
+      };
+
+      size_t threads = 1;
+      if (parallel)
+        threads = std::min<size_t>(
+            tasks.size(), std::max(1u, std::thread::hardware_concurrency()));
+      std::vector<std::thread> pool;
+      for (size_t i = 1; i < threads; ++i)
+        pool.emplace_back(worker);
+      worker();
+      for (auto &t : pool)
+        t.join();
+
+      for (auto &e : errors)
+        if (e)
+          std::rethrow_exception(e);
+    }
+
+  } // namespace
+
+  GeneratedInterface renderInterface(const InterfaceConfig &ifc,
+                                     const std::string &command) {
+    GeneratedInterface g{ifc.name, "set " + command + "\n"};
+    if (ifc.aliases.empty())
+      return g;
+    // One scratch copy for all aliases; the VRF is shared, not cloned.
+    InterfaceConfig tmp = ifc;
+    for (const auto &alias : ifc.aliases) {
+      tmp.address = alias;
+      g.commands += "set " + InterfaceToken::toString(&tmp) + "\n";
+    }
+    return g;
+  }
+
   void
-  ConfigurationGenerator::generateConfiguration(ConfigurationManager &mgr) {
-    std::set<std::string> processedInterfaces;
+  ConfigurationGenerator::generateConfiguration(ConfigurationManager &mgr,
+                                                std::ostream &out) {
+    generate(mgr, out, false);
+  }
+
+  void ConfigurationGenerator::generateInterfaces(ConfigurationManager &mgr,
+                                                  std::ostream &out) {
+    generate(mgr, out, true);
+  }
 
-    // Generate VRFs
-    generateVRFs(mgr);
+  void ConfigurationGenerator::generate(ConfigurationManager &mgr,
+                                        std::ostream &out,
+                                        bool interfacesOnly) {
+    // One enumeration of the interfaces, shared by every stage.
+    const Bases bases = mgr.GetInterfaces();
 
-    // Generate interfaces with addresses
-    generateLoopbacks(mgr, processedInterfaces);
-    generateEpairs(mgr, processedInterfaces);
-    generateBasicInterfaces(mgr, processedInterfaces);
-    generateBridges(mgr, processedInterfaces);
-    generateLaggs(mgr, processedInterfaces);
-    generateVLANs(mgr, processedInterfaces);
-    // Generate tunnels by specific type
-    generateTunCommands(mgr, processedInterfaces);
-    generateGifCommands(mgr, processedInterfaces);
-    generateOvpnCommands(mgr, processedInterfaces);
-    generateIpsecCommands(mgr, processedInterfaces);
-    generateGreCommands(mgr, processedInterfaces);
-    generateVxlanCommands(mgr, processedInterfaces);
-    generateWlanCommands(mgr, processedInterfaces);
-    generateCarpCommands(mgr, processedInterfaces);
-    generateTapCommands(mgr, processedInterfaces);
-    generatePflogCommands(mgr, processedInterfaces);
-    generatePfsyncCommands(mgr, processedInterfaces);
-    generateWireGuardCommands(mgr, processedInterfaces);
-    generateSixToFourCommands(mgr, processedInterfaces);
+    // Interface stages in output order: an interface goes to the first
+    // stage that claims it.
+    std::vector<std::function<InterfaceSection()>> stages = {
+        [&] { return generateLoopbacks(mgr, bases); },
+        [&] { return generateEpairs(mgr, bases); },
+        [&] { return generateBasicInterfaces(mgr, bases); },
+        [&] { return generateBridges(mgr, bases); },
+        [&] { return generateLaggs(mgr, bases); },
+        [&] { return generateVLANs(mgr, bases); },
+        [&] { return generateTunCommands(mgr, bases); },
+        [&] { return generateGifCommands(mgr, bases); },
+        [&] { return generateOvpnCommands(mgr, bases); },
+        [&] { return generateIpsecCommands(mgr, bases); },
+        [&] { return generateGreCommands(mgr, bases); },
+        [&] { return generateVxlanCommands(mgr, bases); },
+        [&] { return generateWlanCommands(mgr, bases); },
+        [&] { return generateCarpCommands(mgr, bases); },
+        [&] { return generateTapCommands(mgr, bases); },
+        [&] { return generatePflogCommands(mgr, bases); },
+        [&] { return generatePfsyncCommands(mgr, bases); },
+        [&] { return generateWireGuardCommands(mgr, bases); },
+        [&] { return generateSixToFourCommands(mgr, bases); },
+    };
 
-    // Generate routes
-    generateRoutes(mgr);
+    std::vector<InterfaceSection> sections(stages.size());
+    std::ostringstream vrfs, routes, arp, ndp, policies;
+    std::vector<std::function<void()>> tasks;
+    if (!interfacesOnly) {
+      // The route dump is usually the largest; start it first.
+      tasks.push_back([&] { generateRoutes(mgr, routes); });
+      tasks.push_back([&] { generateVRFs(mgr, vrfs); });
+      tasks.push_back([&] { generateArpCommands(mgr, arp); });
+      tasks.push_back([&] { generateNdpCommands(mgr, ndp); });
+      tasks.push_back([&] { generatePolicyCommands(mgr, policies); });
+    }
+    for (size_t i = 0; i < stages.size(); ++i)
+      tasks.push_back([&, i] { sections[i] = stages[i](); });
+    runTasks(tasks, mgr.SupportsConcurrentQueries());
 
-    // Generate ARP/NDP static entries
-    generateArpCommands(mgr);
-    generateNdpCommands(mgr);
+    out << vrfs.str();
+    auto &names = InterfaceNames::instance();
+    std::unordered_set<InterfaceId> processedInterfaces;
+    for (const auto &section : sections)
+      for (const auto &g : section)
+        if (processedInterfaces.insert(names.intern(g.name)).second)
+          out << g.commands;
+    out << routes.str() << arp.str() << ndp.str() << policies.str();
   }
 
 } // namespace netcli
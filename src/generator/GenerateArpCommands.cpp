@@ -6,18 +6,18 @@
 #include "GenerateArpCommands.hpp"
 #include "ArpConfig.hpp"
 #include "ArpToken.hpp"
-#include <iostream>
+#include <ostream>
 
 namespace netcli {
 
-  void generateArpCommands(ConfigurationManager &mgr) {
+  void generateArpCommands(ConfigurationManager &mgr, std::ostream &out) {
     auto entries = mgr.GetArpEntries();
     for (auto &entry : entries) {
       // Only care about published.
       if (!entry.published)
         continue;
 
-      std::cout << "set " << ArpToken::toString(&entry) << "\n";
+      out << "set " << ArpToken::toString(&entry) << "\n";
     }
   }
 
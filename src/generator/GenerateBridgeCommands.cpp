@@ -6,31 +6,16 @@
 #include "CommandGenerator.hpp"
 #include "InterfaceConfig.hpp"
 #include "InterfaceToken.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void CommandGenerator::generateBridges(
-      ConfigurationManager &mgr, std::set<std::string> &processedInterfaces) {
-    auto bridges = mgr.GetBridgeInterfaces(mgr.GetInterfaces());
-    for (const auto &ifc : bridges) {
-      if (processedInterfaces.count(ifc.name))
-        continue;
-
-      std::cout << std::string("set ") +
-                       InterfaceToken::toString(
-                           const_cast<BridgeInterfaceConfig *>(&ifc))
-                << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      // Output aliases as separate commands
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << std::string("set ") + InterfaceToken::toString(&tmp)
-                  << "\n";
-      }
-    }
+  InterfaceSection
+  CommandGenerator::generateBridges(ConfigurationManager &mgr,
+                                    const Bases &bases) {
+    InterfaceSection out;
+    for (auto &ifc : mgr.GetBridgeInterfaces(bases))
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&ifc)));
+    return out;
   }
 
 } // namespace netcli
@@ -6,18 +6,13 @@
 #include "CommandGenerator.hpp"
 #include "InterfaceConfig.hpp"
 #include "InterfaceToken.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void
-  CommandGenerator::generateEpairs(ConfigurationManager &mgr,
-                                   std::set<std::string> &processedInterfaces) {
-    auto virtuals = mgr.GetEpairInterfaces(mgr.GetInterfaces());
-    for (const auto &ifc : virtuals) {
-      if (processedInterfaces.count(ifc.name))
-        continue;
-
+  InterfaceSection CommandGenerator::generateEpairs(ConfigurationManager &mgr,
+                                                    const Bases &bases) {
+    InterfaceSection out;
+    for (auto &ifc : mgr.GetEpairInterfaces(bases)) {
       bool is_epair = false;
       for (const auto &g : ifc.groups) {
         if (g == "epair") {
@@ -28,19 +23,9 @@ namespace netcli {
       if (!is_epair)
         continue;
 
-      std::cout << std::string("set ") +
-                       InterfaceToken::toString(
-                           const_cast<EpairInterfaceConfig *>(&ifc))
-                << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << std::string("set ") + InterfaceToken::toString(&tmp)
-                  << "\n";
-      }
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&ifc)));
     }
+    return out;
   }
 
 } // namespace netcli
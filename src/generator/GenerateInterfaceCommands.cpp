@@ -6,32 +6,19 @@
 #include "CommandGenerator.hpp"
 #include "InterfaceConfig.hpp"
 #include "InterfaceToken.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void CommandGenerator::generateBasicInterfaces(
-      ConfigurationManager &mgr, std::set<std::string> &processedInterfaces) {
-    auto interfaces = mgr.GetInterfaces();
-    for (const auto &ifc : interfaces) {
-      if (processedInterfaces.count(ifc.name))
-        continue;
+  InterfaceSection
+  CommandGenerator::generateBasicInterfaces(ConfigurationManager &,
+                                            const Bases &bases) {
+    InterfaceSection out;
+    for (const auto &ifc : bases) {
       if (ifc.type != InterfaceType::Ethernet)
         continue;
-
-      std::cout << std::string("set ") +
-                       InterfaceToken::toString(
-                           const_cast<InterfaceConfig *>(&ifc))
-                << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << std::string("set ") + InterfaceToken::toString(&tmp)
-                  << "\n";
-      }
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&ifc)));
     }
+    return out;
   }
 
 } // namespace netcli
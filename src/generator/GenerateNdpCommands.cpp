@@ -6,18 +6,18 @@
 #include "GenerateNdpCommands.hpp"
 #include "NdpConfig.hpp"
 #include "NdpToken.hpp"
-#include <iostream>
+#include <ostream>
 
 namespace netcli {
 
-  void generateNdpCommands(ConfigurationManager &mgr) {
+  void generateNdpCommands(ConfigurationManager &mgr, std::ostream &out) {
     auto entries = mgr.GetNdpEntries();
     for (auto &entry : entries) {
       // Only emit permanent (static) entries — dynamic ones are learned at
       // runtime and should not be persisted in configuration.
       if (!entry.permanent)
         continue;
-      std::cout << "set " << NdpToken::toString(&entry) << "\n";
+      out << "set " << NdpToken::toString(&entry) << "\n";
     }
   }
 
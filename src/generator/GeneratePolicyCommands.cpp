@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ */
+
+#include "GeneratePolicyCommands.hpp"
+#include "PolicyConfig.hpp"
+#include "PolicyToken.hpp"
+#include <ostream>
+#include <sstream>
+
+namespace netcli {
+
+  void generatePolicyCommands(ConfigurationManager &mgr, std::ostream &out) {
+    for (const auto &pc : mgr.GetPolicies()) {
+      // toString() renders one line per rule; an empty list still needs a
+      // line of its own to be recreated.
+      std::istringstream rules(PolicyToken::toString(&pc));
+      std::string line;
+      bool any = false;
+      while (std::getline(rules, line)) {
+        out << "set " << line << "\n";
+        any = true;
+      }
+      if (!any)
+        out << "set policy access-list " << pc.access_list.id << "\n";
+    }
+  }
+
+} // namespace netcli
@@ -4,19 +4,26 @@
  */
 
 #include "CommandGenerator.hpp"
+#include "NexthopGroupConfig.hpp"
 #include "RouteConfig.hpp"
 #include "RouteToken.hpp"
-#include <iostream>
+#include <ostream>
 
 namespace netcli {
 
-  void CommandGenerator::generateRoutes(ConfigurationManager &mgr) {
+  void CommandGenerator::generateRoutes(ConfigurationManager &mgr,
+                                        std::ostream &out) {
     // Prefer backend-provided static routes if available (implementation may
     // return only user-configured/static entries). Fall back to GetRoutes()
     // if GetStaticRoutes is not implemented by the backend.
     // Request all routes from the manager, then apply our DYNAMIC-only
     // filter below. `GetStaticRoutes()` would already restrict to static
     // entries and make a DYNAMIC filter ineffective.
+
+    // Nexthop groups first: routes below may reference them by name.
+    for (auto &g : mgr.GetNexthopGroups())
+      out << "set " << RouteToken::toString(&g) << "\n";
+
     auto routes = mgr.GetRoutes();
     for (const auto &r : routes) {
       // Temporary debug: print route prefix, flags and nexthop to investigate
@@ -66,9 +73,8 @@ namespace netcli {
         continue;
       }
 
-      std::cout << std::string("set ") +
-                       RouteToken::toString(const_cast<RouteConfig *>(&r))
-                << "\n";
+      out << "set " << RouteToken::toString(const_cast<RouteConfig *>(&r))
+          << "\n";
     }
   }
 
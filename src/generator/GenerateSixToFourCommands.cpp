@@ -8,29 +8,20 @@
 #include "InterfaceToken.hpp"
 #include "InterfaceType.hpp"
 #include "SixToFourInterfaceConfig.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void generateSixToFourCommands(ConfigurationManager &mgr,
-                                 std::set<std::string> &processedInterfaces) {
-    auto ifs = mgr.GetInterfaces();
-    for (const auto &ifc : ifs) {
+  InterfaceSection
+  generateSixToFourCommands(ConfigurationManager &,
+                            const std::vector<InterfaceConfig> &bases) {
+    InterfaceSection out;
+    for (const auto &ifc : bases) {
       if (ifc.type != InterfaceType::SixToFour)
         continue;
-      if (processedInterfaces.count(ifc.name))
-        continue;
-
-      SixToFourInterfaceConfig sc(ifc);
-      std::cout << "set " << InterfaceToken::toString(&sc) << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << "set " << InterfaceToken::toString(&tmp) << "\n";
-      }
+      SixToFourInterfaceConfig cfg(ifc);
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&cfg)));
     }
+    return out;
   }
 
 } // namespace netcli
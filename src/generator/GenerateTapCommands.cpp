@@ -1,30 +1,18 @@
 #include "GenerateTapCommands.hpp"
 #include "InterfaceToken.hpp"
 #include "TapInterfaceConfig.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void generateTapCommands(ConfigurationManager &mgr,
-                           std::set<std::string> &processedInterfaces) {
-    // Tap interfaces use the basic InterfaceConfig toString since they
-    // have no extra fields beyond the base class.
-    auto bases = mgr.GetInterfaces();
-    for (const auto &ifc : bases) {
-      if (ifc.type != InterfaceType::Tap)
-        continue;
-      if (processedInterfaces.count(ifc.name))
-        continue;
-      TapInterfaceConfig tc(ifc);
-      std::cout << std::string("set ") + InterfaceToken::toString(&tc) << "\n";
-      processedInterfaces.insert(ifc.name);
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << std::string("set ") + InterfaceToken::toString(&tmp)
-                  << "\n";
-      }
-    }
+  InterfaceSection
+  generateTapCommands(ConfigurationManager &mgr,
+                      const std::vector<InterfaceConfig> &bases) {
+    // Tap interfaces carry the base InterfaceConfig plus the device
+    // options (queues, owner, vnet-hdr) read back from the driver.
+    InterfaceSection out;
+    for (auto &ifc : mgr.GetTapInterfaces(bases))
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&ifc)));
+    return out;
   }
 
 } // namespace netcli
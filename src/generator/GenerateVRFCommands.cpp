@@ -5,14 +5,15 @@
 
 #include "CommandGenerator.hpp"
 #include "VRFToken.hpp"
-#include <iostream>
+#include <ostream>
 
 namespace netcli {
 
-  void CommandGenerator::generateVRFs(ConfigurationManager &mgr) {
+  void CommandGenerator::generateVRFs(ConfigurationManager &mgr,
+                                      std::ostream &out) {
     auto vrfs = mgr.GetVrfs();
     if (!vrfs.empty()) {
-      std::cout << "set vrf fibnum " << vrfs.size() << "\n";
+      out << "set vrf fibnum " << vrfs.size() << "\n";
     }
   }
 
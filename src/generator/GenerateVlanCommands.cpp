@@ -7,16 +7,14 @@
 #include "InterfaceConfig.hpp"
 #include "InterfaceToken.hpp"
 #include <algorithm>
-#include <iostream>
 #include <numeric>
 #include <unordered_set>
 
 namespace netcli {
 
-  void
-  CommandGenerator::generateVLANs(ConfigurationManager &mgr,
-                                  std::set<std::string> &processedInterfaces) {
-    auto vlans = mgr.GetVLANInterfaces(mgr.GetInterfaces());
+  InterfaceSection CommandGenerator::generateVLANs(ConfigurationManager &mgr,
+                                                   const Bases &bases) {
+    auto vlans = mgr.GetVLANInterfaces(bases);
 
     // Build a set of all VLAN names so we can detect parent VLANs that are
     // themselves VLANs (QinQ).  Sort so that any VLAN whose parent is also
@@ -48,24 +46,12 @@ namespace netcli {
           return false;
         });
 
+    InterfaceSection out;
     for (auto idx : order) {
-      const auto &ifc = vlans[idx];
-      if (processedInterfaces.count(ifc.name))
-        continue;
-
-      std::cout << std::string("set ") +
-                       InterfaceToken::toString(
-                           const_cast<VlanInterfaceConfig *>(&ifc))
-                << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << std::string("set ") + InterfaceToken::toString(&tmp)
-                  << "\n";
-      }
+      auto &ifc = vlans[idx];
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&ifc)));
     }
+    return out;
   }
 
 } // namespace netcli
@@ -8,29 +8,20 @@
 #include "InterfaceToken.hpp"
 #include "InterfaceType.hpp"
 #include "WireGuardInterfaceConfig.hpp"
-#include <iostream>
 
 namespace netcli {
 
-  void generateWireGuardCommands(ConfigurationManager &mgr,
-                                 std::set<std::string> &processedInterfaces) {
-    auto ifs = mgr.GetInterfaces();
-    for (const auto &ifc : ifs) {
+  InterfaceSection
+  generateWireGuardCommands(ConfigurationManager &,
+                            const std::vector<InterfaceConfig> &bases) {
+    InterfaceSection out;
+    for (const auto &ifc : bases) {
       if (ifc.type != InterfaceType::WireGuard)
         continue;
-      if (processedInterfaces.count(ifc.name))
-        continue;
-
-      WireGuardInterfaceConfig wgc(ifc);
-      std::cout << "set " << InterfaceToken::toString(&wgc) << "\n";
-      processedInterfaces.insert(ifc.name);
-
-      for (const auto &alias : ifc.aliases) {
-        InterfaceConfig tmp = ifc;
-        tmp.address = alias->clone();
-        std::cout << "set " << InterfaceToken::toString(&tmp) << "\n";
-      }
+      WireGuardInterfaceConfig cfg(ifc);
+      out.push_back(renderInterface(ifc, InterfaceToken::toString(&cfg)));
     }
+    return out;
   }
 
 } // namespace netcli
@@ -27,6 +27,10 @@
 
 #include "CLI.hpp"
 #include "CommandGenerator.hpp"
+#include "ConfigurationApply.hpp"
+#include "ConfigurationBatch.hpp"
+#include "ConfigurationFingerprint.hpp"
+#include "ConfigurationSnapshot.hpp"
 #ifdef STELLERI_NETCONF
 #include "Client.hpp"
 #include "NetconfConfigurationManager.hpp"
@@ -36,6 +40,8 @@
 #ifdef STELLERI_NETCONF
 #include <libnetconf2/netconf.h>
 #endif
+#include <cstring>
+#include <fstream>
 #include <getopt.h>
 #include <iostream>
 #include <string>
@@ -43,14 +49,78 @@
 
 int main(int argc, char *argv[]) {
   std::string onecmd;
+  std::string batchFile;
   bool generate = false;
+  bool fingerprint = false;
 #ifdef STELLERI_NETCONF
   const std::string default_unix_socket = "/var/run/stelleri/netconf.sock";
   bool client_initialized = false;
 #endif
 
+  // `net apply ...` has its own option set; hand it the rest of argv.
+  if (argc > 1 && std::strcmp(argv[1], "apply") == 0) {
+    netcli::ApplyOptions opts;
+    if (!netcli::parseApplyOptions(argc - 1, argv + 1, opts))
+      return 2;
+#ifdef STELLERI_NETCONF
+    Client::init_unix(default_unix_socket);
+    NetconfConfigurationManager mgr;
+#else
+    SystemConfigurationManager mgr;
+#endif
+    return netcli::executeApply(opts, mgr);
+  }
+
+  // `net verify FILE` compares the system with a `net -g --fingerprint`
+  // capture: 0 when in sync, 1 on drift, 2 when FILE is unusable.
+  if (argc > 1 && std::strcmp(argv[1], "verify") == 0) {
+    if (argc != 3) {
+      std::cerr << "usage: net verify FILE\n";
+      return 2;
+    }
+    std::ifstream in(argv[2]);
+    if (!in) {
+      std::cerr << "net verify: cannot open " << argv[2] << "\n";
+      return 2;
+    }
+    netcli::ConfigurationFingerprint expected;
+    try {
+      expected = netcli::ConfigurationFingerprint::read(in);
+    } catch (const std::exception &e) {
+      std::cerr << "net verify: " << argv[2] << ": " << e.what() << "\n";
+      return 2;
+    }
+#ifdef STELLERI_NETCONF
+    Client::init_unix(default_unix_socket);
+    NetconfConfigurationManager mgr;
+#else
+    SystemConfigurationManager mgr;
+#endif
+    auto live = netcli::ConfigurationFingerprint::fromSystem(mgr);
+    return live.verify(expected, std::cout) ? 0 : 1;
+  }
+
+  // `net snapshot save|restore FILE`: binary snapshot of the configuration.
+  if (argc > 1 && std::strcmp(argv[1], "snapshot") == 0) {
+    bool save = argc == 4 && std::strcmp(argv[2], "save") == 0;
+    if (!save && (argc != 4 || std::strcmp(argv[2], "restore") != 0)) {
+      std::cerr << "usage: net snapshot save|restore FILE\n";
+      return 2;
+    }
+#ifdef STELLERI_NETCONF
+    Client::init_unix(default_unix_socket);
+    NetconfConfigurationManager mgr;
+#else
+    SystemConfigurationManager mgr;
+#endif
+    return save ? netcli::saveSnapshot(argv[3], mgr)
+                : netcli::restoreSnapshot(argv[3], mgr);
+  }
+
   struct option longopts[] = {{"file", required_argument, nullptr, 'f'},
+                              {"batch", required_argument, nullptr, 'b'},
                               {"generate", no_argument, nullptr, 'g'},
+                              {"fingerprint", no_argument, nullptr, 'F'},
                               {"interactive", no_argument, nullptr, 'i'},
                               {"help", no_argument, nullptr, 'h'},
 #ifdef STELLERI_NETCONF
@@ -114,9 +184,15 @@ int main(int argc, char *argv[]) {
     }
 
     switch (ch) {
+    case 'b':
+      batchFile = optarg;
+      break;
     case 'g':
       generate = true;
       break;
+    case 'F':
+      fingerprint = true;
+      break;
     case 'i':
       // Interactive mode (default anyway)
       break;
@@ -136,8 +212,20 @@ int main(int argc, char *argv[]) {
       std::cout << "  command           Execute a single command (any non-flag "
                    "args)\n";
       std::cout << "  -g, --generate    Generate configuration from system\n";
+      std::cout << "  --fingerprint     With -g, print a per-object hash tree "
+                   "instead\n";
       std::cout << "  -i, --interactive Enter interactive mode\n";
+      std::cout << "  --batch FILE      Run FILE's set/delete commands as one "
+                   "transaction\n";
       std::cout << "  -h, --help        Show this help message\n";
+      std::cout << "  apply [--routes-only] [-n] FILE\n";
+      std::cout << "                    Apply only the differences between "
+                   "FILE and the system\n";
+      std::cout << "  verify FILE       Compare the system with a "
+                   "--fingerprint capture\n";
+      std::cout << "  snapshot save|restore FILE\n";
+      std::cout << "                    Save or restore a binary snapshot of "
+                   "the configuration\n";
       std::cout << "Netconf options (STELLERI=netconf):\n";
       std::cout << "  -U, --unix PATH           Use unix socket PATH for "
                    "NETCONF client\n";
@@ -149,12 +237,27 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  if (!batchFile.empty()) {
+#ifdef STELLERI_NETCONF
+    if (!client_initialized)
+      Client::init_unix(default_unix_socket);
+    NetconfConfigurationManager mgr;
+#else
+    SystemConfigurationManager mgr;
+#endif
+    return netcli::executeBatch(batchFile, mgr);
+  }
+
   if (generate) {
 #ifdef STELLERI_NETCONF
     NetconfConfigurationManager mgr;
 #else
     SystemConfigurationManager mgr;
 #endif
+    if (fingerprint) {
+      netcli::ConfigurationFingerprint::fromSystem(mgr).write(std::cout);
+      return 0;
+    }
     netcli::CommandGenerator generator;
     generator.generateConfiguration(mgr);
     return 0;
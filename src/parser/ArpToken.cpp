@@ -55,14 +55,14 @@ std::unique_ptr<Token> ArpToken::clone() const {
 }
 
 std::shared_ptr<ArpToken>
-ArpToken::parseFromTokens(const std::vector<std::string> &tokens, size_t start,
-                          size_t &next) {
+ArpToken::parseFromTokens(const std::vector<std::string_view> &tokens,
+                          size_t start, size_t &next) {
   auto tok = std::make_shared<ArpToken>(std::string());
   next = start + 1; // consume the 'arp' token
 
   size_t i = next;
   while (i < tokens.size()) {
-    const std::string &kw = tokens[i];
+    std::string_view kw = tokens[i];
     if (kw == "ip" && i + 1 < tokens.size()) {
       tok->ip_ = tokens[i + 1];
       i += 2;
@@ -96,7 +96,7 @@ ArpToken::parseFromTokens(const std::vector<std::string> &tokens, size_t start,
 std::string ArpToken::toString(ArpConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string result = "arp " + cfg->ip;
+  std::string result = "arp " + cfg->ip.addressString();
   if (!cfg->mac.empty())
     result += " mac " + cfg->mac;
   if (cfg->iface)
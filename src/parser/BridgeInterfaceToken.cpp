@@ -15,10 +15,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(BridgeInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const BridgeInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   for (const auto &m : cfg->members)
     s += " member " + m;
   if (cfg->stp)
@@ -28,22 +29,22 @@ std::string InterfaceToken::toString(BridgeInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseBridgeKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                         const std::vector<std::string> &tokens,
-                                         size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseBridgeKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "member" && cur + 1 < tokens.size()) {
     if (!tok->bridge)
       tok->bridge.emplace();
-    tok->bridge->members.push_back(tokens[cur + 1]);
+    tok->bridge->members.emplace_back(tokens[cur + 1]);
     cur += 2;
     return true;
   }
   if (kw == "stp" && cur + 1 < tokens.size()) {
     if (!tok->bridge)
       tok->bridge.emplace();
-    const std::string &val = tokens[cur + 1];
+    std::string_view val = tokens[cur + 1];
     tok->bridge->stp =
         (val == "on" || val == "yes" || val == "true" || val == "enable");
     cur += 2;
@@ -52,7 +53,7 @@ bool InterfaceToken::parseBridgeKeywords(std::shared_ptr<InterfaceToken> &tok,
   if (kw == "priority" && cur + 1 < tokens.size()) {
     if (!tok->bridge)
       tok->bridge.emplace();
-    tok->bridge->priority = std::stoi(tokens[cur + 1]);
+    tok->bridge->priority = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
@@ -15,10 +15,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(CarpInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const CarpInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->vhid)
     s += " vhid " + std::to_string(*cfg->vhid);
   if (cfg->advskew)
@@ -30,29 +31,29 @@ std::string InterfaceToken::toString(CarpInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseCarpKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                       const std::vector<std::string> &tokens,
-                                       size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseCarpKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "vhid" && cur + 1 < tokens.size()) {
     if (!tok->carp)
       tok->carp.emplace(InterfaceConfig{});
-    tok->carp->vhid = std::stoi(tokens[cur + 1]);
+    tok->carp->vhid = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
   if (kw == "advskew" && cur + 1 < tokens.size()) {
     if (!tok->carp)
       tok->carp.emplace(InterfaceConfig{});
-    tok->carp->advskew = std::stoi(tokens[cur + 1]);
+    tok->carp->advskew = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
   if (kw == "advbase" && cur + 1 < tokens.size()) {
     if (!tok->carp)
       tok->carp.emplace(InterfaceConfig{});
-    tok->carp->advbase = std::stoi(tokens[cur + 1]);
+    tok->carp->advbase = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
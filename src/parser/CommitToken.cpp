@@ -8,7 +8,7 @@
 #include <iostream>
 
 std::shared_ptr<CommitToken>
-CommitToken::parseFromTokens(const std::vector<std::string> &tokens,
+CommitToken::parseFromTokens(const std::vector<std::string_view> &tokens,
                              size_t start, size_t &next) {
   // start points at "commit"
   size_t cur = start;
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CompletionCache.hpp"
+#include "PolicyConfig.hpp"
+#include "RouteTable.hpp"
+
+CompletionCache::CompletionCache(ConfigurationManager &mgr,
+                                 std::chrono::seconds interval)
+    : mgr_(mgr), interval_(interval),
+      snapshot_(std::make_shared<const Snapshot>()),
+      worker_([this] { run(); }) {}
+
+CompletionCache::~CompletionCache() {
+  {
+    std::lock_guard lock(wakeMutex_);
+    stop_ = true;
+  }
+  wake_.notify_one();
+  worker_.join();
+}
+
+std::shared_ptr<const CompletionCache::Snapshot>
+CompletionCache::snapshot() const {
+  std::lock_guard lock(snapshotMutex_);
+  return snapshot_;
+}
+
+void CompletionCache::invalidate() {
+  {
+    std::lock_guard lock(wakeMutex_);
+    dirty_ = true;
+  }
+  wake_.notify_one();
+}
+
+void CompletionCache::run() {
+  std::unique_lock lock(wakeMutex_);
+  while (!stop_) {
+    if (!dirty_) {
+      wake_.wait_for(lock, interval_, [this] { return stop_ || dirty_; });
+      if (stop_)
+        break;
+    }
+    dirty_ = false;
+
+    // Build without holding either lock: readers keep the old snapshot
+    // and invalidate() can mark the next refresh meanwhile.
+    lock.unlock();
+    std::shared_ptr<const Snapshot> next;
+    try {
+      next = build();
+    } catch (const std::exception &) {
+      // Keep the previous snapshot; the next interval retries.
+    }
+    if (next) {
+      std::lock_guard swap(snapshotMutex_);
+      snapshot_ = std::move(next);
+    }
+    lock.lock();
+  }
+}
+
+std::shared_ptr<const CompletionCache::Snapshot>
+CompletionCache::build() const {
+  std::vector<std::string> interfaces, groups;
+  for (const auto &ifc : mgr_.GetInterfaces()) {
+    interfaces.push_back(ifc.name);
+    groups.insert(groups.end(), ifc.groups.begin(), ifc.groups.end());
+  }
+
+  std::vector<std::string> vrfs{"0"}, vrfNames;
+  for (const auto &v : mgr_.GetVrfs()) {
+    vrfs.push_back(std::to_string(v.table));
+    if (!v.name.empty())
+      vrfNames.push_back(v.name);
+  }
+
+  std::vector<std::string> acls;
+  for (const auto &pc : mgr_.GetPolicies())
+    if (pc.policy_type == PolicyConfig::Type::AccessList)
+      acls.push_back(std::to_string(pc.access_list.id));
+
+  RouteTable routes = mgr_.GetRouteTable();
+  std::vector<std::string> prefixes;
+  prefixes.reserve(routes.size());
+  for (size_t i = 0; i < routes.size(); ++i)
+    prefixes.push_back(routes.prefix(i).toString());
+
+  auto s = std::make_shared<Snapshot>();
+  s->interfaces = CompletionIndex(std::move(interfaces));
+  s->groups = CompletionIndex(std::move(groups));
+  s->vrfs = CompletionIndex(std::move(vrfs));
+  s->vrfNames = CompletionIndex(std::move(vrfNames));
+  s->acls = CompletionIndex(std::move(acls));
+  s->prefixes = CompletionIndex(std::move(prefixes));
+  return s;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CompletionIndex.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+  bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+  bool isSeparator(char c) {
+    return c == '.' || c == '-' || c == '_' || c == '/' || c == ':';
+  }
+
+  /// Subsequence score of `pattern` in `name`, or -1 when it does not
+  /// occur. Matching is greedy left to right.
+  int subsequenceScore(std::string_view pattern, std::string_view name) {
+    int score = 0;
+    size_t p = 0;
+    size_t last = std::string_view::npos;
+    for (size_t i = 0; i < name.size() && p < pattern.size(); ++i) {
+      if (name[i] != pattern[p])
+        continue;
+      score += 1;
+      if (last != std::string_view::npos && last + 1 == i)
+        score += 3; // consecutive
+      if (i == 0 || isSeparator(name[i - 1]) ||
+          isDigit(name[i - 1]) != isDigit(name[i]))
+        score += 2; // start of a segment
+      last = i;
+      ++p;
+    }
+    if (p < pattern.size())
+      return -1;
+    // Prefer the shorter name among equal matches.
+    return score * 64 - static_cast<int>(std::min<size_t>(name.size(), 63));
+  }
+} // namespace
+
+bool CompletionIndex::naturalLess(std::string_view a, std::string_view b) {
+  size_t i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (isDigit(a[i]) && isDigit(b[j])) {
+      size_t ie = i, je = j;
+      while (ie < a.size() && isDigit(a[ie]))
+        ++ie;
+      while (je < b.size() && isDigit(b[je]))
+        ++je;
+      // Compare digit runs by value: skip leading zeros, then the longer
+      // run is larger, then compare digit by digit.
+      size_t is = i, js = j;
+      while (is + 1 < ie && a[is] == '0')
+        ++is;
+      while (js + 1 < je && b[js] == '0')
+        ++js;
+      if (ie - is != je - js)
+        return ie - is < je - js;
+      int c = a.substr(is, ie - is).compare(b.substr(js, je - js));
+      if (c != 0)
+        return c < 0;
+      i = ie;
+      j = je;
+      continue;
+    }
+    if (a[i] != b[j])
+      return static_cast<unsigned char>(a[i]) <
+             static_cast<unsigned char>(b[j]);
+    ++i;
+    ++j;
+  }
+  if (a.size() - i != b.size() - j)
+    return a.size() - i < b.size() - j;
+  return a < b; // equal by value ("eth01" vs "eth1"): fall back to bytes
+}
+
+CompletionIndex::CompletionIndex(std::vector<std::string> names)
+    : names_(std::move(names)) {
+  std::sort(names_.begin(), names_.end());
+  names_.erase(std::unique(names_.begin(), names_.end()), names_.end());
+
+  // names_ is in byte order now; record that order, then re-sort naturally
+  // and remap the recorded positions.
+  std::vector<uint32_t> natural(names_.size());
+  std::iota(natural.begin(), natural.end(), 0);
+  std::sort(natural.begin(), natural.end(), [&](uint32_t x, uint32_t y) {
+    return naturalLess(names_[x], names_[y]);
+  });
+  std::vector<uint32_t> rank(names_.size());
+  for (uint32_t r = 0; r < natural.size(); ++r)
+    rank[natural[r]] = r;
+
+  std::vector<std::string> sorted;
+  sorted.reserve(names_.size());
+  for (uint32_t i : natural)
+    sorted.push_back(std::move(names_[i]));
+  names_ = std::move(sorted);
+  bytewise_ = std::move(rank);
+}
+
+std::vector<std::string>
+CompletionIndex::prefixed(std::string_view prefix) const {
+  auto lo = std::lower_bound(
+      bytewise_.begin(), bytewise_.end(), prefix,
+      [&](uint32_t i, std::string_view p) { return names_[i] < p; });
+  auto hi = lo;
+  while (hi != bytewise_.end() && names_[*hi].starts_with(prefix))
+    ++hi;
+
+  std::vector<uint32_t> hits(lo, hi);
+  std::sort(hits.begin(), hits.end());
+  std::vector<std::string> out;
+  out.reserve(hits.size());
+  for (uint32_t i : hits)
+    out.push_back(names_[i]);
+  return out;
+}
+
+std::vector<std::string> CompletionIndex::fuzzy(std::string_view pattern,
+                                                size_t limit) const {
+  std::vector<std::pair<int, uint32_t>> scored;
+  for (uint32_t i = 0; i < names_.size(); ++i) {
+    int s = subsequenceScore(pattern, names_[i]);
+    if (s >= 0)
+      scored.emplace_back(-s, i);
+  }
+  size_t n = std::min(limit, scored.size());
+  std::partial_sort(scored.begin(), scored.begin() + n, scored.end());
+  std::vector<std::string> out;
+  out.reserve(n);
+  for (size_t k = 0; k < n; ++k)
+    out.push_back(names_[scored[k].second]);
+  return out;
+}
+
+std::vector<std::string>
+CompletionIndex::complete(std::string_view partial) const {
+  auto out = prefixed(partial);
+  if (out.empty() && !partial.empty())
+    out = fuzzy(partial);
+  return out;
+}
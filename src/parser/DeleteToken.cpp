@@ -26,6 +26,7 @@
  */
 
 #include "DeleteToken.hpp"
+#include "Parser.hpp"
 
 std::string DeleteToken::toString() const { return "delete"; }
 
@@ -33,14 +34,7 @@ std::string DeleteToken::toString() const { return "delete"; }
 
 std::vector<std::string>
 DeleteToken::autoComplete(std::string_view partial) const {
-  std::vector<std::string> options = {"interface", "interfaces", "route", "arp",
-                                      "ndp",       "vrf",        "policy"};
-  std::vector<std::string> matches;
-  for (const auto &opt : options) {
-    if (opt.rfind(partial, 0) == 0)
-      matches.push_back(opt);
-  }
-  return matches;
+  return netcli::Parser::completeNoun(partial);
 }
 
 std::unique_ptr<Token> DeleteToken::clone() const {
@@ -16,10 +16,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(GifInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const GifInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->source)
     s += " source " + cfg->source->toString();
   if (cfg->destination)
@@ -29,10 +30,10 @@ std::string InterfaceToken::toString(GifInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseGifKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                      const std::vector<std::string> &tokens,
-                                      size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseGifKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "source" && cur + 1 < tokens.size()) {
     tok->source = tokens[cur + 1];
@@ -45,7 +46,7 @@ bool InterfaceToken::parseGifKeywords(std::shared_ptr<InterfaceToken> &tok,
     return true;
   }
   if ((kw == "tunnel-vrf" || kw == "tunnel-fib") && cur + 1 < tokens.size()) {
-    tok->tunnel_vrf = std::stoi(tokens[cur + 1]);
+    tok->tunnel_vrf = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
@@ -15,10 +15,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(GreInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const GreInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->greSource)
     s += " source " + *cfg->greSource;
   if (cfg->greDestination)
@@ -28,10 +29,10 @@ std::string InterfaceToken::toString(GreInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseGreKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                      const std::vector<std::string> &tokens,
-                                      size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseGreKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "source" && cur + 1 < tokens.size()) {
     tok->source = tokens[cur + 1];
@@ -46,7 +47,7 @@ bool InterfaceToken::parseGreKeywords(std::shared_ptr<InterfaceToken> &tok,
   if (kw == "key" && cur + 1 < tokens.size()) {
     if (!tok->gre)
       tok->gre.emplace(InterfaceConfig{});
-    tok->gre->greKey = static_cast<uint32_t>(std::stoul(tokens[cur + 1]));
+    tok->gre->greKey = static_cast<uint32_t>(tokenULong(tokens[cur + 1]));
     cur += 2;
     return true;
   }
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "HistoryLog.hpp"
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
+
+namespace {
+  /// Header line of files written by libedit's H_SAVE.
+  constexpr std::string_view kLibeditHeader = "_HiStOrY_V2_";
+
+  /// Undo the strvis() encoding H_SAVE applies to each line: "\040" style
+  /// octal escapes and "\\".
+  std::string unvis(std::string_view s) {
+    std::string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+      if (s[i] == '\\' && i + 1 < s.size() && s[i + 1] == '\\') {
+        out += '\\';
+        ++i;
+      } else if (s[i] == '\\' && i + 3 < s.size() && s[i + 1] >= '0' &&
+                 s[i + 1] <= '3' && s[i + 2] >= '0' && s[i + 2] <= '7' &&
+                 s[i + 3] >= '0' && s[i + 3] <= '7') {
+        out += static_cast<char>((s[i + 1] - '0') * 64 +
+                                 (s[i + 2] - '0') * 8 + (s[i + 3] - '0'));
+        i += 3;
+      } else {
+        out += s[i];
+      }
+    }
+    return out;
+  }
+
+  uint32_t trigramKey(std::string_view g) {
+    return static_cast<uint32_t>(static_cast<unsigned char>(g[0])) << 16 |
+           static_cast<uint32_t>(static_cast<unsigned char>(g[1])) << 8 |
+           static_cast<uint32_t>(static_cast<unsigned char>(g[2]));
+  }
+
+  bool writeAll(int fd, std::string_view data) {
+    while (!data.empty()) {
+      ssize_t n = ::write(fd, data.data(), data.size());
+      if (n < 0)
+        return false;
+      data.remove_prefix(static_cast<size_t>(n));
+    }
+    return true;
+  }
+} // namespace
+
+HistoryLog::HistoryLog(std::string path, size_t maxEntries)
+    : path_(std::move(path)), maxEntries_(maxEntries),
+      lastSync_(std::chrono::steady_clock::now()) {
+  if (path_.empty())
+    return;
+  load();
+  fd_ = ::open(path_.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0600);
+}
+
+HistoryLog::~HistoryLog() {
+  flush();
+  if (fd_ >= 0)
+    ::close(fd_);
+}
+
+void HistoryLog::load() {
+  std::ifstream in(path_);
+  bool legacy = false;
+  std::string line;
+  for (bool first = true; std::getline(in, line); first = false) {
+    if (first && line == kLibeditHeader) {
+      legacy = true;
+      continue;
+    }
+    if (line.empty())
+      continue;
+    entries_.push_back(legacy ? unvis(line) : std::move(line));
+  }
+
+  bool trimmed = entries_.size() > maxEntries_;
+  if (trimmed)
+    entries_.erase(entries_.begin(),
+                   entries_.end() - static_cast<ptrdiff_t>(maxEntries_));
+  if (legacy || trimmed)
+    rewrite();
+
+  for (uint32_t id = 0; id < entries_.size(); ++id)
+    index(id);
+}
+
+void HistoryLog::rewrite() {
+  std::string data;
+  for (const auto &e : entries_) {
+    data += e;
+    data += '\n';
+  }
+  // Write a sibling file and rename it over the log, so a crash leaves
+  // either the old or the new history behind.
+  std::string tmp = path_ + ".tmp";
+  int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd < 0)
+    return;
+  bool ok = writeAll(fd, data) && ::fsync(fd) == 0;
+  ::close(fd);
+  if (!ok || std::rename(tmp.c_str(), path_.c_str()) != 0)
+    ::unlink(tmp.c_str());
+}
+
+void HistoryLog::index(uint32_t id) {
+  std::string_view e = entries_[id];
+  for (size_t i = 0; i + 3 <= e.size(); ++i) {
+    auto &ids = trigrams_[trigramKey(e.substr(i, 3))];
+    if (ids.empty() || ids.back() != id)
+      ids.push_back(id);
+  }
+}
+
+const std::vector<uint32_t> *
+HistoryLog::postings(std::string_view gram) const {
+  auto it = trigrams_.find(trigramKey(gram));
+  return it == trigrams_.end() ? nullptr : &it->second;
+}
+
+void HistoryLog::append(std::string_view line) {
+  entries_.emplace_back(line);
+  index(static_cast<uint32_t>(entries_.size() - 1));
+  if (fd_ < 0)
+    return;
+
+  std::string rec(line);
+  rec += '\n';
+  if (!writeAll(fd_, rec)) {
+    // Keep the session's history in memory; stop touching the file.
+    ::close(fd_);
+    fd_ = -1;
+    return;
+  }
+  ++unsynced_;
+  if (unsynced_ >= kSyncEvery ||
+      std::chrono::steady_clock::now() - lastSync_ >= kSyncInterval)
+    flush();
+}
+
+void HistoryLog::flush() {
+  if (fd_ < 0 || unsynced_ == 0)
+    return;
+  ::fsync(fd_);
+  unsynced_ = 0;
+  lastSync_ = std::chrono::steady_clock::now();
+}
+
+// ── Search ──────────────────────────────────────────────────────────
+
+void HistoryLog::Search::push(char c) {
+  query_ += c;
+
+  // Candidates: the previous keystroke's matches, or the entries holding
+  // the newest trigram of the query if there are fewer of those.
+  const std::vector<uint32_t> *from =
+      levels_.empty() ? nullptr : &levels_.back();
+  if (query_.size() >= 3) {
+    const auto *ids =
+        log_.postings(std::string_view(query_).substr(query_.size() - 3));
+    if (!ids) {
+      levels_.emplace_back();
+      return;
+    }
+    if (!from || ids->size() < from->size())
+      from = ids;
+  }
+
+  std::vector<uint32_t> next;
+  auto test = [&](uint32_t id) {
+    if (log_.entries_[id].find(query_) != std::string::npos)
+      next.push_back(id);
+  };
+  if (from) {
+    for (uint32_t id : *from)
+      test(id);
+  } else {
+    for (uint32_t id = 0; id < log_.entries_.size(); ++id)
+      test(id);
+  }
+  levels_.push_back(std::move(next));
+}
+
+void HistoryLog::Search::pop() {
+  if (query_.empty())
+    return;
+  query_.pop_back();
+  levels_.pop_back();
+}
+
+const std::vector<uint32_t> &HistoryLog::Search::matches() const {
+  static const std::vector<uint32_t> none;
+  return levels_.empty() ? none : levels_.back();
+}
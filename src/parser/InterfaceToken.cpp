@@ -26,16 +26,17 @@
  */
 
 #include "InterfaceToken.hpp"
-#include "IPAddress.hpp"
-#include "IPNetwork.hpp"
+#include "CompletionCache.hpp"
+#include "IPPrefix.hpp"
 #include "InterfaceConfig.hpp"
 #include "InterfaceFlags.hpp"
 #include "InterfaceTableFormatter.hpp"
 #include "InterfaceType.hpp"
+#include "KeywordTrie.hpp"
 #include "SingleInterfaceSummaryFormatter.hpp"
 #include <iostream>
 #include <netinet/in.h>
-#include <unordered_set>
+#include <stdexcept>
 
 InterfaceToken::InterfaceToken(InterfaceType t, std::string name)
     : type_(t), name_(std::move(name)) {}
@@ -114,20 +115,47 @@ const InterfaceTypeDispatch *InterfaceToken::dispatch(InterfaceType t) {
 // Helpers: keyword sets for context-aware autocompletion
 // ---------------------------------------------------------------------------
 namespace {
+  /// A keyword applicable to every interface type. Keywords with a value
+  /// slot consume the following token and pass it to apply().
+  struct GeneralKeyword {
+    bool takesValue;
+    void (*apply)(InterfaceToken &tok, std::string_view value);
+  };
+
+  const KeywordTrie<GeneralKeyword> &generalKeywordTable() {
+    using Tok = InterfaceToken;
+    using Str = std::string_view;
+    static const KeywordTrie<GeneralKeyword> table{
+        {"inet", {false, [](Tok &t, Str) { t.address_family = AF_INET; }}},
+        {"inet6", {false, [](Tok &t, Str) { t.address_family = AF_INET6; }}},
+        {"address", {true, [](Tok &t, Str v) { t.address = v; }}},
+        {"mtu", {true, [](Tok &t, Str v) { t.mtu = tokenInt(v); }}},
+        {"vrf", {true, [](Tok &t, Str v) { t.vrf = tokenInt(v); }}},
+        {"fib", {true, [](Tok &t, Str v) { t.vrf = tokenInt(v); }}, true},
+        {"group", {true, [](Tok &t, Str v) { t.group = v; }}},
+        {"up", {false, [](Tok &t, Str) { t.status = true; }}},
+        {"down", {false, [](Tok &t, Str) { t.status = false; }}},
+        {"status", {true,
+                    [](Tok &t, Str v) {
+                      if (v == "up")
+                        t.status = true;
+                      else if (v == "down")
+                        t.status = false;
+                    }}},
+        {"description", {true, [](Tok &t, Str v) { t.description = v; }}},
+    };
+    return table;
+  }
+
   /// Keywords applicable to every interface type.
   std::vector<std::string> generalKeywords() {
-    return {"inet",  "inet6", "address", "mtu",    "vrf",
-            "group", "up",    "down",    "status", "description"};
+    return generalKeywordTable().complete("");
   }
 
   /// Value suggestions for a keyword that expects a fixed set of values.
   std::vector<std::string> valuesForKeyword(const std::string &kw) {
-    if (kw == "type") {
-      return {"ethernet", "loopback", "bridge", "lagg",  "vlan",  "tunnel",
-              "tun",      "gif",      "gre",    "vxlan", "ipsec", "epair",
-              "virtual",  "wireless", "tap",    "ppp",   "stf",   "ovpn",
-              "carp",     "pflog",    "pfsync", "wg"};
-    }
+    if (kw == "type")
+      return interfaceTypeKeywords().complete("");
     if (kw == "status") {
       return {"up", "down"};
     }
@@ -167,7 +195,7 @@ std::unique_ptr<Token> InterfaceToken::clone() const {
 std::vector<std::string>
 InterfaceToken::autoComplete(const std::vector<std::string> &tokens,
                              std::string_view partial,
-                             ConfigurationManager *mgr) const {
+                             const CompletionCache *cache) const {
   std::vector<std::string> matches;
 
   // If user typed `type` and is now completing the type value, suggest types
@@ -195,69 +223,48 @@ InterfaceToken::autoComplete(const std::vector<std::string> &tokens,
     return filterPrefix(valuesForKeyword("status"), partial);
   }
 
-  // --- Value completions from live system state (require mgr) ---
+  // --- Value completions from cached system state ---
+
+  if (cache) {
+    auto snap = cache->snapshot();
 
-  if (mgr) {
     // After "group", list all known interface groups
-    if (prev == "group") {
-      std::unordered_set<std::string> groups;
-      auto ifs = mgr->GetInterfaces();
-      for (const auto &i : ifs) {
-        for (const auto &g : i.groups) {
-          groups.insert(g);
-        }
-      }
-      for (const auto &g : groups) {
-        if (g.rfind(partial, 0) == 0)
-          matches.push_back(g);
-      }
-      return matches;
-    }
+    if (prev == "group")
+      return snap->groups.complete(partial);
 
     // After "name", list all known interface names
-    if (prev == "name") {
-      auto ifs = mgr->GetInterfaces();
-      for (const auto &i : ifs) {
-        const std::string &iname = i.name;
-        if (iname.rfind(partial, 0) == 0)
-          matches.push_back(iname);
-      }
-      return matches;
-    }
+    if (prev == "name")
+      return snap->interfaces.complete(partial);
+
+    // After "vrf" or "fib", list the routing tables in use
+    if (prev == "vrf" || prev == "fib")
+      return snap->vrfs.complete(partial);
 
     // After "member" or "parent", suggest available interface names
     if (prev == "member" || prev == "parent") {
-      auto ifs = mgr->GetInterfaces();
-      for (const auto &i : ifs) {
-        // Don't suggest the interface being configured as its own member/parent
-        if (i.name == name_)
-          continue;
-        if (i.name.rfind(partial, 0) == 0)
-          matches.push_back(i.name);
-      }
+      // Don't suggest the interface being configured as its own member/parent
+      matches = snap->interfaces.complete(partial);
+      std::erase(matches, name_);
       return matches;
     }
 
     // After "members" (lagg), suggest comma-separated interface names
     if (prev == "members") {
-      auto ifs = mgr->GetInterfaces();
       // If partial already contains a comma, complete the last segment
-      std::string prefix_part;
-      std::string last_seg(partial);
+      std::string_view prefix_part;
+      std::string_view last_seg = partial;
       auto comma_pos = last_seg.rfind(',');
-      if (comma_pos != std::string::npos) {
+      if (comma_pos != std::string_view::npos) {
         prefix_part = last_seg.substr(0, comma_pos + 1);
         last_seg = last_seg.substr(comma_pos + 1);
       }
-      for (const auto &i : ifs) {
-        if (i.name == name_)
-          continue;
-        if (i.name.rfind(last_seg, 0) == 0)
-          matches.push_back(prefix_part + i.name);
+      for (const auto &n : snap->interfaces.complete(last_seg)) {
+        if (n != name_)
+          matches.push_back(std::string(prefix_part) + n);
       }
       return matches;
     }
-  } // mgr
+  } // cache
 
   // If the previous token is a known interface name (i.e. we are past
   // "interface name <ifname>"), suggest type-specific and general keywords.
@@ -304,7 +311,7 @@ InterfaceToken::autoComplete(const std::vector<std::string> &tokens,
 // ---------------------------------------------------------------------------
 // Static renderers for interface configs
 // ---------------------------------------------------------------------------
-std::string InterfaceToken::toString(InterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const InterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
   std::string result = "interface name " + cfg->name;
@@ -350,61 +357,34 @@ InterfaceToken::typeCompletions(InterfaceType t, const std::string &prev) {
 // parseKeywords — general keywords + type-based dispatch
 // ---------------------------------------------------------------------------
 void InterfaceToken::parseKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                   const std::vector<std::string> &tokens,
+                                   const std::vector<std::string_view> &tokens,
                                    size_t &cur) {
   while (cur < tokens.size()) {
-    const std::string &kw = tokens[cur];
+    std::string_view kw = tokens[cur];
 
     // --- General keywords (all types) ---
-    if (kw == "inet" || kw == "inet6") {
-      tok->address_family = (kw == "inet") ? AF_INET : AF_INET6;
-      if (cur + 1 < tokens.size() && tokens[cur + 1] == "address" &&
-          cur + 2 < tokens.size()) {
-        tok->address = tokens[cur + 2];
-        cur += 3;
+    // `inet address X` parses as the family keyword followed by `address X`.
+    if (const auto *g = generalKeywordTable().find(kw)) {
+      if (!g->takesValue) {
+        g->apply(*tok, kw);
+        ++cur;
+        continue;
+      }
+      if (cur + 1 < tokens.size()) {
+        g->apply(*tok, tokens[cur + 1]);
+        cur += 2;
         continue;
       }
-      ++cur;
-      continue;
-    }
-    if (kw == "group" && cur + 1 < tokens.size()) {
-      tok->group = tokens[cur + 1];
-      cur += 2;
-      continue;
-    }
-    if (kw == "mtu" && cur + 1 < tokens.size()) {
-      tok->mtu = std::stoi(tokens[cur + 1]);
-      cur += 2;
-      continue;
-    }
-    if ((kw == "fib" || kw == "vrf") && cur + 1 < tokens.size()) {
-      tok->vrf = std::stoi(tokens[cur + 1]);
-      cur += 2;
-      continue;
-    }
-    if (kw == "up") {
-      tok->status = true;
-      ++cur;
-      continue;
-    }
-    if (kw == "down") {
-      tok->status = false;
-      ++cur;
-      continue;
-    }
-    if (kw == "status" && cur + 1 < tokens.size()) {
-      const std::string &val = tokens[cur + 1];
-      if (val == "up")
-        tok->status = true;
-      else if (val == "down")
-        tok->status = false;
-      cur += 2;
-      continue;
     }
-    if (kw == "description" && cur + 1 < tokens.size()) {
-      tok->description = tokens[cur + 1];
-      cur += 2;
-      continue;
+    // `name <name> type <type>` — the form emitted by toString()
+    if (kw == "type" && tok->type_ == InterfaceType::Unknown &&
+        cur + 1 < tokens.size()) {
+      InterfaceType t = interfaceTypeFromString(tokens[cur + 1]);
+      if (t != InterfaceType::Unknown) {
+        tok->type_ = t;
+        cur += 2;
+        continue;
+      }
     }
 
     // --- Type-specific keywords ---
@@ -423,19 +403,19 @@ void InterfaceToken::parseKeywords(std::shared_ptr<InterfaceToken> &tok,
 // parseFromTokens — entry point
 // ---------------------------------------------------------------------------
 std::shared_ptr<InterfaceToken>
-InterfaceToken::parseFromTokens(const std::vector<std::string> &tokens,
+InterfaceToken::parseFromTokens(const std::vector<std::string_view> &tokens,
                                 size_t start, size_t &next) {
   next = start + 1; // by default consume the 'interfaces' token
   if (start + 1 < tokens.size()) {
     // There is at least one token after 'interfaces'
-    const std::string &a = tokens[start + 1];
-    const std::string b =
-        (start + 2 < tokens.size()) ? tokens[start + 2] : std::string();
+    std::string_view a = tokens[start + 1];
+    std::string_view b =
+        (start + 2 < tokens.size()) ? tokens[start + 2] : std::string_view();
 
     // support `interfaces group <group>`
     if (a == "group") {
       if (!b.empty()) {
-        std::string grp = b;
+        std::string grp(b);
         size_t nnext = start + 3;
         auto tok = std::make_shared<InterfaceToken>(InterfaceType::Unknown,
                                                     std::string());
@@ -448,7 +428,7 @@ InterfaceToken::parseFromTokens(const std::vector<std::string> &tokens,
     // support `interfaces name <name>`
     if (a == "name") {
       if (!b.empty()) {
-        std::string name = b;
+        std::string name(b);
         auto tok =
             std::make_shared<InterfaceToken>(InterfaceType::Unknown, name);
         size_t cur = start + 3;
@@ -494,7 +474,7 @@ InterfaceToken::parseFromTokens(const std::vector<std::string> &tokens,
       // original form: interfaces <type> <name>
       itype = interfaceTypeFromString(a);
       if (itype != InterfaceType::Unknown && !b.empty()) {
-        auto tok = std::make_shared<InterfaceToken>(itype, b);
+        auto tok = std::make_shared<InterfaceToken>(itype, std::string(b));
         size_t cur = start + 3;
         parseKeywords(tok, tokens, cur);
         next = cur;
@@ -511,100 +491,96 @@ InterfaceToken::parseFromTokens(const std::vector<std::string> &tokens,
 // executeSet — common base setup + type dispatch
 // ---------------------------------------------------------------------------
 void InterfaceToken::executeSet(ConfigurationManager *mgr) const {
-  if (name_.empty()) {
-    std::cerr << "set interface: missing interface name\n";
-    return;
+  try {
+    applySet(*mgr);
+  } catch (const std::exception &e) {
+    std::cerr << "set interface: " << e.what() << "\n";
   }
+}
 
-  try {
-    bool exists = InterfaceConfig::exists(*mgr, name_);
-    auto ifopt = (exists && mgr) ? mgr->GetInterface(name_)
-                                 : std::optional<InterfaceConfig>{};
-    InterfaceConfig base = ifopt ? *ifopt : InterfaceConfig();
-    if (!ifopt)
-      base.name = name_;
-
-    if (vrf) {
-      if (!base.vrf)
-        base.vrf = std::make_unique<VRFConfig>(*vrf);
-      else
-        base.vrf->table = *vrf;
-    }
+void InterfaceToken::applySet(ConfigurationManager &mgr) const {
+  if (name_.empty())
+    throw std::invalid_argument("missing interface name");
+
+  bool exists = InterfaceConfig::exists(mgr, name_);
+  auto ifopt = exists ? mgr.GetInterface(name_)
+                      : std::optional<InterfaceConfig>{};
+  InterfaceConfig base = ifopt ? *ifopt : InterfaceConfig();
+  if (!ifopt)
+    base.name = name_;
+
+  if (vrf)
+    base.vrf = std::make_shared<const VRFConfig>(*vrf);
+
+  InterfaceType effectiveType = InterfaceType::Unknown;
+  if (type_ != InterfaceType::Unknown)
+    effectiveType = type_;
+  else if (base.type != InterfaceType::Unknown)
+    effectiveType = base.type;
+
+  if (address) {
+    auto net = IPPrefix::fromString(*address);
+    if (!net)
+      throw std::invalid_argument("invalid address '" + *address + "'");
+    if (!base.address)
+      base.address = *net;
+    else
+      base.aliases.emplace_back(*net);
+  }
 
-    InterfaceType effectiveType = InterfaceType::Unknown;
-    if (type_ != InterfaceType::Unknown)
-      effectiveType = type_;
-    else if (base.type != InterfaceType::Unknown)
-      effectiveType = base.type;
-
-    if (address) {
-      auto net = IPNetwork::fromString(*address);
-      if (net) {
-        if (!base.address)
-          base.address = std::move(net);
-        else
-          base.aliases.emplace_back(net->clone());
-      } else {
-        std::cerr << "set interface: invalid address '" << *address << "'\n";
+  if (group) {
+    bool has_group = false;
+    for (const auto &g : base.groups) {
+      if (g == *group) {
+        has_group = true;
+        break;
       }
     }
+    if (!has_group)
+      base.groups.push_back(*group);
+  }
 
-    if (group) {
-      bool has_group = false;
-      for (const auto &g : base.groups) {
-        if (g == *group) {
-          has_group = true;
-          break;
-        }
-      }
-      if (!has_group)
-        base.groups.push_back(*group);
-    }
+  if (mtu)
+    base.mtu = *mtu;
+  else
+    base.mtu.reset();
 
-    if (mtu)
-      base.mtu = *mtu;
-    else
-      base.mtu.reset();
-
-    if (status) {
-      if (base.flags) {
-        if (*status)
-          *base.flags |= flagBit(InterfaceFlag::UP);
-        else
-          *base.flags &= ~flagBit(InterfaceFlag::UP);
-      } else {
-        base.flags = *status ? flagBit(InterfaceFlag::UP) : 0u;
-      }
+  if (status) {
+    if (base.flags) {
+      if (*status)
+        *base.flags |= flagBit(InterfaceFlag::UP);
+      else
+        *base.flags &= ~flagBit(InterfaceFlag::UP);
+    } else {
+      base.flags = *status ? flagBit(InterfaceFlag::UP) : 0u;
     }
+  }
 
-    if (description)
-      base.description = *description;
+  if (description)
+    base.description = *description;
 
+  // Usage errors from the type setters pass through as they are; anything
+  // the backend throws is reported against the interface.
+  try {
     if (auto *d = dispatch(effectiveType); d && d->setInterface) {
-      d->setInterface(*this, mgr, base, exists);
+      d->setInterface(*this, &mgr, base, exists);
       return;
     }
 
     // No specific type matched — alias or generic update
-    if (address && exists) {
-      auto net = IPNetwork::fromString(*address);
-      if (!net) {
-        std::cerr << "set interface: invalid address '" << *address << "'\n";
-        return;
-      }
-      base.aliases.emplace_back(net->clone());
-      base.save(*mgr);
+    // (the address was already appended to base above)
+    base.save(mgr);
+    if (address && exists)
       std::cout << "set interface: added alias '" << *address << "' to '"
                 << name_ << "'\n";
-      return;
-    }
-
-    base.save(*mgr);
-    std::cout << "set interface: " << (exists ? "updated" : "created")
-              << " interface '" << name_ << "'\n";
+    else
+      std::cout << "set interface: " << (exists ? "updated" : "created")
+                << " interface '" << name_ << "'\n";
+  } catch (const std::invalid_argument &) {
+    throw;
   } catch (const std::exception &e) {
-    std::cerr << "set interface: failed to create/update '" << name_
-              << "': " << e.what() << "\n";
+    throw std::runtime_error("failed to create/update '" + name_ +
+                             "': " + e.what());
   }
 }
 
@@ -676,21 +652,26 @@ void InterfaceToken::executeShow(ConfigurationManager *mgr) const {
 // executeDelete — group/address/destroy
 // ---------------------------------------------------------------------------
 void InterfaceToken::executeDelete(ConfigurationManager *mgr) const {
-  if (name_.empty()) {
-    std::cerr << "delete interface: missing interface name\n";
-    return;
+  try {
+    applyDelete(*mgr);
+  } catch (const std::exception &e) {
+    std::cerr << "delete interface: " << e.what() << "\n";
   }
+}
 
-  if (!InterfaceConfig::exists(*mgr, name_)) {
-    std::cerr << "delete interface: interface '" << name_ << "' not found\n";
-    return;
-  }
+void InterfaceToken::applyDelete(ConfigurationManager &mgr) const {
+  if (name_.empty())
+    throw std::invalid_argument("missing interface name");
+
+  if (!InterfaceConfig::exists(mgr, name_))
+    throw std::invalid_argument("interface '" + name_ + "' not found");
 
   InterfaceConfig ic;
   ic.name = name_;
+  std::string current; // the address being removed, for the error
   try {
     if (group) {
-      mgr->RemoveInterfaceGroup(name_, *group);
+      mgr.RemoveInterfaceGroup(name_, *group);
       std::cout << "delete interface: removed group '" << *group << "' from '"
                 << name_ << "'\n";
       return;
@@ -701,28 +682,26 @@ void InterfaceToken::executeDelete(ConfigurationManager *mgr) const {
       if (address) {
         to_remove.push_back(*address);
       } else if (address_family && *address_family == AF_INET) {
-        to_remove = mgr->GetInterfaceAddresses(name_, AF_INET);
+        to_remove = mgr.GetInterfaceAddresses(name_, AF_INET);
       } else if (address_family && *address_family == AF_INET6) {
-        to_remove = mgr->GetInterfaceAddresses(name_, AF_INET6);
+        to_remove = mgr.GetInterfaceAddresses(name_, AF_INET6);
       }
 
       for (const auto &a : to_remove) {
-        try {
-          ic.removeAddress(*mgr, a);
-          std::cout << "delete interface: removed address '" << a << "' from '"
-                    << name_ << "'\n";
-        } catch (const std::exception &e) {
-          std::cerr << "delete interface: failed to remove address '" << a
-                    << "': " << e.what() << "\n";
-        }
+        current = a;
+        ic.removeAddress(mgr, a);
+        std::cout << "delete interface: removed address '" << a << "' from '"
+                  << name_ << "'\n";
       }
       return;
     }
 
-    ic.destroy(*mgr);
+    ic.destroy(mgr);
     std::cout << "delete interface: removed '" << name_ << "'\n";
   } catch (const std::exception &e) {
-    std::cerr << "delete interface: failed to remove '" << name_
-              << "': " << e.what() << "\n";
+    if (!current.empty())
+      throw std::runtime_error("failed to remove address '" + current +
+                               "': " + e.what());
+    throw std::runtime_error("failed to remove '" + name_ + "': " + e.what());
   }
 }
@@ -16,10 +16,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(IpsecInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const IpsecInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->source)
     s += " source " + cfg->source->toString();
   if (cfg->destination)
@@ -45,10 +46,10 @@ std::string InterfaceToken::toString(IpsecInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                        const std::vector<std::string> &tokens,
-                                        size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseIpsecKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "source" && cur + 1 < tokens.size()) {
     tok->source = tokens[cur + 1];
@@ -61,7 +62,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
     return true;
   }
   if ((kw == "tunnel-vrf" || kw == "tunnel-fib") && cur + 1 < tokens.size()) {
-    tok->tunnel_vrf = std::stoi(tokens[cur + 1]);
+    tok->tunnel_vrf = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
@@ -72,7 +73,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
     ++cur;
     IpsecSA sa;
     while (cur < tokens.size()) {
-      const std::string &sk = tokens[cur];
+      std::string_view sk = tokens[cur];
       if (sk == "source" && cur + 1 < tokens.size()) {
         sa.src = tokens[cur + 1];
         cur += 2;
@@ -89,7 +90,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
         continue;
       }
       if (sk == "spi" && cur + 1 < tokens.size()) {
-        sa.spi = static_cast<uint32_t>(std::stoul(tokens[cur + 1], nullptr, 0));
+        sa.spi = static_cast<uint32_t>(tokenULong(tokens[cur + 1], 0));
         cur += 2;
         continue;
       }
@@ -124,7 +125,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
     ++cur;
     IpsecSP sp;
     while (cur < tokens.size()) {
-      const std::string &sk = tokens[cur];
+      std::string_view sk = tokens[cur];
       if (sk == "direction" && cur + 1 < tokens.size()) {
         sp.direction = tokens[cur + 1];
         cur += 2;
@@ -137,7 +138,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
       }
       if (sk == "reqid" && cur + 1 < tokens.size()) {
         sp.reqid =
-            static_cast<uint32_t>(std::stoul(tokens[cur + 1], nullptr, 0));
+            static_cast<uint32_t>(tokenULong(tokens[cur + 1], 0));
         cur += 2;
         continue;
       }
@@ -149,7 +150,7 @@ bool InterfaceToken::parseIpsecKeywords(std::shared_ptr<InterfaceToken> &tok,
 
   if (kw == "reqid" && cur + 1 < tokens.size()) {
     tok->ipsec_reqid =
-        static_cast<uint32_t>(std::stoul(tokens[cur + 1], nullptr, 0));
+        static_cast<uint32_t>(tokenULong(tokens[cur + 1], 0));
     cur += 2;
     return true;
   }
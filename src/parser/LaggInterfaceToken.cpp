@@ -10,16 +10,18 @@
 #include "LaggTableFormatter.hpp"
 #include "SingleLaggSummaryFormatter.hpp"
 #include <iostream>
+#include <stdexcept>
 
 class LaggInterfaceToken : public InterfaceToken {
 public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(LaggInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const LaggInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   for (const auto &m : cfg->members)
     s += " member " + m;
   switch (cfg->protocol) {
@@ -44,18 +46,18 @@ std::string InterfaceToken::toString(LaggInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseLaggKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                       const std::vector<std::string> &tokens,
-                                       size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseLaggKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "lagg" || kw == "lag") {
     ++cur;
     LaggInterfaceConfig lc;
     while (cur < tokens.size()) {
-      const std::string &k2 = tokens[cur];
+      std::string_view k2 = tokens[cur];
       if (k2 == "members" && cur + 1 < tokens.size()) {
-        const std::string &m = tokens[cur + 1];
+        std::string_view m = tokens[cur + 1];
         size_t p = 0, len = m.size();
         while (p < len) {
           size_t q = m.find(',', p);
@@ -68,7 +70,7 @@ bool InterfaceToken::parseLaggKeywords(std::shared_ptr<InterfaceToken> &tok,
         continue;
       }
       if (k2 == "protocol" && cur + 1 < tokens.size()) {
-        const std::string &proto = tokens[cur + 1];
+        std::string_view proto = tokens[cur + 1];
         if (proto == "lacp")
           lc.protocol = LaggProtocol::LACP;
         else if (proto == "failover")
@@ -98,7 +100,7 @@ bool InterfaceToken::parseLaggKeywords(std::shared_ptr<InterfaceToken> &tok,
   }
 
   if (kw == "protocol" && cur + 1 < tokens.size()) {
-    const std::string &proto = tokens[cur + 1];
+    std::string_view proto = tokens[cur + 1];
     if (!tok->lagg)
       tok->lagg.emplace();
     if (proto == "lacp")
@@ -134,11 +136,10 @@ void InterfaceToken::setLaggInterface(const InterfaceToken &tok,
                                       ConfigurationManager *mgr,
                                       InterfaceConfig &base, bool exists) {
   if (!tok.lagg || tok.lagg->members.empty()) {
-    std::cerr << "set interface: LAGG creation typically requires member "
-                 "interfaces.\n"
-              << "Usage: set interface name <lagg_name> lagg members "
-                 "<if1,if2,...> [protocol <proto>]\n";
-    return;
+    throw std::invalid_argument(
+        "LAGG creation typically requires member interfaces.\n"
+        "Usage: set interface name <lagg_name> lagg members "
+        "<if1,if2,...> [protocol <proto>]");
   }
   LaggInterfaceConfig lac(base, tok.lagg->protocol, tok.lagg->members,
                           tok.lagg->hash_policy, tok.lagg->lacp_rate,
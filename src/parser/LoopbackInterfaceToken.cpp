@@ -16,7 +16,7 @@ public:
 
 bool InterfaceToken::parseLoopbackKeywords(
     std::shared_ptr<InterfaceToken> &tok [[maybe_unused]],
-    const std::vector<std::string> &tokens [[maybe_unused]],
+    const std::vector<std::string_view> &tokens [[maybe_unused]],
     size_t &cur [[maybe_unused]]) {
   return false;
 }
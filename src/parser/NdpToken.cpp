@@ -34,7 +34,7 @@ NdpToken::NdpToken(std::string ip) : ip_(std::move(ip)) {}
 std::string NdpToken::toString(NdpConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string result = "ndp " + cfg->ip;
+  std::string result = "ndp " + cfg->ip.addressString();
   if (!cfg->mac.empty())
     result += " mac " + cfg->mac;
   if (cfg->iface)
@@ -71,14 +71,14 @@ std::unique_ptr<Token> NdpToken::clone() const {
 }
 
 std::shared_ptr<NdpToken>
-NdpToken::parseFromTokens(const std::vector<std::string> &tokens, size_t start,
-                          size_t &next) {
+NdpToken::parseFromTokens(const std::vector<std::string_view> &tokens,
+                          size_t start, size_t &next) {
   auto tok = std::make_shared<NdpToken>(std::string());
   next = start + 1; // consume the 'ndp' token
 
   size_t i = next;
   while (i < tokens.size()) {
-    const std::string &kw = tokens[i];
+    std::string_view kw = tokens[i];
     if (kw == "ip" && i + 1 < tokens.size()) {
       tok->ip_ = tokens[i + 1];
       i += 2;
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "OutputPipe.hpp"
+#include "KeywordTrie.hpp"
+#include "StringUtils.hpp"
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <regex>
+#include <stdexcept>
+#include <termios.h>
+#include <unistd.h>
+#include <utility>
+
+class OutputPipe::Stage {
+public:
+  virtual ~Stage() = default;
+
+  /// Handle one line; call pass() for each line to send on.
+  virtual void line(std::string &text) = 0;
+  /// The output is complete; send any final lines.
+  virtual void end() {}
+
+protected:
+  void pass(std::string &text) { pipe_->process(text, next_); }
+
+private:
+  friend class OutputPipe;
+  OutputPipe *pipe_ = nullptr;
+  size_t next_ = 0;
+};
+
+namespace {
+  enum class StageKind { Match, Except, Begin, Count, Columns, NoMore };
+
+  const KeywordTrie<StageKind> &stageNames() {
+    static const KeywordTrie<StageKind> names{
+        {"match", StageKind::Match},
+        {"except", StageKind::Except},
+        {"begin", StageKind::Begin},
+        {"find", StageKind::Begin, true},
+        {"count", StageKind::Count},
+        {"columns", StageKind::Columns},
+        {"no-more", StageKind::NoMore},
+    };
+    return names;
+  }
+
+  std::string_view trim(std::string_view s) {
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front())))
+      s.remove_prefix(1);
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back())))
+      s.remove_suffix(1);
+    return s;
+  }
+
+  std::regex compile(std::string_view stage, std::string_view pattern) {
+    if (pattern.empty())
+      throw std::invalid_argument(std::string(stage) + ": missing pattern");
+    try {
+      return std::regex(pattern.begin(), pattern.end());
+    } catch (const std::regex_error &e) {
+      throw std::invalid_argument(std::string(stage) + ": invalid pattern '" +
+                                  std::string(pattern) + "': " + e.what());
+    }
+  }
+
+  class MatchStage : public OutputPipe::Stage {
+  public:
+    MatchStage(std::regex re, bool keep) : re_(std::move(re)), keep_(keep) {}
+
+    void line(std::string &text) override {
+      if (std::regex_search(strutil::stripAnsi(text), re_) == keep_)
+        pass(text);
+    }
+
+  private:
+    std::regex re_;
+    bool keep_;
+  };
+
+  class BeginStage : public OutputPipe::Stage {
+  public:
+    explicit BeginStage(std::regex re) : re_(std::move(re)) {}
+
+    void line(std::string &text) override {
+      if (!started_)
+        started_ = std::regex_search(strutil::stripAnsi(text), re_);
+      if (started_)
+        pass(text);
+    }
+
+  private:
+    std::regex re_;
+    bool started_ = false;
+  };
+
+  class CountStage : public OutputPipe::Stage {
+  public:
+    void line(std::string &) override { ++count_; }
+
+    void end() override {
+      std::string text = "Count: " + std::to_string(count_) + " lines";
+      pass(text);
+    }
+
+  private:
+    size_t count_ = 0;
+  };
+
+  /// Cuts table rows down to the named columns. A table is recognised by
+  /// its rule line (runs of '-' under each title); the line before it is
+  /// the header. Column spans come from the rule, and the table ends at
+  /// the next blank line. Text outside tables passes through unchanged.
+  class ColumnsStage : public OutputPipe::Stage {
+  public:
+    explicit ColumnsStage(std::vector<std::string> names)
+        : names_(std::move(names)) {}
+
+    void line(std::string &text) override {
+      if (!spans_.empty()) {
+        if (trim(text).empty()) {
+          spans_.clear();
+          pass(text);
+          return;
+        }
+        // Continuation lines of multi-line cells in other columns are
+        // dropped.
+        cut(text);
+        if (!text.empty())
+          pass(text);
+        return;
+      }
+      if (held_ && startTable(*held_, text)) {
+        cut(*held_);
+        pass(*held_);
+        cut(text);
+        pass(text);
+        held_.reset();
+        return;
+      }
+      if (held_)
+        pass(*held_);
+      held_ = std::move(text);
+    }
+
+    void end() override {
+      if (held_)
+        pass(*held_);
+      held_.reset();
+    }
+
+  private:
+    static bool isRule(std::string_view s) {
+      return !s.empty() && s.front() == '-' &&
+             s.find_first_not_of("- ") == std::string_view::npos;
+    }
+
+    bool equalsName(std::string_view title) const {
+      auto same = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) ==
+               std::tolower(static_cast<unsigned char>(b));
+      };
+      return std::any_of(names_.begin(), names_.end(), [&](const auto &n) {
+        return n.size() == title.size() &&
+               std::equal(n.begin(), n.end(), title.begin(), same);
+      });
+    }
+
+    /// Pick the selected spans if `rule` is a rule line under `header`.
+    /// A table with none of the named columns is left whole.
+    bool startTable(const std::string &header, const std::string &rule) {
+      std::string r = strutil::stripAnsi(rule);
+      if (!isRule(r))
+        return false;
+      std::string h = strutil::stripAnsi(header);
+      std::vector<std::pair<size_t, size_t>> all;
+      for (size_t i = 0; i < r.size();) {
+        size_t start = r.find('-', i);
+        if (start == std::string::npos)
+          break;
+        size_t stop = std::min(r.find(' ', start), r.size());
+        all.emplace_back(start, stop - start);
+        std::string_view title;
+        if (start < h.size())
+          title = trim(std::string_view(h).substr(start, stop - start));
+        if (equalsName(title))
+          spans_.push_back(all.back());
+        i = stop;
+      }
+      if (spans_.empty())
+        spans_ = std::move(all);
+      return true;
+    }
+
+    void cut(std::string &text) const {
+      std::string s = strutil::stripAnsi(text);
+      text.clear();
+      for (size_t i = 0; i < spans_.size(); ++i) {
+        auto [start, len] = spans_[i];
+        if (i)
+          text += ' ';
+        std::string_view cell;
+        if (start < s.size())
+          cell = std::string_view(s).substr(start, len);
+        text += cell;
+        text.append(len - cell.size(), ' ');
+      }
+      while (!text.empty() && text.back() == ' ')
+        text.pop_back();
+    }
+
+    std::vector<std::string> names_;
+    std::vector<std::pair<size_t, size_t>> spans_; ///< empty outside a table
+    std::optional<std::string> held_;
+  };
+} // namespace
+
+std::string_view OutputPipe::split(std::string_view line,
+                                   std::vector<std::string_view> &pipes) {
+  std::string_view command;
+  bool first = true;
+  char quote = 0;
+  size_t start = 0;
+  for (size_t i = 0; i <= line.size(); ++i) {
+    if (i < line.size()) {
+      char c = line[i];
+      if (c == '\\' && quote != '\'') {
+        ++i;
+        continue;
+      }
+      if (quote) {
+        if (c == quote)
+          quote = 0;
+        continue;
+      }
+      if (c == '"' || c == '\'') {
+        quote = c;
+        continue;
+      }
+      if (c != '|')
+        continue;
+    }
+    std::string_view part = line.substr(start, i - start);
+    if (first)
+      command = part;
+    else
+      pipes.push_back(trim(part));
+    first = false;
+    start = i + 1;
+  }
+  return command;
+}
+
+std::vector<std::string> OutputPipe::completeStage(std::string_view partial) {
+  return stageNames().complete(partial);
+}
+
+OutputPipe::OutputPipe(std::streambuf *out) : out_(out) {}
+
+OutputPipe::~OutputPipe() = default;
+
+void OutputPipe::addStage(std::string_view spec) {
+  spec = trim(spec);
+  size_t sp = spec.find_first_of(" \t");
+  std::string_view name = spec.substr(0, sp);
+  std::string_view arg =
+      sp == std::string_view::npos ? std::string_view() : trim(spec.substr(sp));
+  if (name.empty())
+    throw std::invalid_argument("missing command after '|'");
+
+  // A pattern may be quoted to keep leading or trailing spaces.
+  if (arg.size() >= 2 && (arg.front() == '"' || arg.front() == '\'') &&
+      arg.back() == arg.front())
+    arg = arg.substr(1, arg.size() - 2);
+
+  const StageKind *kind = stageNames().find(name);
+  if (!kind)
+    throw std::invalid_argument("unknown pipe command '" + std::string(name) +
+                                "'");
+  if (!arg.empty() &&
+      (*kind == StageKind::Count || *kind == StageKind::NoMore))
+    throw std::invalid_argument(std::string(name) + ": takes no arguments");
+
+  std::unique_ptr<Stage> stage;
+  switch (*kind) {
+  case StageKind::Match:
+    stage = std::make_unique<MatchStage>(compile(name, arg), true);
+    break;
+  case StageKind::Except:
+    stage = std::make_unique<MatchStage>(compile(name, arg), false);
+    break;
+  case StageKind::Begin:
+    stage = std::make_unique<BeginStage>(compile(name, arg));
+    break;
+  case StageKind::Count:
+    stage = std::make_unique<CountStage>();
+    break;
+  case StageKind::Columns: {
+    std::vector<std::string> names;
+    bool commas = arg.find(',') != std::string_view::npos;
+    while (!arg.empty()) {
+      size_t stop = arg.find_first_of(commas ? "," : " \t");
+      std::string_view n = trim(arg.substr(0, stop));
+      if (!n.empty())
+        names.emplace_back(n);
+      arg = stop == std::string_view::npos ? std::string_view()
+                                           : arg.substr(stop + 1);
+    }
+    if (names.empty())
+      throw std::invalid_argument("columns: missing column names");
+    stage = std::make_unique<ColumnsStage>(std::move(names));
+    break;
+  }
+  case StageKind::NoMore:
+    noMore_ = true;
+    return;
+  }
+  stage->pipe_ = this;
+  stage->next_ = stages_.size() + 1;
+  stages_.push_back(std::move(stage));
+}
+
+void OutputPipe::finish() {
+  if (finished_)
+    return;
+  finished_ = true;
+  if (!pending_.empty()) {
+    scratch_ = std::move(pending_);
+    pending_.clear();
+    process(scratch_, 0);
+  }
+  for (auto &s : stages_)
+    s->end();
+  out_->pubsync();
+}
+
+OutputPipe::int_type OutputPipe::overflow(int_type ch) {
+  if (traits_type::eq_int_type(ch, traits_type::eof()))
+    return traits_type::not_eof(ch);
+  char c = traits_type::to_char_type(ch);
+  feed(std::string_view(&c, 1));
+  return ch;
+}
+
+std::streamsize OutputPipe::xsputn(const char *s, std::streamsize n) {
+  feed(std::string_view(s, static_cast<size_t>(n)));
+  return n;
+}
+
+int OutputPipe::sync() { return out_->pubsync(); }
+
+void OutputPipe::feed(std::string_view text) {
+  while (!text.empty()) {
+    size_t nl = text.find('\n');
+    if (nl == std::string_view::npos) {
+      pending_ += text;
+      return;
+    }
+    scratch_ = std::move(pending_);
+    pending_.clear();
+    scratch_ += text.substr(0, nl);
+    process(scratch_, 0);
+    text.remove_prefix(nl + 1);
+  }
+}
+
+void OutputPipe::process(std::string &text, size_t from) {
+  if (quit_)
+    return;
+  if (from < stages_.size())
+    stages_[from]->line(text);
+  else
+    emit(text);
+}
+
+void OutputPipe::emit(const std::string &text) {
+  if (pagerRows_ > 1 && !noMore_ && shown_ + 1 >= pagerRows_) {
+    if (!prompt()) {
+      quit_ = true;
+      return;
+    }
+  }
+  out_->sputn(text.data(), static_cast<std::streamsize>(text.size()));
+  out_->sputc('\n');
+  ++shown_;
+}
+
+/// Show the pager prompt and wait for a key: space for the next page,
+/// return for one more line, q to drop the rest of the output.
+bool OutputPipe::prompt() {
+  static constexpr std::string_view kPrompt = "---(more)---";
+  out_->sputn(kPrompt.data(), kPrompt.size());
+  out_->pubsync();
+
+  termios saved;
+  bool raw = tcgetattr(STDIN_FILENO, &saved) == 0;
+  if (raw) {
+    termios t = saved;
+    t.c_lflag &= ~static_cast<tcflag_t>(ICANON | ECHO);
+    t.c_cc[VMIN] = 1;
+    t.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &t);
+  }
+  char c;
+  do {
+    if (::read(STDIN_FILENO, &c, 1) != 1)
+      c = 'q';
+  } while (c != ' ' && c != '\n' && c != '\r' && c != 'q' && c != 'Q');
+  if (raw)
+    tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+
+  static constexpr std::string_view kErase = "\r\x1b[K";
+  out_->sputn(kErase.data(), kErase.size());
+  if (c == 'q' || c == 'Q')
+    return false;
+  shown_ = c == ' ' ? 0 : pagerRows_ - 2;
+  return true;
+}
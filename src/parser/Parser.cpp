@@ -30,6 +30,7 @@
 #include "Command.hpp"
 #include "DeleteToken.hpp"
 #include "InterfaceToken.hpp"
+#include "KeywordTrie.hpp"
 #include "NdpToken.hpp"
 #include "PolicyToken.hpp"
 #include "RouteToken.hpp"
@@ -41,92 +42,160 @@
 #include "TargetToken.hpp"
 #endif
 #include <iostream>
-#include <sstream>
 
 namespace netcli {
-  std::vector<std::string> Parser::tokenize(const std::string &line) const {
-    std::vector<std::string> out;
-    std::istringstream iss(line);
-    std::string tok;
-    while (iss >> tok) {
-      out.push_back(tok);
+  namespace {
+    bool isSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' ||
+             c == '\v';
+    }
+  } // namespace
+
+  std::vector<std::string_view> Parser::tokenize(std::string_view line,
+                                                 std::string &scratch) const {
+    std::vector<std::string_view> out;
+    scratch.clear();
+    size_t i = 0;
+    const size_t n = line.size();
+    while (i < n) {
+      while (i < n && isSpace(line[i]))
+        ++i;
+      if (i == n)
+        break;
+
+      // Fast path: a plain word is a view into the line.
+      size_t start = i;
+      while (i < n && !isSpace(line[i]) && line[i] != '"' && line[i] != '\'' &&
+             line[i] != '\\')
+        ++i;
+      if (i == n || isSpace(line[i])) {
+        out.push_back(line.substr(start, i - start));
+        continue;
+      }
+
+      // A word wrapped in one pair of quotes with nothing to unescape is
+      // still a view, minus the quotes.
+      if (i == start && (line[i] == '"' || line[i] == '\'')) {
+        char q = line[i];
+        size_t close = i + 1;
+        while (close < n && line[close] != q &&
+               (q == '\'' || line[close] != '\\'))
+          ++close;
+        if (close < n && line[close] == q &&
+            (close + 1 == n || isSpace(line[close + 1]))) {
+          out.push_back(line.substr(i + 1, close - i - 1));
+          i = close + 1;
+          continue;
+        }
+      }
+
+      // Slow path: unescape into scratch. The unescaped text is never
+      // longer than the line, so reserving the line length up front keeps
+      // every view into scratch valid.
+      if (scratch.capacity() < n)
+        scratch.reserve(n);
+      size_t from = scratch.size();
+      scratch.append(line.substr(start, i - start));
+      char quote = 0;
+      while (i < n && (quote || !isSpace(line[i]))) {
+        char c = line[i++];
+        if (quote == '\'') {
+          if (c == '\'')
+            quote = 0;
+          else
+            scratch.push_back(c);
+        } else if (c == '\\' && i < n) {
+          scratch.push_back(line[i++]);
+        } else if (quote == '"' && c == '"') {
+          quote = 0;
+        } else if (!quote && (c == '"' || c == '\'')) {
+          quote = c;
+        } else {
+          scratch.push_back(c);
+        }
+      }
+      out.emplace_back(scratch.data() + from, scratch.size() - from);
     }
     return out;
   }
 
+  namespace {
+    using VerbFactory = std::shared_ptr<Token> (*)();
+    using NounParser = std::shared_ptr<Token> (*)(
+        const std::vector<std::string_view> &tokens, size_t start);
+
+    template <typename T> std::shared_ptr<Token> makeVerb() {
+      return std::make_shared<T>();
+    }
+
+    template <typename T>
+    std::shared_ptr<Token>
+    parseNoun(const std::vector<std::string_view> &tokens, size_t start) {
+      size_t next = 0;
+      return T::parseFromTokens(tokens, start, next);
+    }
+
+    // The command grammar's first two levels. Plural and alternate
+    // spellings are hidden: accepted, but not offered for completion.
+    const KeywordTrie<VerbFactory> &verbs() {
+      static const KeywordTrie<VerbFactory> trie{
+          {"show", makeVerb<ShowToken>},
+          {"set", makeVerb<SetToken>},
+          {"delete", makeVerb<DeleteToken>},
+      };
+      return trie;
+    }
+
+    const KeywordTrie<NounParser> &nouns() {
+      static const KeywordTrie<NounParser> trie{
+          {"interface", parseNoun<InterfaceToken>},
+          {"interfaces", parseNoun<InterfaceToken>, true},
+          {"route", parseNoun<RouteToken>},
+          {"routes", parseNoun<RouteToken>, true},
+          {"nexthop-group", parseNoun<RouteToken>},
+          {"nexthop-groups", parseNoun<RouteToken>, true},
+          {"arp", parseNoun<ArpToken>},
+          {"ndp", parseNoun<NdpToken>},
+          {"vrf", parseNoun<VRFToken>},
+          {"policy", parseNoun<PolicyToken>},
+#ifdef STELLERI_NETCONF
+          {"target", parseNoun<TargetToken>},
+          {"commit", parseNoun<CommitToken>},
+#endif
+      };
+      return trie;
+    }
+  } // namespace
+
   std::unique_ptr<Command>
-  Parser::parse(const std::vector<std::string> &tokens) const {
+  Parser::parse(const std::vector<std::string_view> &tokens) const {
     if (tokens.empty())
       return nullptr;
 
-    auto cmd = std::make_unique<Command>();
-    size_t idx = 0;
-    const std::string &verb = tokens[idx];
-    if (verb == "show") {
-      cmd->addToken(std::make_shared<ShowToken>());
-      ++idx;
-    } else if (verb == "set") {
-      cmd->addToken(std::make_shared<SetToken>());
-      ++idx;
-    } else if (verb == "delete") {
-      cmd->addToken(std::make_shared<DeleteToken>());
-      ++idx;
-    } else {
+    const VerbFactory *verb = verbs().find(tokens[0]);
+    if (!verb)
       return nullptr;
-    }
+    auto cmd = std::make_unique<Command>();
+    cmd->addToken((*verb)());
 
-    if (idx >= tokens.size())
+    if (tokens.size() < 2)
       return cmd;
 
-    const std::string &target = tokens[idx];
-    if (target == "interfaces" || target == "interface") {
-      size_t next = 0;
-      auto itok = InterfaceToken::parseFromTokens(tokens, idx, next);
-      if (itok)
-        cmd->addToken(itok);
-    } else if (target == "route" || target == "routes") {
-      size_t next = 0;
-      auto rt = RouteToken::parseFromTokens(tokens, idx, next);
-      if (rt)
-        cmd->addToken(rt);
-    } else if (target == "vrf") {
-      size_t next = 0;
-      auto vt = VRFToken::parseFromTokens(tokens, idx, next);
-      if (vt)
-        cmd->addToken(vt);
-    } else if (target == "arp") {
-      size_t next = 0;
-      auto at = ArpToken::parseFromTokens(tokens, idx, next);
-      if (at)
-        cmd->addToken(at);
-    } else if (target == "ndp") {
-      size_t next = 0;
-      auto nt = NdpToken::parseFromTokens(tokens, idx, next);
-      if (nt)
-        cmd->addToken(nt);
-    } else if (target == "policy") {
-      size_t next = 0;
-      auto pt = PolicyToken::parseFromTokens(tokens, idx, next);
-      if (pt)
-        cmd->addToken(pt);
-    }
-#ifdef STELLERI_NETCONF
-    else if (target == "target") {
-      size_t next = 0;
-      auto tt = TargetToken::parseFromTokens(tokens, idx, next);
-      if (tt)
-        cmd->addToken(tt);
-    } else if (target == "commit") {
-      size_t next = 0;
-      auto ct = CommitToken::parseFromTokens(tokens, idx, next);
-      if (ct)
-        cmd->addToken(ct);
-    }
-#endif
+    if (const NounParser *noun = nouns().find(tokens[1]))
+      if (auto tok = (*noun)(tokens, 1))
+        cmd->addToken(tok);
 
     return cmd;
   }
 
+  std::vector<std::string> Parser::completeVerb(std::string_view partial) {
+    return verbs().complete(partial);
+  }
+
+  std::vector<std::string> Parser::completeNoun(std::string_view partial) {
+    return nouns().complete(partial);
+  }
+
   // `executeShowInterface` is implemented in src/ExecuteShowInterface.cpp
 
 } // namespace netcli
@@ -14,11 +14,10 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-bool InterfaceToken::parsePflogKeywords(std::shared_ptr<InterfaceToken> &tok
-                                        [[maybe_unused]],
-                                        const std::vector<std::string> &tokens
-                                        [[maybe_unused]],
-                                        size_t &cur [[maybe_unused]]) {
+bool InterfaceToken::parsePflogKeywords(
+    std::shared_ptr<InterfaceToken> &tok [[maybe_unused]],
+    const std::vector<std::string_view> &tokens [[maybe_unused]],
+    size_t &cur [[maybe_unused]]) {
   return false;
 }
 
@@ -26,6 +26,7 @@
  */
 
 #include "PolicyToken.hpp"
+#include "CompletionCache.hpp"
 #include "PolicyConfig.hpp"
 
 // ── autoComplete ─────────────────────────────────────────────────────
@@ -41,6 +42,16 @@ PolicyToken::autoComplete(std::string_view partial) const {
   return matches;
 }
 
+std::vector<std::string>
+PolicyToken::autoComplete(const std::vector<std::string> &tokens,
+                          std::string_view partial,
+                          const CompletionCache *cache) const {
+  // After "access-list", offer the ids of the configured access lists.
+  if (cache && !tokens.empty() && tokens.back() == "access-list")
+    return cache->snapshot()->acls.complete(partial);
+  return autoComplete(partial);
+}
+
 // ── clone ────────────────────────────────────────────────────────────
 
 std::unique_ptr<Token> PolicyToken::clone() const {
@@ -86,7 +97,7 @@ std::string PolicyToken::toString(const PolicyConfig *cfg) {
 
 // ── parseAccessList ──────────────────────────────────────────────────
 
-void PolicyToken::parseAccessList(const std::vector<std::string> &tokens,
+void PolicyToken::parseAccessList(const std::vector<std::string_view> &tokens,
                                   size_t &i,
                                   std::shared_ptr<PolicyToken> &tok) {
   tok->sub_type = SubType::AccessList;
@@ -94,7 +105,7 @@ void PolicyToken::parseAccessList(const std::vector<std::string> &tokens,
   // Expect access-list number
   if (i < tokens.size()) {
     try {
-      tok->acl_id = static_cast<uint32_t>(std::stoul(tokens[i]));
+      tok->acl_id = static_cast<uint32_t>(tokenULong(tokens[i]));
       ++i;
     } catch (...) {
       // Not a number — leave acl_id empty (show all)
@@ -102,10 +113,10 @@ void PolicyToken::parseAccessList(const std::vector<std::string> &tokens,
   }
 
   while (i < tokens.size()) {
-    const std::string &kw = tokens[i];
+    std::string_view kw = tokens[i];
     if (kw == "rule" && i + 1 < tokens.size()) {
       try {
-        tok->rule_seq = static_cast<uint32_t>(std::stoul(tokens[i + 1]));
+        tok->rule_seq = static_cast<uint32_t>(tokenULong(tokens[i + 1]));
         i += 2;
       } catch (...) {
         break;
@@ -131,7 +142,7 @@ void PolicyToken::parseAccessList(const std::vector<std::string> &tokens,
 // ── parseFromTokens ──────────────────────────────────────────────────
 
 std::shared_ptr<PolicyToken>
-PolicyToken::parseFromTokens(const std::vector<std::string> &tokens,
+PolicyToken::parseFromTokens(const std::vector<std::string_view> &tokens,
                              size_t start, size_t &next) {
   auto tok = std::make_shared<PolicyToken>();
   next = start + 1; // consume the 'policy' keyword
@@ -142,7 +153,7 @@ PolicyToken::parseFromTokens(const std::vector<std::string> &tokens,
     return tok;
   }
 
-  const std::string &sub = tokens[i];
+  std::string_view sub = tokens[i];
   if (sub == "access-list") {
     ++i;
     parseAccessList(tokens, i, tok);
@@ -26,15 +26,20 @@
  */
 
 #include "RouteToken.hpp"
+#include "CompletionCache.hpp"
+#include <stdexcept>
 
 RouteToken::RouteToken(std::string prefix) : prefix_(std::move(prefix)) {}
 // Static renderer for RouteConfig
 std::string RouteToken::toString(RouteConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string result = "route protocol static dest " + cfg->prefix;
+  std::string result =
+      "route protocol static dest " + cfg->prefix.toString();
   if (cfg->nexthop)
-    result += " nexthop " + *cfg->nexthop;
+    result += " nexthop " + cfg->nexthop->addressString();
+  if (cfg->nexthop_group)
+    result += " nexthop-group " + *cfg->nexthop_group;
   if (cfg->iface)
     result += " interface " + *cfg->iface;
   if (cfg->vrf)
@@ -50,10 +55,45 @@ std::string RouteToken::toString(RouteConfig *cfg) {
   return result;
 }
 
+std::string RouteToken::toString(NexthopGroupConfig *cfg) {
+  if (!cfg)
+    return std::string();
+  std::string result = "nexthop-group " + cfg->name;
+  for (const auto &m : cfg->members) {
+    result += " nexthop " + m.gateway;
+    if (m.iface)
+      result += " interface " + *m.iface;
+    if (m.weight != 1)
+      result += " weight " + std::to_string(m.weight);
+  }
+  return result;
+}
+
+std::optional<RouteConfig> RouteToken::toConfig() const {
+  auto p = IPPrefix::fromString(prefix_);
+  if (!p)
+    return std::nullopt;
+  RouteConfig rc;
+  rc.prefix = p->network();
+  if (nexthop)
+    rc.nexthop = IPPrefix::fromAddress(*nexthop);
+  if (interface)
+    rc.iface = interface->name();
+  if (vrf)
+    rc.vrf = vrf->table();
+  rc.blackhole = blackhole;
+  rc.reject = reject;
+  rc.nexthop_group = nexthop_group;
+  return rc;
+}
+
 std::vector<std::string>
 RouteToken::autoComplete(std::string_view partial) const {
-  std::vector<std::string> options = {"interface", "next-hop", "blackhole",
-                                      "reject", "vrf"};
+  std::vector<std::string> options =
+      isNexthopGroup()
+          ? std::vector<std::string>{"nexthop", "interface", "weight"}
+          : std::vector<std::string>{"interface", "next-hop", "nexthop-group",
+                                     "blackhole", "reject", "vrf", "lookup"};
   std::vector<std::string> matches;
   for (const auto &opt : options) {
     if (opt.rfind(partial, 0) == 0)
@@ -62,6 +102,30 @@ RouteToken::autoComplete(std::string_view partial) const {
   return matches;
 }
 
+std::vector<std::string>
+RouteToken::autoComplete(const std::vector<std::string> &tokens,
+                         std::string_view partial,
+                         const CompletionCache *cache) const {
+  const std::string prev = tokens.empty() ? std::string() : tokens.back();
+  if (cache && !isNexthopGroup()) {
+    auto snap = cache->snapshot();
+    if (prev == "interface")
+      return snap->interfaces.complete(partial);
+    if (prev == "vrf")
+      return snap->vrfs.complete(partial);
+    // `route <prefix>` or `dest <prefix>`: installed prefixes, then the
+    // keywords that may follow the noun directly.
+    if (prev == "route" || prev == "routes" || prev == "dest") {
+      auto matches = snap->prefixes.prefixed(partial);
+      if (prev != "dest")
+        for (auto &k : autoComplete(partial))
+          matches.push_back(std::move(k));
+      return matches;
+    }
+  }
+  return autoComplete(partial);
+}
+
 std::unique_ptr<Token> RouteToken::clone() const {
   auto r = std::make_unique<RouteToken>(prefix_);
   if (nexthop)
@@ -72,10 +136,22 @@ std::unique_ptr<Token> RouteToken::clone() const {
     r->vrf = std::make_unique<VRFToken>(*vrf);
   r->blackhole = blackhole;
   r->reject = reject;
+  r->nexthop_group = nexthop_group;
+  r->group_name = group_name;
+  r->group_members = group_members;
+  r->lookup_address = lookup_address;
+  r->lookup_file = lookup_file;
   return r;
 }
 
 void RouteToken::debugOutput(std::ostream &os) const {
+  if (isNexthopGroup()) {
+    os << "[parser] parsed nexthop-group: name='" << *group_name << "'";
+    for (const auto &m : group_members)
+      os << " nexthop='" << m.gateway << "'";
+    os << '\n';
+    return;
+  }
   os << "[parser] parsed route: prefix='" << prefix_ << "'";
   if (nexthop)
     os << " nexthop='" << nexthop->toString() << "'";
@@ -87,12 +163,21 @@ void RouteToken::debugOutput(std::ostream &os) const {
     os << " blackhole=true";
   if (reject)
     os << " reject=true";
+  if (nexthop_group)
+    os << " nexthop-group='" << *nexthop_group << "'";
+  if (lookup_address)
+    os << " lookup='" << *lookup_address << "'";
+  if (lookup_file)
+    os << " lookup-file='" << *lookup_file << "'";
   os << '\n';
 }
 
 std::shared_ptr<RouteToken>
-RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
+RouteToken::parseFromTokens(const std::vector<std::string_view> &tokens,
                             size_t start, size_t &next) {
+  if (tokens[start] == "nexthop-group" || tokens[start] == "nexthop-groups")
+    return parseNexthopGroup(tokens, start, next);
+
   next = start + 1; // consume the 'route' or 'routes' token
 
   std::string prefix;
@@ -100,7 +185,7 @@ RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
 
   // Check if there's a potential prefix at the next position
   if (j < tokens.size()) {
-    const std::string &candidate = tokens[j];
+    std::string_view candidate = tokens[j];
     // If it parses as a network, use it as the prefix
     if (IPNetwork::fromString(candidate)) {
       prefix = candidate;
@@ -113,7 +198,7 @@ RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
   while (j < tokens.size()) {
     const auto &opt = tokens[j];
     if ((opt == "next-hop" || opt == "nexthop") && j + 1 < tokens.size()) {
-      const std::string nh = tokens[j + 1];
+      std::string_view nh = tokens[j + 1];
       // support shorthand: "nexthop reject" or "nexthop blackhole"
       if (nh == "reject") {
         tok->reject = true;
@@ -135,8 +220,13 @@ RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
       j += 2;
       continue;
     }
+    if (opt == "nexthop-group" && j + 1 < tokens.size()) {
+      tok->nexthop_group = tokens[j + 1];
+      j += 2;
+      continue;
+    }
     if (opt == "gw" && j + 1 < tokens.size()) {
-      const std::string nh = tokens[j + 1];
+      std::string_view nh = tokens[j + 1];
       std::unique_ptr<IPAddress> addr = IPAddress::fromString(nh);
       if (!addr) {
         auto net = IPNetwork::fromString(nh);
@@ -153,14 +243,31 @@ RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
       j += 2;
       continue;
     }
+    if (opt == "lookup" && j + 1 < tokens.size()) {
+      if (tokens[j + 1] == "file" && j + 2 < tokens.size()) {
+        tok->lookup_file = tokens[j + 2];
+        j += 3;
+      } else {
+        tok->lookup_address = tokens[j + 1];
+        j += 2;
+      }
+      continue;
+    }
+    // Emitted by the generator: only static routes are configurable and
+    // scope/expire are kernel-reported, so accept and skip them.
+    if ((opt == "protocol" || opt == "scope" || opt == "expire") &&
+        j + 1 < tokens.size()) {
+      j += 2;
+      continue;
+    }
     if (opt == "vrf" && j + 1 < tokens.size()) {
-      tok->vrf = std::make_unique<VRFToken>(std::stoi(tokens[j + 1]));
+      tok->vrf = std::make_unique<VRFToken>(tokenInt(tokens[j + 1]));
       j += 2;
       continue;
     }
     if (opt == "interface" && j + 1 < tokens.size()) {
-      tok->interface = std::make_unique<InterfaceToken>(InterfaceType::Unknown,
-                                                        tokens[j + 1]);
+      tok->interface = std::make_unique<InterfaceToken>(
+          InterfaceType::Unknown, std::string(tokens[j + 1]));
       j += 2;
       continue;
     }
@@ -182,3 +289,49 @@ RouteToken::parseFromTokens(const std::vector<std::string> &tokens,
   next = j;
   return tok;
 }
+
+std::shared_ptr<RouteToken>
+RouteToken::parseNexthopGroup(const std::vector<std::string_view> &tokens,
+                              size_t start, size_t &next) {
+  size_t j = start + 1; // consume the 'nexthop-group' token
+  auto tok = std::make_shared<RouteToken>("");
+  tok->group_name = std::string();
+  if (j < tokens.size() && tokens[j] != "nexthop" && tokens[j] != "next-hop")
+    tok->group_name = tokens[j++];
+
+  while (j + 1 < tokens.size()) {
+    const auto &opt = tokens[j];
+    if (opt == "nexthop" || opt == "next-hop") {
+      NexthopGroupMember m;
+      auto addr = IPAddress::fromString(tokens[j + 1]);
+      m.gateway = addr ? addr->toString() : tokens[j + 1];
+      tok->group_members.push_back(std::move(m));
+      j += 2;
+      continue;
+    }
+    // 'interface' and 'weight' qualify the most recent nexthop
+    if (opt == "interface" && !tok->group_members.empty()) {
+      tok->group_members.back().iface = tokens[j + 1];
+      j += 2;
+      continue;
+    }
+    if (opt == "weight" && !tok->group_members.empty()) {
+      int weight = 0;
+      try {
+        weight = tokenInt(tokens[j + 1]);
+      } catch (...) {
+      }
+      // The kernel keeps weight - 1 in a byte.
+      if (weight < 1 || weight > 256)
+        throw std::invalid_argument("weight must be 1-256, got '" +
+                                    std::string(tokens[j + 1]) + "'");
+      tok->group_members.back().weight = static_cast<uint16_t>(weight);
+      j += 2;
+      continue;
+    }
+    break;
+  }
+
+  next = j;
+  return tok;
+}
@@ -26,6 +26,7 @@
  */
 
 #include "SetToken.hpp"
+#include "Parser.hpp"
 
 // toString(ConfigData*) removed — implementation deleted per request
 
@@ -33,15 +34,7 @@ std::string SetToken::toString() const { return "set"; }
 
 std::vector<std::string>
 SetToken::autoComplete(std::string_view partial) const {
-  std::vector<std::string> options = {"interface", "interfaces", "route",
-                                      "arp",       "ndp",        "vrf",
-                                      "policy",    "protocols"};
-  std::vector<std::string> matches;
-  for (const auto &opt : options) {
-    if (opt.rfind(partial, 0) == 0)
-      matches.push_back(opt);
-  }
-  return matches;
+  return netcli::Parser::completeNoun(partial);
 }
 
 std::unique_ptr<Token> SetToken::clone() const {
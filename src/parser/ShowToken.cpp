@@ -26,20 +26,14 @@
  */
 
 #include "ShowToken.hpp"
+#include "Parser.hpp"
 
 std::string ShowToken::toString() const { return "show"; }
 
 std::vector<std::string>
 ShowToken::autoComplete(std::string_view partial) const {
   // Suggest the canonical nouns that follow 'show'
-  std::vector<std::string> options = {"interface", "route", "arp",
-                                      "ndp",       "vrf",   "policy"};
-  std::vector<std::string> matches;
-  for (const auto &opt : options) {
-    if (opt.rfind(partial, 0) == 0)
-      matches.push_back(opt);
-  }
-  return matches;
+  return netcli::Parser::completeNoun(partial);
 }
 
 std::unique_ptr<Token> ShowToken::clone() const {
@@ -14,15 +14,15 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(SixToFourInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const SixToFourInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  return InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  return InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
 }
 
 bool InterfaceToken::parseSixToFourKeywords(
     std::shared_ptr<InterfaceToken> &tok [[maybe_unused]],
-    const std::vector<std::string> &tokens [[maybe_unused]],
+    const std::vector<std::string_view> &tokens [[maybe_unused]],
     size_t &cur [[maybe_unused]]) {
   return false;
 }
@@ -14,29 +14,67 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(TapInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const TapInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  return InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  return InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg)) +
+         tunTapOptionsString(*cfg);
 }
 
-bool InterfaceToken::parseTapKeywords(std::shared_ptr<InterfaceToken> &tok
-                                      [[maybe_unused]],
-                                      const std::vector<std::string> &tokens
-                                      [[maybe_unused]],
-                                      size_t &cur [[maybe_unused]]) {
+bool InterfaceToken::parseTunTapKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
+
+  if (kw == "queues" && cur + 1 < tokens.size()) {
+    tok->queues = tokenInt(tokens[cur + 1]);
+    cur += 2;
+    return true;
+  }
+  if (kw == "owner" && cur + 1 < tokens.size()) {
+    tok->owner = tokens[cur + 1];
+    cur += 2;
+    return true;
+  }
+  if (kw == "owner-group" && cur + 1 < tokens.size()) {
+    tok->owner_group = tokens[cur + 1];
+    cur += 2;
+    return true;
+  }
+  if (kw == "vnet-hdr" || kw == "no-vnet-hdr") {
+    tok->vnet_hdr = (kw == "vnet-hdr");
+    ++cur;
+    return true;
+  }
   return false;
 }
 
-std::vector<std::string> InterfaceToken::tapCompletions(const std::string &prev
-                                                        [[maybe_unused]]) {
+std::vector<std::string>
+InterfaceToken::tunTapCompletions(const std::string &prev) {
+  if (prev.empty())
+    return {"queues", "owner", "owner-group", "vnet-hdr", "no-vnet-hdr"};
   return {};
 }
 
+bool InterfaceToken::parseTapKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  return parseTunTapKeywords(tok, tokens, cur);
+}
+
+std::vector<std::string>
+InterfaceToken::tapCompletions(const std::string &prev) {
+  return tunTapCompletions(prev);
+}
+
 void InterfaceToken::setTapInterface(const InterfaceToken &tok,
                                      ConfigurationManager *mgr,
                                      InterfaceConfig &base, bool exists) {
   TapInterfaceConfig tc(base);
+  tc.queues = tok.queues;
+  tc.owner = tok.owner;
+  tc.owner_group = tok.owner_group;
+  tc.vnet_hdr = tok.vnet_hdr;
   tc.save(*mgr);
   std::cout << "set interface: " << (exists ? "updated" : "created") << " tap '"
             << tok.name() << "'\n";
@@ -44,7 +82,7 @@ void InterfaceToken::setTapInterface(const InterfaceToken &tok,
 
 std::string
 InterfaceToken::showTapInterfaces(const std::vector<InterfaceConfig> &ifaces,
-                                  ConfigurationManager *) {
+                                  ConfigurationManager *mgr) {
   TapTableFormatter f;
-  return f.format(ifaces);
+  return f.format(mgr->GetTapInterfaces(ifaces));
 }
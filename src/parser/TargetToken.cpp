@@ -8,7 +8,7 @@
 #include <iostream>
 
 std::shared_ptr<TargetToken>
-TargetToken::parseFromTokens(const std::vector<std::string> &tokens,
+TargetToken::parseFromTokens(const std::vector<std::string_view> &tokens,
                              size_t start, size_t &next) {
   // start points at "target"
   size_t cur = start;
@@ -21,7 +21,7 @@ TargetToken::parseFromTokens(const std::vector<std::string> &tokens,
   }
 
   auto tok = std::make_shared<TargetToken>();
-  const std::string &mode = tokens[cur++];
+  std::string_view mode = tokens[cur++];
   if (mode == "unix") {
     tok->type = Type::Unix;
     if (cur < tokens.size()) {
@@ -38,7 +38,7 @@ TargetToken::parseFromTokens(const std::vector<std::string> &tokens,
     }
     // optional port keyword
     if (cur + 1 < tokens.size() && tokens[cur] == "port") {
-      tok->port = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+      tok->port = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
       cur += 2;
     }
   } else if (mode == "tls") {
@@ -49,7 +49,7 @@ TargetToken::parseFromTokens(const std::vector<std::string> &tokens,
       return nullptr;
     }
     if (cur + 1 < tokens.size() && tokens[cur] == "port") {
-      tok->port = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+      tok->port = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
       cur += 2;
     }
   } else {
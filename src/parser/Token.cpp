@@ -34,6 +34,6 @@ Token::~Token() = default;
 std::vector<std::string>
 Token::autoComplete(const std::vector<std::string> & /*tokens*/,
                     std::string_view partial,
-                    ConfigurationManager * /*mgr*/) const {
+                    const CompletionCache * /*cache*/) const {
   return autoComplete(partial);
 }
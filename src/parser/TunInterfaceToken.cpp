@@ -16,23 +16,24 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(TunInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const TunInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->source)
     s += " source " + cfg->source->toString();
   if (cfg->destination)
     s += " destination " + cfg->destination->toString();
   if (cfg->tunnel_vrf)
     s += " tunnel-vrf " + std::to_string(*cfg->tunnel_vrf);
-  return s;
+  return s + tunTapOptionsString(*cfg);
 }
 
-bool InterfaceToken::parseTunKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                      const std::vector<std::string> &tokens,
-                                      size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseTunKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "source" && cur + 1 < tokens.size()) {
     tok->source = tokens[cur + 1];
@@ -45,18 +46,22 @@ bool InterfaceToken::parseTunKeywords(std::shared_ptr<InterfaceToken> &tok,
     return true;
   }
   if ((kw == "tunnel-vrf" || kw == "tunnel-fib") && cur + 1 < tokens.size()) {
-    tok->tunnel_vrf = std::stoi(tokens[cur + 1]);
+    tok->tunnel_vrf = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
-  return false;
+  return parseTunTapKeywords(tok, tokens, cur);
 }
 
 std::vector<std::string>
 InterfaceToken::tunCompletions(const std::string &prev) {
-  if (prev.empty())
-    return {"source", "destination", "tunnel-vrf"};
-  return {};
+  if (prev.empty()) {
+    std::vector<std::string> kws = {"source", "destination", "tunnel-vrf"};
+    auto shared = tunTapCompletions(prev);
+    kws.insert(kws.end(), shared.begin(), shared.end());
+    return kws;
+  }
+  return tunTapCompletions(prev);
 }
 
 void InterfaceToken::setTunInterface(const InterfaceToken &tok,
@@ -69,6 +74,10 @@ void InterfaceToken::setTunInterface(const InterfaceToken &tok,
     tc.destination = IPAddress::fromString(*tok.destination);
   if (tok.tunnel_vrf)
     tc.tunnel_vrf = *tok.tunnel_vrf;
+  tc.queues = tok.queues;
+  tc.owner = tok.owner;
+  tc.owner_group = tok.owner_group;
+  tc.vnet_hdr = tok.vnet_hdr;
   tc.save(*mgr);
   std::cout << "set interface: " << (exists ? "updated" : "created") << " tun '"
             << tok.name() << "'\n";
@@ -26,6 +26,7 @@
  */
 
 #include "VRFToken.hpp"
+#include "CompletionCache.hpp"
 
 VRFToken::VRFToken(int table, std::string name)
     : table_(table), name_(std::move(name)) {}
@@ -44,13 +45,26 @@ std::vector<std::string> VRFToken::autoComplete(std::string_view) const {
   return {};
 }
 
+std::vector<std::string>
+VRFToken::autoComplete(const std::vector<std::string> &tokens,
+                       std::string_view partial,
+                       const CompletionCache *cache) const {
+  if (!cache || tokens.empty())
+    return {};
+  if (tokens.back() == "name")
+    return cache->snapshot()->vrfNames.complete(partial);
+  if (tokens.back() == "vrf" || tokens.back() == "table")
+    return cache->snapshot()->vrfs.complete(partial);
+  return {};
+}
+
 std::unique_ptr<Token> VRFToken::clone() const {
   return std::make_unique<VRFToken>(*this);
 }
 
 std::shared_ptr<VRFToken>
-VRFToken::parseFromTokens(const std::vector<std::string> &tokens, size_t start,
-                          size_t &next) {
+VRFToken::parseFromTokens(const std::vector<std::string_view> &tokens,
+                          size_t start, size_t &next) {
   next = start + 1; // consume the 'vrf' token
 
   std::string name;
@@ -66,12 +80,12 @@ VRFToken::parseFromTokens(const std::vector<std::string> &tokens, size_t start,
       if (next < tokens.size() && tokens[next] == "table") {
         ++next;
         if (next < tokens.size()) {
-          table = std::stoi(tokens[next]);
+          table = tokenInt(tokens[next]);
           ++next;
         }
       }
     } else {
-      table = std::stoi(tokens[next]);
+      table = tokenInt(tokens[next]);
       ++next;
     }
   }
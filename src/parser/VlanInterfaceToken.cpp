@@ -10,16 +10,18 @@
 #include "VlanInterfaceConfig.hpp"
 #include "VlanTableFormatter.hpp"
 #include <iostream>
+#include <stdexcept>
 
 class VlanInterfaceToken : public InterfaceToken {
 public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(VlanInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const VlanInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   s += " vid " + std::to_string(cfg->id);
   if (cfg->parent)
     s += " parent " + *cfg->parent;
@@ -28,10 +30,10 @@ std::string InterfaceToken::toString(VlanInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseVlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                       const std::vector<std::string> &tokens,
-                                       size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseVlanKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   // vlan sub-block: vlan id <N> parent <iface>
   if (kw == "vlan") {
@@ -39,9 +41,9 @@ bool InterfaceToken::parseVlanKeywords(std::shared_ptr<InterfaceToken> &tok,
     std::optional<uint16_t> vid;
     std::optional<std::string> parent;
     while (cur < tokens.size()) {
-      const std::string &k2 = tokens[cur];
+      std::string_view k2 = tokens[cur];
       if (k2 == "id" && cur + 1 < tokens.size()) {
-        vid = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+        vid = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
         cur += 2;
         continue;
       }
@@ -66,7 +68,7 @@ bool InterfaceToken::parseVlanKeywords(std::shared_ptr<InterfaceToken> &tok,
       tok->vlan.emplace();
       tok->vlan->name = tok->name();
     }
-    tok->vlan->id = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+    tok->vlan->id = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
     cur += 2;
     return true;
   }
@@ -86,7 +88,7 @@ bool InterfaceToken::parseVlanKeywords(std::shared_ptr<InterfaceToken> &tok,
       tok->vlan.emplace();
       tok->vlan->name = tok->name();
     }
-    tok->vlan->pcp = static_cast<PriorityCodePoint>(std::stoi(tokens[cur + 1]));
+    tok->vlan->pcp = static_cast<PriorityCodePoint>(tokenInt(tokens[cur + 1]));
     cur += 2;
     return true;
   }
@@ -105,11 +107,10 @@ void InterfaceToken::setVlanInterface(const InterfaceToken &tok,
                                       ConfigurationManager *mgr,
                                       InterfaceConfig &base, bool exists) {
   if (!tok.vlan || tok.vlan->id == 0 || !tok.vlan->parent) {
-    std::cerr << "set interface: VLAN creation requires VLAN id and parent "
-                 "interface.\n"
-              << "Usage: set interface name <vlan_name> vlan id <vlan_id> "
-                 "parent <parent_iface>\n";
-    return;
+    throw std::invalid_argument(
+        "VLAN creation requires VLAN id and parent interface.\n"
+        "Usage: set interface name <vlan_name> vlan id <vlan_id> "
+        "parent <parent_iface>");
   }
   VlanInterfaceConfig vc(base, tok.vlan->id, tok.vlan->parent, tok.vlan->pcp);
   vc.InterfaceConfig::name = tok.name();
@@ -15,10 +15,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(VxlanInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const VxlanInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->vni)
     s += " vni " + std::to_string(*cfg->vni);
   if (cfg->localAddr)
@@ -30,15 +31,15 @@ std::string InterfaceToken::toString(VxlanInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseVxlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                        const std::vector<std::string> &tokens,
-                                        size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseVxlanKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "vni" && cur + 1 < tokens.size()) {
     if (!tok->vxlan)
       tok->vxlan.emplace(InterfaceConfig{});
-    tok->vxlan->vni = static_cast<uint32_t>(std::stoul(tokens[cur + 1]));
+    tok->vxlan->vni = static_cast<uint32_t>(tokenULong(tokens[cur + 1]));
     cur += 2;
     return true;
   }
@@ -59,7 +60,7 @@ bool InterfaceToken::parseVxlanKeywords(std::shared_ptr<InterfaceToken> &tok,
   if (kw == "port" && cur + 1 < tokens.size()) {
     if (!tok->vxlan)
       tok->vxlan.emplace(InterfaceConfig{});
-    tok->vxlan->localPort = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+    tok->vxlan->localPort = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
     cur += 2;
     return true;
   }
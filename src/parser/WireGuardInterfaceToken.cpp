@@ -14,10 +14,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(WireGuardInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const WireGuardInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->listenPort)
     s += " listen-port " + std::to_string(*cfg->listenPort);
   return s;
@@ -25,11 +26,11 @@ std::string InterfaceToken::toString(WireGuardInterfaceConfig *cfg) {
 
 bool InterfaceToken::parseWireGuardKeywords(
     std::shared_ptr<InterfaceToken> &tok,
-    const std::vector<std::string> &tokens, size_t &cur) {
-  const std::string &kw = tokens[cur];
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "listen-port" && cur + 1 < tokens.size()) {
-    tok->wg_listen_port = static_cast<uint16_t>(std::stoi(tokens[cur + 1]));
+    tok->wg_listen_port = static_cast<uint16_t>(tokenInt(tokens[cur + 1]));
     cur += 2;
     return true;
   }
@@ -16,10 +16,11 @@ public:
   using InterfaceToken::InterfaceToken;
 };
 
-std::string InterfaceToken::toString(WlanInterfaceConfig *cfg) {
+std::string InterfaceToken::toString(const WlanInterfaceConfig *cfg) {
   if (!cfg)
     return std::string();
-  std::string s = InterfaceToken::toString(static_cast<InterfaceConfig *>(cfg));
+  std::string s =
+      InterfaceToken::toString(static_cast<const InterfaceConfig *>(cfg));
   if (cfg->ssid)
     s += " ssid " + *cfg->ssid;
   if (cfg->channel)
@@ -44,10 +45,10 @@ std::string InterfaceToken::toString(WlanInterfaceConfig *cfg) {
   return s;
 }
 
-bool InterfaceToken::parseWlanKeywords(std::shared_ptr<InterfaceToken> &tok,
-                                       const std::vector<std::string> &tokens,
-                                       size_t &cur) {
-  const std::string &kw = tokens[cur];
+bool InterfaceToken::parseWlanKeywords(
+    std::shared_ptr<InterfaceToken> &tok,
+    const std::vector<std::string_view> &tokens, size_t &cur) {
+  std::string_view kw = tokens[cur];
 
   if (kw == "ssid" && cur + 1 < tokens.size()) {
     if (!tok->wlan)
@@ -59,7 +60,7 @@ bool InterfaceToken::parseWlanKeywords(std::shared_ptr<InterfaceToken> &tok,
   if (kw == "channel" && cur + 1 < tokens.size()) {
     if (!tok->wlan)
       tok->wlan.emplace(InterfaceConfig{});
-    tok->wlan->channel = std::stoi(tokens[cur + 1]);
+    tok->wlan->channel = tokenInt(tokens[cur + 1]);
     cur += 2;
     return true;
   }
@@ -73,7 +74,7 @@ bool InterfaceToken::parseWlanKeywords(std::shared_ptr<InterfaceToken> &tok,
   if (kw == "authmode" && cur + 1 < tokens.size()) {
     if (!tok->wlan)
       tok->wlan.emplace(InterfaceConfig{});
-    const std::string &mode = tokens[cur + 1];
+    std::string_view mode = tokens[cur + 1];
     if (mode == "open")
       tok->wlan->authmode = WlanAuthMode::OPEN;
     else if (mode == "shared")
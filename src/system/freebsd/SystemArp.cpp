@@ -26,6 +26,7 @@
  */
 
 #include "ArpConfig.hpp"
+#include "InterfaceNames.hpp"
 #include "RoutingSocket.hpp"
 #include "SystemConfigurationManager.hpp"
 
@@ -80,6 +81,7 @@ std::vector<ArpConfig> SystemConfigurationManager::GetArpEntries(
   if (sysctl(mib, 6, buf.data(), &needed, nullptr, 0) < 0)
     return entries;
 
+  InterfaceIndexCache ifindexes;
   char *lim = buf.data() + needed;
   for (char *next = buf.data(); next < lim;) {
     struct rt_msghdr *rtm = reinterpret_cast<struct rt_msghdr *>(next);
@@ -105,17 +107,17 @@ std::vector<ArpConfig> SystemConfigurationManager::GetArpEntries(
       continue;
 
     // Get interface name
-    char ifname[IF_NAMESIZE] = {0};
-    if (if_indextoname(sdl->sdl_index, ifname) == nullptr)
+    const std::string *ifname = ifindexes.name(sdl->sdl_index);
+    if (!ifname)
       continue;
 
     // Apply interface filter if specified
-    if (iface_filter && *iface_filter != ifname)
+    if (iface_filter && *iface_filter != *ifname)
       continue;
 
     ArpConfig entry;
-    entry.ip = ip_buf;
-    entry.iface = ifname;
+    entry.ip = IPPrefix::v4(ntohl(sin->sin_addr.s_addr));
+    entry.iface = *ifname;
 
     // Get MAC address
     if (sdl->sdl_alen == ETHER_ADDR_LEN) {
@@ -227,39 +227,25 @@ std::vector<std::string> SystemConfigurationManager::query_interface_groups(
   return out;
 }
 
-// Build an IPNetwork from ifaddrs address/netmask (returns nullptr if not
+// Build an InterfaceAddress from ifaddrs address/netmask (nullopt if not
 // IPv4/6)
-std::unique_ptr<IPNetwork> ipNetworkFromIfa(const struct ifaddrs *ifa) {
+std::optional<InterfaceAddress> addressFromIfa(const struct ifaddrs *ifa) {
   if (!ifa || !ifa->ifa_addr)
-    return nullptr;
-  char buf[INET6_ADDRSTRLEN] = {0};
-  if (ifa->ifa_addr->sa_family == AF_INET) {
-    auto *a = reinterpret_cast<struct sockaddr_in *>(ifa->ifa_addr);
-    if (inet_ntop(AF_INET, &a->sin_addr, buf, sizeof(buf))) {
-      uint8_t masklen = 32;
-      if (ifa->ifa_netmask)
-        masklen = IPNetwork::masklenFromSockaddr(ifa->ifa_netmask);
-      return IPNetwork::fromString(std::string(buf) + "/" +
-                                   std::to_string(masklen));
-    }
-  } else if (ifa->ifa_addr->sa_family == AF_INET6) {
+    return std::nullopt;
+  std::optional<uint8_t> masklen;
+  if (ifa->ifa_netmask)
+    masklen = IPNetwork::masklenFromSockaddr(ifa->ifa_netmask);
+  auto net = IPPrefix::fromSockaddr(ifa->ifa_addr, masklen);
+  if (!net)
+    return std::nullopt;
+  InterfaceAddress out(*net);
+  // Capture scope ID from the original sockaddr_in6
+  if (ifa->ifa_addr->sa_family == AF_INET6) {
     auto *a6 = reinterpret_cast<struct sockaddr_in6 *>(ifa->ifa_addr);
-    if (inet_ntop(AF_INET6, &a6->sin6_addr, buf, sizeof(buf))) {
-      uint8_t masklen = 128;
-      if (ifa->ifa_netmask)
-        masklen = IPNetwork::masklenFromSockaddr(ifa->ifa_netmask);
-      auto net = IPNetwork::fromString(std::string(buf) + "/" +
-                                       std::to_string(masklen));
-      // Capture scope ID from the original sockaddr_in6
-      if (net && a6->sin6_scope_id != 0) {
-        auto *v6 = dynamic_cast<IPv6Network *>(net.get());
-        if (v6)
-          v6->scopeid = a6->sin6_scope_id;
-      }
-      return net;
-    }
+    if (a6->sin6_scope_id != 0)
+      out.scopeid = a6->sin6_scope_id;
   }
-  return nullptr;
+  return out;
 }
 
 // Build a sockaddr_in from an IPv4Address host-order value.
@@ -305,20 +291,18 @@ struct sockaddr_in6 makePrefixMask6(int prefixlen) {
 
 // Configure a single IPv6 address on an interface via SIOCAIFADDR_IN6.
 // `flags` controls DAD behaviour (0 = normal DAD, IN6_IFF_NODAD = skip).
-void addIPv6Addr(int sock, const std::string &ifname, const IPv6Network &net,
+void addIPv6Addr(int sock, const std::string &ifname, const IPPrefix &net,
                  int flags) {
-  auto addr = net.address();
-  auto *v6 = dynamic_cast<IPv6Address *>(addr.get());
-  if (!v6)
+  if (!net.isV6())
     return;
 
   struct in6_aliasreq iar6{};
   std::strncpy(iar6.ifra_name, ifname.c_str(), IFNAMSIZ - 1);
 
-  auto sa6 = makeSockaddrIn6(v6->value());
+  auto sa6 = makeSockaddrIn6(net.v6Value());
   std::memcpy(&iar6.ifra_addr, &sa6, sizeof(sa6));
 
-  auto mask6 = makePrefixMask6(net.mask());
+  auto mask6 = makePrefixMask6(net.length());
   std::memcpy(&iar6.ifra_prefixmask, &mask6, sizeof(mask6));
 
   iar6.ifra_flags = flags;
@@ -332,25 +316,18 @@ void addIPv6Addr(int sock, const std::string &ifname, const IPv6Network &net,
 }
 
 /// Populate per-address IPv6 flags (IN6_IFF_*) and lifetimes on each
-/// IPv6Network owned by an InterfaceConfig.
+/// IPv6 address of an InterfaceConfig.
 static void populateIPv6AddrFlags(InterfaceConfig &ic) {
-  auto populate = [&](IPNetwork *net) {
-    if (!net || net->family() != AddressFamily::IPv6)
-      return;
-    auto *v6 = dynamic_cast<IPv6Network *>(net);
-    if (!v6)
-      return;
-
-    auto addr = v6->address();
-    auto *a6 = dynamic_cast<IPv6Address *>(addr.get());
-    if (!a6)
+  auto populate = [&](InterfaceAddress &a) {
+    if (a.family() != AddressFamily::IPv6)
       return;
+    InterfaceAddress *v6 = &a;
 
     Socket s(AF_INET6, SOCK_DGRAM);
     struct in6_ifreq ifr6{};
     std::strncpy(ifr6.ifr_name, ic.name.c_str(), IFNAMSIZ - 1);
 
-    auto sa6 = makeSockaddrIn6(a6->value());
+    auto sa6 = makeSockaddrIn6(a.prefix.v6Value());
     std::memcpy(&ifr6.ifr_ifru.ifru_addr, &sa6, sizeof(sa6));
 
     // Per-address flags (IN6_IFF_AUTOCONF, IN6_IFF_TEMPORARY, etc.)
@@ -365,10 +342,9 @@ static void populateIPv6AddrFlags(InterfaceConfig &ic) {
   };
 
   if (ic.address)
-    populate(ic.address.get());
+    populate(*ic.address);
   for (auto &alias : ic.aliases)
-    if (alias)
-      populate(alias.get());
+    populate(alias);
 }
 
 void SystemConfigurationManager::populateInterfaceMetadata(
@@ -377,10 +353,7 @@ void SystemConfigurationManager::populateInterfaceMetadata(
     ic.metric = *m;
 
   if (auto f = query_ifreq_int(ic.name, SIOCGIFFIB, IfreqIntField::Fib)) {
-    if (!ic.vrf)
-      ic.vrf = std::make_unique<VRFConfig>(*f);
-    else
-      ic.vrf->table = *f;
+    ic.vrf = std::make_shared<const VRFConfig>(*f);
   }
 
   if (auto mtu = query_ifreq_int(ic.name, SIOCGIFMTU, IfreqIntField::Mtu))
@@ -485,47 +458,33 @@ void SystemConfigurationManager::SaveInterface(
   // --- Address configuration ---
   if (ic.address || !ic.aliases.empty()) {
     // Primary IPv4
-    if (ic.address && ic.address->family() == AddressFamily::IPv4) {
-      auto *v4 = dynamic_cast<IPv4Network *>(ic.address.get());
-      if (v4) {
-        auto addr = v4->address();
-        auto *v4a = dynamic_cast<IPv4Address *>(addr.get());
-        if (v4a) {
-          struct ifreq aifr;
-          prepare_ifreq(aifr, ic.name);
-          auto sa = makeSockaddrIn(v4a->value());
-          std::memcpy(&aifr.ifr_addr, &sa, sizeof(sa));
-          if (ioctl(sock, SIOCSIFADDR, &aifr) < 0)
-            std::cerr << "Warning: SIOCSIFADDR failed for " << ic.name << ": "
-                      << strerror(errno) << "\n";
-        }
-      }
+    if (ic.address && ic.address->prefix.isV4()) {
+      struct ifreq aifr;
+      prepare_ifreq(aifr, ic.name);
+      auto sa = makeSockaddrIn(ic.address->prefix.v4Value());
+      std::memcpy(&aifr.ifr_addr, &sa, sizeof(sa));
+      if (ioctl(sock, SIOCSIFADDR, &aifr) < 0)
+        std::cerr << "Warning: SIOCSIFADDR failed for " << ic.name << ": "
+                  << strerror(errno) << "\n";
     }
 
     // IPv4 aliases
-    for (const auto &aptr : ic.aliases) {
-      if (!aptr || aptr->family() != AddressFamily::IPv4)
-        continue;
-      auto *a4net = dynamic_cast<IPv4Network *>(aptr.get());
-      if (!a4net)
-        continue;
-      auto addr = a4net->address();
-      auto *v4a = dynamic_cast<IPv4Address *>(addr.get());
-      if (!v4a)
+    for (const auto &alias : ic.aliases) {
+      const IPPrefix &a4net = alias.prefix;
+      if (!a4net.isV4())
         continue;
 
       struct ifaliasreq iar{};
       std::strncpy(iar.ifra_name, ic.name.c_str(), IFNAMSIZ - 1);
 
-      auto sa = makeSockaddrIn(v4a->value());
+      auto sa = makeSockaddrIn(a4net.v4Value());
       std::memcpy(&iar.ifra_addr, &sa, sizeof(sa));
 
-      uint32_t maskval =
-          (a4net->mask() == 0) ? 0u : (~0u << (32 - a4net->mask()));
+      uint32_t maskval = IPPrefix::maskV4(a4net.length());
       auto mask = makeSockaddrIn(maskval);
       std::memcpy(&iar.ifra_mask, &mask, sizeof(mask));
 
-      uint32_t bcast = (v4a->value() & maskval) | ~maskval;
+      uint32_t bcast = (a4net.v4Value() & maskval) | ~maskval;
       auto broad = makeSockaddrIn(bcast);
       std::memcpy(&iar.ifra_broadaddr, &broad, sizeof(broad));
 
@@ -543,21 +502,16 @@ void SystemConfigurationManager::SaveInterface(
     }
 
     // Primary IPv6
-    if (ic.address && ic.address->family() == AddressFamily::IPv6) {
-      auto *v6 = dynamic_cast<IPv6Network *>(ic.address.get());
-      if (v6) {
-        Socket sock6(AF_INET6, SOCK_DGRAM);
-        addIPv6Addr(sock6, ic.name, *v6, 0 /* let kernel handle DAD */);
-      }
+    if (ic.address && ic.address->prefix.isV6()) {
+      Socket sock6(AF_INET6, SOCK_DGRAM);
+      addIPv6Addr(sock6, ic.name, ic.address->prefix,
+                  0 /* let kernel handle DAD */);
     }
 
     // IPv6 aliases
-    for (const auto &aptr : ic.aliases) {
-      if (!aptr || aptr->family() != AddressFamily::IPv6)
-        continue;
-      auto *a6net = dynamic_cast<IPv6Network *>(aptr.get());
-      if (a6net)
-        addIPv6Addr(sock, ic.name, *a6net, 0x20 /* IN6_IFF_NODAD */);
+    for (const auto &alias : ic.aliases) {
+      if (alias.prefix.isV6())
+        addIPv6Addr(sock, ic.name, alias.prefix, 0x20 /* IN6_IFF_NODAD */);
     }
   }
 
@@ -694,24 +648,15 @@ void SystemConfigurationManager::DestroyInterface(
 
 void SystemConfigurationManager::RemoveInterfaceAddress(
     const std::string &ifname, const std::string &addr) const {
-  auto net = IPNetwork::fromString(addr);
+  auto net = IPPrefix::fromString(addr);
   if (!net)
     throw std::runtime_error("Invalid address: " + addr);
 
-  if (net->family() == AddressFamily::IPv4) {
-    auto *v4 = dynamic_cast<IPv4Network *>(net.get());
-    if (!v4)
-      throw std::runtime_error("Invalid IPv4 address object");
-
-    auto ipaddr = v4->address();
-    auto *v4a = dynamic_cast<IPv4Address *>(ipaddr.get());
-    if (!v4a)
-      throw std::runtime_error("Invalid IPv4 address object");
-
+  if (net->isV4()) {
     Socket sock(AF_INET, SOCK_DGRAM);
     struct ifreq ifr;
     prepare_ifreq(ifr, ifname);
-    auto sa = makeSockaddrIn(v4a->value());
+    auto sa = makeSockaddrIn(net->v4Value());
     std::memcpy(&ifr.ifr_addr, &sa, sizeof(sa));
     if (ioctl(sock, SIOCDIFADDR, &ifr) < 0)
       throw std::runtime_error(std::string("failed to remove address: ") +
@@ -756,13 +701,13 @@ std::vector<InterfaceConfig> SystemConfigurationManager::GetInterfaces(
     if (it == map.end()) {
       // Build primary InterfaceConfig from ifa fields (system-level parsing)
       InterfaceType t = ifAddrToInterfaceType(ifa);
-      std::unique_ptr<IPNetwork> addr = ipNetworkFromIfa(ifa);
-      std::vector<std::unique_ptr<IPNetwork>> aliases;
+      std::optional<InterfaceAddress> addr = addressFromIfa(ifa);
+      std::vector<InterfaceAddress> aliases;
       std::optional<uint32_t> flags = std::nullopt;
       if (ifa->ifa_flags)
         flags = ifa->ifa_flags;
       auto ic = std::shared_ptr<InterfaceConfig>(
-          new InterfaceConfig(name, t, std::move(addr), std::move(aliases),
+          new InterfaceConfig(name, t, addr, std::move(aliases),
                               nullptr, flags, {}, std::nullopt));
       if (ic->type == InterfaceType::Wireless) {
         auto w =
@@ -776,12 +721,12 @@ std::vector<InterfaceConfig> SystemConfigurationManager::GetInterfaces(
       if (ifa->ifa_addr) {
         if (ifa->ifa_addr->sa_family == AF_INET ||
             ifa->ifa_addr->sa_family == AF_INET6) {
-          auto tmpaddr = ipNetworkFromIfa(ifa);
+          auto tmpaddr = addressFromIfa(ifa);
           if (tmpaddr) {
             if (!existing->address) {
-              existing->address = std::move(tmpaddr);
+              existing->address = *tmpaddr;
             } else {
-              existing->aliases.emplace_back(std::move(tmpaddr));
+              existing->aliases.emplace_back(*tmpaddr);
             }
           }
         }
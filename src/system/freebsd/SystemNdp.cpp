@@ -26,6 +26,7 @@
  */
 
 #include "NdpConfig.hpp"
+#include "InterfaceNames.hpp"
 #include "RoutingSocket.hpp"
 #include "SystemConfigurationManager.hpp"
 
@@ -77,6 +78,7 @@ std::vector<NdpConfig> SystemConfigurationManager::GetNdpEntries(
   if (sysctl(mib, 6, buf.data(), &needed, nullptr, 0) < 0)
     return entries;
 
+  InterfaceIndexCache ifindexes;
   char *lim = buf.data() + needed;
   for (char *next = buf.data(); next < lim;) {
     struct rt_msghdr *rtm = reinterpret_cast<struct rt_msghdr *>(next);
@@ -111,17 +113,17 @@ std::vector<NdpConfig> SystemConfigurationManager::GetNdpEntries(
       continue;
 
     // Get interface name
-    char ifname[IF_NAMESIZE] = {0};
-    if (if_indextoname(sdl->sdl_index, ifname) == nullptr)
+    const std::string *ifname = ifindexes.name(sdl->sdl_index);
+    if (!ifname)
       continue;
 
     // Apply interface filter if specified
-    if (iface_filter && *iface_filter != ifname)
+    if (iface_filter && *iface_filter != *ifname)
       continue;
 
     NdpConfig entry;
-    entry.ip = ip_buf;
-    entry.iface = ifname;
+    entry.ip = IPPrefix::v6Bytes(sin6->sin6_addr.s6_addr);
+    entry.iface = *ifname;
 
     // Get MAC address and link-layer metadata
     entry.ifindex = static_cast<int>(sdl->sdl_index);
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SystemNexthops.cpp
+ * @brief FreeBSD system implementation for nexthop groups (STUB)
+ *
+ * FreeBSD nexthop groups are created implicitly by the kernel for
+ * multipath routes and cannot be managed as named objects from the
+ * routing socket; all operations are no-ops / return empty.
+ */
+
+#include "NexthopGroupConfig.hpp"
+#include "SystemConfigurationManager.hpp"
+
+#include <vector>
+
+// ── GetNexthopGroups (stub) ──────────────────────────────────────────
+
+std::vector<NexthopGroupConfig>
+SystemConfigurationManager::GetNexthopGroups() const {
+  return {};
+}
+
+// ── SetNexthopGroup (stub) ───────────────────────────────────────────
+
+void SystemConfigurationManager::SetNexthopGroup(
+    const NexthopGroupConfig & /*group*/) const {
+  // not yet implemented
+}
+
+// ── DeleteNexthopGroup (stub) ────────────────────────────────────────
+
+void SystemConfigurationManager::DeleteNexthopGroup(
+    const NexthopGroupConfig & /*group*/) const {
+  // not yet implemented
+}
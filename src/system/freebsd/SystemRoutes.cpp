@@ -5,6 +5,7 @@
 
 #include "InterfaceConfig.hpp"
 #include "RouteConfig.hpp"
+#include "RouteTable.hpp"
 #include "SystemConfigurationManager.hpp"
 
 #include <arpa/inet.h>
@@ -14,6 +15,7 @@
 #include <net/if_dl.h>
 #include <net/route.h>
 #include <netinet/in.h>
+#include <optional>
 #include <sstream>
 #include <sys/socket.h>
 #include <sys/sysctl.h>
@@ -40,6 +42,8 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
   if (sysctl(mib, 7, buf.data(), &needed, nullptr, 0) < 0)
     return routes;
 
+  // Resolve each interface index once per dump, not once per route.
+  InterfaceIndexCache ifindexes;
   char *lim = buf.data() + needed;
   for (char *next = buf.data(); next < lim;) {
     struct rt_msghdr *rtm = reinterpret_cast<struct rt_msghdr *>(next);
@@ -144,13 +148,11 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
     }
 
     if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::DST)]) {
-      char buf_dst[INET6_ADDRSTRLEN] = {0};
       int prefixlen = 0;
       if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::DST)]->sa_family ==
           AF_INET) {
         auto sin = reinterpret_cast<struct sockaddr_in *>(
             rti_info[RouteConfig::RTAX(RouteConfig::RTAX::DST)]);
-        inet_ntop(AF_INET, &sin->sin_addr, buf_dst, sizeof(buf_dst));
         if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::NETMASK)]) {
           auto mask = reinterpret_cast<struct sockaddr_in *>(
               rti_info[RouteConfig::RTAX(RouteConfig::RTAX::NETMASK)]);
@@ -158,12 +160,11 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
           prefixlen = __builtin_popcount(m);
         } else
           prefixlen = 32;
-        rc.prefix = std::string(buf_dst) + "/" + std::to_string(prefixlen);
+        rc.prefix = IPPrefix::v4(ntohl(sin->sin_addr.s_addr), prefixlen);
       } else if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::DST)]
                      ->sa_family == AF_INET6) {
         auto sin6 = reinterpret_cast<struct sockaddr_in6 *>(
             rti_info[RouteConfig::RTAX(RouteConfig::RTAX::DST)]);
-        inet_ntop(AF_INET6, &sin6->sin6_addr, buf_dst, sizeof(buf_dst));
         if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::NETMASK)]) {
           auto mask6 = reinterpret_cast<struct sockaddr_in6 *>(
               rti_info[RouteConfig::RTAX(RouteConfig::RTAX::NETMASK)]);
@@ -173,36 +174,30 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
         } else
           prefixlen = 128;
         if (sin6->sin6_scope_id != 0) {
-          char ifn[IF_NAMESIZE] = {0};
-          if (if_indextoname(static_cast<unsigned int>(sin6->sin6_scope_id),
-                             ifn)) {
-            rc.scope = std::string(ifn);
-          }
+          if (auto *ifn = ifindexes.name(sin6->sin6_scope_id))
+            rc.scope = *ifn;
         }
-        rc.prefix = std::string(buf_dst) + "/" + std::to_string(prefixlen);
+        rc.prefix = IPPrefix::v6Bytes(sin6->sin6_addr.s6_addr, prefixlen);
       }
     }
 
     if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]) {
-      char buf_gw[INET6_ADDRSTRLEN] = {0};
       if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]->sa_family ==
           AF_INET) {
         auto sin = reinterpret_cast<struct sockaddr_in *>(
             rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]);
-        if (inet_ntop(AF_INET, &sin->sin_addr, buf_gw, sizeof(buf_gw)))
-          rc.nexthop = buf_gw;
+        rc.nexthop = IPPrefix::v4(ntohl(sin->sin_addr.s_addr));
       } else if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]
                      ->sa_family == AF_INET6) {
         auto sin6 = reinterpret_cast<struct sockaddr_in6 *>(
             rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]);
-        if (inet_ntop(AF_INET6, &sin6->sin6_addr, buf_gw, sizeof(buf_gw)))
-          rc.nexthop = buf_gw;
+        rc.nexthop = IPPrefix::v6Bytes(sin6->sin6_addr.s6_addr);
       } else if (rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]
                      ->sa_family == AF_LINK) {
         auto sdl = reinterpret_cast<struct sockaddr_dl *>(
             rti_info[RouteConfig::RTAX(RouteConfig::RTAX::GATEWAY)]);
         if (sdl->sdl_index > 0) {
-          rc.nexthop = std::string("link#") + std::to_string(sdl->sdl_index);
+          rc.gateway_link = sdl->sdl_index;
         }
         if (sdl->sdl_nlen > 0)
           rc.iface = std::string(sdl->sdl_data, sdl->sdl_nlen);
@@ -224,10 +219,9 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
 
     if (rtm->rtm_index > 0) {
       rc.iface_index = static_cast<int>(rtm->rtm_index);
-      char ifname[IF_NAMESIZE];
-      if (if_indextoname(rtm->rtm_index, ifname)) {
+      if (auto *ifname = ifindexes.name(rtm->rtm_index)) {
         if (!rc.iface)
-          rc.iface = ifname;
+          rc.iface = *ifname;
       }
     }
 
@@ -260,7 +254,8 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
  * System route deletion implementation (routing socket)
  */
 
-#include "IPAddress.hpp"
+#include "IPPrefix.hpp"
+#include "InterfaceNames.hpp"
 #include "RouteConfig.hpp"
 #include "Socket.hpp"
 #include "SystemConfigurationManager.hpp"
@@ -278,20 +273,18 @@ std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
 #include <sys/types.h>
 #include <unistd.h>
 
-// Shared helper for RTM_ADD / RTM_DELETE via routing socket.
-static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
-  auto net = IPNetwork::fromString(rc.prefix);
-  if (!net) {
-    throw std::runtime_error("Invalid route prefix: " + rc.prefix);
+// Write one RTM_ADD / RTM_DELETE message to an open routing socket whose
+// FIB already matches rc.vrf.
+static void writeRouteMessage(int s, const RouteConfig &rc, int rtm_type,
+                              int seq) {
+  const IPPrefix &net = rc.prefix;
+  if (net.empty()) {
+    throw std::runtime_error("route has no destination prefix");
   }
-
-  Socket s(PF_ROUTE, SOCK_RAW);
-
-  if (rc.vrf) {
-    int fib = *rc.vrf;
-    if (fib >= 0) {
-      setsockopt(s, SOL_SOCKET, SO_SETFIB, &fib, sizeof(fib));
-    }
+  if (rc.nexthop_group) {
+    throw std::runtime_error("nexthop groups are not supported on this "
+                             "platform: " +
+                             *rc.nexthop_group);
   }
 
   struct {
@@ -305,7 +298,7 @@ static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
 
   rtm->rtm_version = RTM_VERSION;
   rtm->rtm_type = rtm_type;
-  rtm->rtm_seq = 1;
+  rtm->rtm_seq = seq;
   rtm->rtm_pid = getpid();
 
   rtm->rtm_flags = RTF_UP | RTF_STATIC;
@@ -314,13 +307,12 @@ static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
   if (rc.reject)
     rtm->rtm_flags |= RTF_REJECT;
 
-  if (net->family() == AddressFamily::IPv4) {
+  if (net.isV4()) {
     rtm->rtm_addrs |= RTA_DST;
     struct sockaddr_in sin_dst{};
     sin_dst.sin_len = sizeof(sin_dst);
     sin_dst.sin_family = AF_INET;
-    std::string dst = net->address()->toString();
-    inet_pton(AF_INET, dst.c_str(), &sin_dst.sin_addr);
+    sin_dst.sin_addr.s_addr = htonl(net.v4Value());
     memcpy(cp, &sin_dst, sizeof(sin_dst));
     cp += sizeof(sin_dst);
 
@@ -329,31 +321,27 @@ static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
       struct sockaddr_in sin_gw{};
       sin_gw.sin_len = sizeof(sin_gw);
       sin_gw.sin_family = AF_INET;
-      inet_pton(AF_INET, rc.nexthop->c_str(), &sin_gw.sin_addr);
+      sin_gw.sin_addr.s_addr = htonl(rc.nexthop->v4Value());
       rtm->rtm_flags |= RTF_GATEWAY;
       memcpy(cp, &sin_gw, sizeof(sin_gw));
       cp += sizeof(sin_gw);
     }
 
-    if (net->mask() < 32) {
+    if (net.length() < 32) {
       rtm->rtm_addrs |= RTA_NETMASK;
       struct sockaddr_in sin_mask{};
       sin_mask.sin_len = sizeof(sin_mask);
       sin_mask.sin_family = AF_INET;
-      auto m = IPAddress::maskFromCIDR(AddressFamily::IPv4, net->mask());
-      if (m) {
-        inet_pton(AF_INET, m->toString().c_str(), &sin_mask.sin_addr);
-      }
+      sin_mask.sin_addr.s_addr = htonl(IPPrefix::maskV4(net.length()));
       memcpy(cp, &sin_mask, sizeof(sin_mask));
       cp += sizeof(sin_mask);
     }
-  } else if (net->family() == AddressFamily::IPv6) {
+  } else if (net.isV6()) {
     rtm->rtm_addrs |= RTA_DST;
     struct sockaddr_in6 sin6_dst{};
     sin6_dst.sin6_len = sizeof(sin6_dst);
     sin6_dst.sin6_family = AF_INET6;
-    std::string dst = net->address()->toString();
-    inet_pton(AF_INET6, dst.c_str(), &sin6_dst.sin6_addr);
+    memcpy(&sin6_dst.sin6_addr, net.bytes().data(), 16);
     memcpy(cp, &sin6_dst, sizeof(sin6_dst));
     cp += sizeof(sin6_dst);
 
@@ -362,21 +350,19 @@ static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
       struct sockaddr_in6 sin6_gw{};
       sin6_gw.sin6_len = sizeof(sin6_gw);
       sin6_gw.sin6_family = AF_INET6;
-      inet_pton(AF_INET6, rc.nexthop->c_str(), &sin6_gw.sin6_addr);
+      memcpy(&sin6_gw.sin6_addr, rc.nexthop->bytes().data(), 16);
       rtm->rtm_flags |= RTF_GATEWAY;
       memcpy(cp, &sin6_gw, sizeof(sin6_gw));
       cp += sizeof(sin6_gw);
     }
 
-    if (net->mask() < 128) {
+    if (net.length() < 128) {
       rtm->rtm_addrs |= RTA_NETMASK;
       struct sockaddr_in6 sin6_mask{};
       sin6_mask.sin6_len = sizeof(sin6_mask);
       sin6_mask.sin6_family = AF_INET6;
-      auto m6 = IPAddress::maskFromCIDR(AddressFamily::IPv6, net->mask());
-      if (m6) {
-        inet_pton(AF_INET6, m6->toString().c_str(), &sin6_mask.sin6_addr);
-      }
+      auto m6 = IPPrefix::v6(IPPrefix::maskV6(net.length()));
+      memcpy(&sin6_mask.sin6_addr, m6.bytes().data(), 16);
       memcpy(cp, &sin6_mask, sizeof(sin6_mask));
       cp += sizeof(sin6_mask);
     }
@@ -392,6 +378,23 @@ static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
   }
 }
 
+// Routing socket bound to the route's FIB.
+static Socket routeSocket(const std::optional<int> &vrf) {
+  Socket s(PF_ROUTE, SOCK_RAW);
+  if (vrf) {
+    int fib = *vrf;
+    if (fib >= 0) {
+      setsockopt(s, SOL_SOCKET, SO_SETFIB, &fib, sizeof(fib));
+    }
+  }
+  return s;
+}
+
+// Shared helper for RTM_ADD / RTM_DELETE via routing socket.
+static void routeSocketOp(const RouteConfig &rc, int rtm_type) {
+  writeRouteMessage(routeSocket(rc.vrf), rc, rtm_type, 1);
+}
+
 void SystemConfigurationManager::DeleteRoute(const RouteConfig &rc) const {
   routeSocketOp(rc, RTM_DELETE);
 }
@@ -400,7 +403,34 @@ void SystemConfigurationManager::AddRoute(const RouteConfig &rc) const {
   routeSocketOp(rc, RTM_ADD);
 }
 
+void SystemConfigurationManager::AddRoutes(
+    const std::vector<RouteConfig> &routes) const {
+  // One socket per run of routes in the same FIB instead of one per route.
+  std::optional<Socket> s;
+  std::optional<int> fib;
+  int seq = 0;
+  for (const auto &rc : routes) {
+    if (!s || rc.vrf != fib) {
+      s.emplace(routeSocket(rc.vrf));
+      fib = rc.vrf;
+    }
+    writeRouteMessage(*s, rc, RTM_ADD, ++seq);
+  }
+}
+
+// RTM_CHANGE re-points the existing entry, so the prefix is never left
+// unrouted.
+void SystemConfigurationManager::ReplaceRoute(const RouteConfig & /*was*/,
+                                              const RouteConfig &want) const {
+  routeSocketOp(want, RTM_CHANGE);
+}
+
 std::vector<RouteConfig> SystemConfigurationManager::GetRoutes(
     const std::optional<VRFConfig> &vrf) const {
   return GetStaticRoutes(vrf);
 }
+
+RouteTable SystemConfigurationManager::GetRouteTable(
+    const std::optional<VRFConfig> &vrf) const {
+  return RouteTable(GetStaticRoutes(vrf));
+}
@@ -19,9 +19,27 @@ void SystemConfigurationManager::SaveTap(const TapInterfaceConfig &tap) const {
   if (tap.name.empty())
     throw std::runtime_error("TapInterfaceConfig has no interface name set");
 
+  // Multiqueue and vnet headers are Linux /dev/net/tun features; tap(4)
+  // device ownership is managed through devfs rules instead.
+  if ((tap.queues && *tap.queues > 1) || tap.owner || tap.owner_group ||
+      (tap.vnet_hdr && *tap.vnet_hdr))
+    throw std::runtime_error(
+        "tap queues/owner/owner-group/vnet-hdr are not supported on FreeBSD");
+
   if (!InterfaceConfig::exists(*this, tap.name))
     CreateTap(tap.name);
 
   // Use generic interface save for addresses/mtu/flags
   SaveInterface(tap);
 }
+
+std::vector<TapInterfaceConfig> SystemConfigurationManager::GetTapInterfaces(
+    const std::vector<InterfaceConfig> &bases) const {
+  std::vector<TapInterfaceConfig> out;
+  for (const auto &ic : bases) {
+    if (ic.type == InterfaceType::Tap) {
+      out.emplace_back(ic);
+    }
+  }
+  return out;
+}
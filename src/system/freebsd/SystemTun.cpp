@@ -22,6 +22,11 @@ void SystemConfigurationManager::SaveTun(const TunInterfaceConfig &t) const {
   if (t.name.empty())
     throw std::runtime_error("TunInterfaceConfig has no interface name set");
 
+  if ((t.queues && *t.queues > 1) || t.owner || t.owner_group ||
+      (t.vnet_hdr && *t.vnet_hdr))
+    throw std::runtime_error(
+        "tun queues/owner/owner-group/vnet-hdr are not supported on FreeBSD");
+
   if (!t.source || !t.destination) {
     throw std::runtime_error("Tun endpoints not configured");
   }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "NexthopGroupNames.hpp"
+#include "NexthopGroupConfig.hpp"
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <sys/stat.h>
+
+NexthopGroupNames::NexthopGroupNames(std::string path)
+    : path_(std::move(path)) {
+  std::ifstream in(path_);
+  std::string line;
+  while (std::getline(in, line)) {
+    // "<id> <name>"; the name is the rest of the line.
+    uint32_t id = 0;
+    auto [p, ec] = std::from_chars(line.data(), line.data() + line.size(), id);
+    if (ec != std::errc() || p == line.data() + line.size() || *p != ' ')
+      continue;
+    std::string name = line.substr(size_t(p - line.data()) + 1);
+    // Entries whose name no longer hashes to the id are stale.
+    if (NexthopGroupConfig::idFromName(name) == id)
+      names_[id] = std::move(name);
+  }
+}
+
+std::string NexthopGroupNames::name(uint32_t id) const {
+  auto it = names_.find(id);
+  return it != names_.end() ? it->second : std::to_string(id);
+}
+
+void NexthopGroupNames::set(uint32_t id, std::string_view name) {
+  if (name == std::to_string(id) || name.find('\n') != name.npos)
+    return;
+  auto [it, added] = names_.try_emplace(id, name);
+  if (!added && it->second == name)
+    return;
+  it->second = name;
+  save();
+}
+
+void NexthopGroupNames::erase(uint32_t id) {
+  if (names_.erase(id))
+    save();
+}
+
+void NexthopGroupNames::save() const {
+  // The names only decorate output, so failing to record them is not an
+  // error: groups are still matched by id.
+  auto slash = path_.rfind('/');
+  if (slash != std::string::npos && slash > 0)
+    mkdir(path_.substr(0, slash).c_str(), 0755);
+  std::string tmp = path_ + ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::trunc);
+    if (!out)
+      return;
+    for (const auto &[id, name] : names_)
+      out << id << ' ' << name << '\n';
+    if (!out.flush())
+      return;
+  }
+  std::rename(tmp.c_str(), path_.c_str());
+}
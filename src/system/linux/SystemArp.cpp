@@ -62,7 +62,8 @@ std::vector<ArpConfig> SystemConfigurationManager::GetArpEntries(
       continue;
 
     ArpConfig entry;
-    entry.ip = ip;
+    if (auto a = IPPrefix::fromString(ip))
+      entry.ip = *a;
     entry.mac = hw_addr;
     entry.iface = device;
 
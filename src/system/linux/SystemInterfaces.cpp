@@ -30,16 +30,20 @@
 #include "SystemConfigurationManager.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstring>
 #include <ifaddrs.h>
 #include <iostream>
 #include <linux/ethtool.h>
 #include <linux/sockios.h>
+#include <memory_resource>
 #include <net/if.h>
 #include <net/if_arp.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <string>
+#include <string_view>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -66,8 +70,15 @@ namespace {
         return InterfaceType::VLAN;
       if (driver == "vrf")
         return InterfaceType::VRF;
-      if (driver == "tun")
+      if (driver == "tun") {
+        // tap devices carry an Ethernet header; tun devices have none.
+        struct ifreq hw{};
+        std::strncpy(hw.ifr_name, name.c_str(), IFNAMSIZ - 1);
+        if (ioctl(sock, SIOCGIFHWADDR, &hw) == 0 &&
+            hw.ifr_hwaddr.sa_family == ARPHRD_ETHER)
+          return InterfaceType::Tap;
         return InterfaceType::Tun;
+      }
       if (driver == "veth")
         return InterfaceType::Epair;
       if (driver == "vxlan")
@@ -177,20 +188,24 @@ std::vector<InterfaceConfig> SystemConfigurationManager::GetInterfaces(
     return results;
   }
 
-  std::unordered_map<std::string, InterfaceConfig> iface_map;
+  // Name -> position in `results`. The keys point into the ifaddrs list
+  // and the index lives in a pass-local arena, so neither outlives this
+  // call nor costs an allocation per entry.
+  std::array<std::byte, 4096> buf;
+  std::pmr::monotonic_buffer_resource arena(buf.data(), buf.size());
+  std::pmr::unordered_map<std::string_view, size_t> index(&arena);
 
   for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
     if (ifa->ifa_name == nullptr)
       continue;
 
-    std::string name(ifa->ifa_name);
-    auto [it, inserted] = iface_map.try_emplace(name);
-    auto &ic = it->second;
-
+    auto [it, inserted] = index.try_emplace(ifa->ifa_name, results.size());
     if (inserted) {
-      ic.name = name;
-      populateInterfaceMetadata(ic);
+      auto &fresh = results.emplace_back();
+      fresh.name = ifa->ifa_name;
+      populateInterfaceMetadata(fresh);
     }
+    auto &ic = results[it->second];
 
     if (ifa->ifa_addr == nullptr)
       continue;
@@ -208,12 +223,11 @@ std::vector<InterfaceConfig> SystemConfigurationManager::GetInterfaces(
           mask <<= 1;
         }
       }
-      auto net =
-          std::make_unique<IPv4Network>(ntohl(sa->sin_addr.s_addr), prefix);
+      auto net = IPPrefix::v4(ntohl(sa->sin_addr.s_addr), prefix);
       if (!ic.address) {
-        ic.address = std::move(net);
+        ic.address = net;
       } else {
-        ic.aliases.push_back(std::move(net));
+        ic.aliases.push_back(net);
       }
     } else if (ifa->ifa_addr->sa_family == AF_INET6) {
       struct sockaddr_in6 *sa6 =
@@ -230,27 +244,24 @@ std::vector<InterfaceConfig> SystemConfigurationManager::GetInterfaces(
           }
         }
       }
-      unsigned __int128 val = 0;
-      for (int i = 0; i < 16; i++) {
-        val = (val << 8) | sa6->sin6_addr.s6_addr[i];
-      }
-      auto net = std::make_unique<IPv6Network>(val, prefix);
+      InterfaceAddress net = IPPrefix::v6Bytes(sa6->sin6_addr.s6_addr, prefix);
+      if (sa6->sin6_scope_id)
+        net.scopeid = sa6->sin6_scope_id;
       if (!ic.address) {
-        ic.address = std::move(net);
+        ic.address = net;
       } else {
-        ic.aliases.push_back(std::move(net));
+        ic.aliases.push_back(net);
       }
     }
   }
 
   freeifaddrs(ifaddr);
 
-  for (auto &pair : iface_map) {
-    if (matches_vrf(pair.second, vrf)) {
-      results.push_back(std::move(pair.second));
-    }
-  }
-
+  if (!vrf)
+    return results;
+  std::erase_if(results, [&](const InterfaceConfig &ic) {
+    return !matches_vrf(ic, vrf);
+  });
   return results;
 }
 
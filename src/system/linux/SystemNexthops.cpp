@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SystemNexthops.cpp
+ * @brief Linux nexthop group objects (RTM_NEWNEXTHOP / RTM_DELNEXTHOP)
+ *
+ * Every gateway becomes a standalone nexthop object whose id is derived
+ * from the gateway and outgoing interface, so the same gateway is shared
+ * by all groups that use it. A group is a nexthop object carrying an
+ * NHA_GROUP array of member ids; routes reference the group through
+ * RTA_NH_ID. Replacing the group object re-points every dependent route
+ * in one kernel update, which is what makes failover cheap.
+ */
+
+#include "InterfaceNames.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "NexthopGroupNames.hpp"
+#include "SystemConfigurationManager.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <linux/netlink.h>
+#include <linux/nexthop.h>
+#include <linux/rtnetlink.h>
+#include <map>
+#include <net/if.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  struct nh_req {
+    struct nlmsghdr n;
+    struct nhmsg nh;
+    char buf[1024];
+  };
+
+  void add_attr(struct nlmsghdr *n, int type, const void *data, int len) {
+    int nlalen = NLMSG_ALIGN(n->nlmsg_len);
+    struct rtattr *rta = (struct rtattr *)(((char *)n) + nlalen);
+    rta->rta_type = type;
+    rta->rta_len = RTA_LENGTH(len);
+    std::memcpy(RTA_DATA(rta), data, len);
+    n->nlmsg_len = nlalen + RTA_ALIGN(rta->rta_len);
+  }
+
+  // Standalone gateway objects live above the range used for group ids
+  // (see NexthopGroupConfig::idFromName).
+  constexpr uint32_t kMemberIdBase = 0x40000000u;
+
+  uint32_t member_id(const std::string &gateway, int ifindex) {
+    std::string key = gateway + "%" + std::to_string(ifindex);
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : key) {
+      hash ^= c;
+      hash *= 16777619u;
+    }
+    return kMemberIdBase + (hash % 0x3fffffffu);
+  }
+
+  struct NhObject {
+    uint32_t id = 0;
+    int family = AF_UNSPEC;
+    int protocol = 0; ///< RTPROT_STATIC for objects this tool created
+    std::optional<std::string> gateway;
+    int oif = 0;
+    std::vector<struct nexthop_grp> group;
+  };
+
+  // Send one request and wait for its ACK. Returns 0 or a negative errno.
+  int nl_transact(int sock, struct nlmsghdr *n) {
+    n->nlmsg_flags |= NLM_F_ACK;
+    if (send(sock, n, n->nlmsg_len, 0) < 0)
+      return -errno;
+
+    char buf[8192];
+    for (;;) {
+      ssize_t len = recv(sock, buf, sizeof(buf), 0);
+      if (len < 0)
+        return -errno;
+      struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+      for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+           nh = NLMSG_NEXT(nh, len)) {
+        if (nh->nlmsg_type == NLMSG_ERROR) {
+          auto *err = (struct nlmsgerr *)NLMSG_DATA(nh);
+          return err->error;
+        }
+      }
+    }
+  }
+
+  std::vector<NhObject> dump_nexthops(int sock) {
+    std::vector<NhObject> out;
+
+    struct {
+      struct nlmsghdr n;
+      struct nhmsg nh;
+    } req{};
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct nhmsg));
+    req.n.nlmsg_type = RTM_GETNEXTHOP;
+    req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.nh.nh_family = AF_UNSPEC;
+    if (send(sock, &req, req.n.nlmsg_len, 0) < 0)
+      return out;
+
+    char buf[16384];
+    for (;;) {
+      ssize_t len = recv(sock, buf, sizeof(buf), 0);
+      if (len <= 0)
+        return out;
+      struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+      for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+           nh = NLMSG_NEXT(nh, len)) {
+        if (nh->nlmsg_type == NLMSG_DONE || nh->nlmsg_type == NLMSG_ERROR)
+          return out;
+        if (nh->nlmsg_type != RTM_NEWNEXTHOP)
+          continue;
+
+        auto *nhm = (struct nhmsg *)NLMSG_DATA(nh);
+        NhObject obj;
+        obj.family = nhm->nh_family;
+        obj.protocol = nhm->nh_protocol;
+
+        struct rtattr *rta =
+            (struct rtattr *)((char *)nhm + NLMSG_ALIGN(sizeof(*nhm)));
+        int rta_len =
+            static_cast<int>(nh->nlmsg_len - NLMSG_LENGTH(sizeof(*nhm)));
+        for (; RTA_OK(rta, rta_len); rta = RTA_NEXT(rta, rta_len)) {
+          switch (rta->rta_type) {
+          case NHA_ID:
+            obj.id = *(uint32_t *)RTA_DATA(rta);
+            break;
+          case NHA_OIF:
+            obj.oif = *(int *)RTA_DATA(rta);
+            break;
+          case NHA_GATEWAY: {
+            char addr[INET6_ADDRSTRLEN] = {};
+            if (inet_ntop(obj.family, RTA_DATA(rta), addr, sizeof(addr)))
+              obj.gateway = addr;
+            break;
+          }
+          case NHA_GROUP: {
+            size_t count = RTA_PAYLOAD(rta) / sizeof(struct nexthop_grp);
+            auto *grp = (struct nexthop_grp *)RTA_DATA(rta);
+            obj.group.assign(grp, grp + count);
+            break;
+          }
+          default:
+            break;
+          }
+        }
+        if (obj.id != 0)
+          out.push_back(std::move(obj));
+      }
+    }
+  }
+
+  // Ask the kernel which interface it would use to reach `gateway`.
+  int resolve_oif(int sock, int family, const void *gateway, int addrlen) {
+    struct {
+      struct nlmsghdr n;
+      struct rtmsg r;
+      char buf[64];
+    } req{};
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+    req.n.nlmsg_type = RTM_GETROUTE;
+    req.n.nlmsg_flags = NLM_F_REQUEST;
+    req.r.rtm_family = family;
+    req.r.rtm_dst_len = addrlen * 8;
+    add_attr(&req.n, RTA_DST, gateway, addrlen);
+    if (send(sock, &req, req.n.nlmsg_len, 0) < 0)
+      return 0;
+
+    char buf[4096];
+    ssize_t len = recv(sock, buf, sizeof(buf), 0);
+    if (len <= 0)
+      return 0;
+    struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+    for (; NLMSG_OK(nh, static_cast<uint32_t>(len)); nh = NLMSG_NEXT(nh, len)) {
+      if (nh->nlmsg_type != RTM_NEWROUTE)
+        continue;
+      auto *rtm = (struct rtmsg *)NLMSG_DATA(nh);
+      struct rtattr *rta = RTM_RTA(rtm);
+      int rta_len = static_cast<int>(RTM_PAYLOAD(nh));
+      for (; RTA_OK(rta, rta_len); rta = RTA_NEXT(rta, rta_len)) {
+        if (rta->rta_type == RTA_OIF)
+          return *(int *)RTA_DATA(rta);
+      }
+    }
+    return 0;
+  }
+
+  void delete_nexthop(int sock, uint32_t id) {
+    struct nh_req req{};
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct nhmsg));
+    req.n.nlmsg_type = RTM_DELNEXTHOP;
+    req.n.nlmsg_flags = NLM_F_REQUEST;
+    req.nh.nh_family = AF_UNSPEC;
+    add_attr(&req.n, NHA_ID, &id, sizeof(id));
+    nl_transact(sock, &req.n);
+  }
+
+  const NhObject *find_object(const std::vector<NhObject> &objects,
+                              uint32_t id) {
+    for (const auto &obj : objects)
+      if (obj.id == id)
+        return &obj;
+    return nullptr;
+  }
+
+  // Ids are hashes, so an id may already belong to an object another
+  // daemon (e.g. FRR) installed, or to a different gateway. Writing over
+  // it would silently re-point that object's routes. Returns why `obj`
+  // may not be replaced, or an empty string.
+  std::string id_conflict(const NhObject *obj) {
+    if (!obj)
+      return {};
+    if (obj->protocol != RTPROT_STATIC)
+      return "nexthop id " + std::to_string(obj->id) +
+             " belongs to another routing daemon";
+    return {};
+  }
+
+  // Group ids must stay below the gateway objects' range.
+  uint32_t checked_group_id(const NexthopGroupConfig &group) {
+    uint32_t id = group.id.value_or(NexthopGroupConfig::idFromName(group.name));
+    if (id >= kMemberIdBase)
+      throw std::runtime_error("nexthop-group " + group.name + ": id " +
+                               std::to_string(id) +
+                               " is reserved for nexthop members");
+    return id;
+  }
+
+  // Remove gateway objects that were part of `group_id` and are no longer
+  // referenced by any group (the kernel would otherwise keep them forever).
+  // Only objects this tool created are candidates.
+  void collect_stale_members(int sock, const std::vector<NhObject> &before,
+                             uint32_t group_id) {
+    std::set<uint32_t> candidates;
+    for (const auto &obj : before) {
+      if (obj.id != group_id)
+        continue;
+      for (const auto &g : obj.group) {
+        auto *member = find_object(before, g.id);
+        if (g.id >= kMemberIdBase && member &&
+            member->protocol == RTPROT_STATIC && member->group.empty())
+          candidates.insert(g.id);
+      }
+    }
+    if (candidates.empty())
+      return;
+
+    for (const auto &obj : dump_nexthops(sock))
+      for (const auto &g : obj.group)
+        candidates.erase(g.id);
+
+    for (uint32_t id : candidates)
+      delete_nexthop(sock, id);
+  }
+
+} // namespace
+
+std::vector<NexthopGroupConfig>
+SystemConfigurationManager::GetNexthopGroups() const {
+  std::vector<NexthopGroupConfig> groups;
+
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (sock < 0)
+    return groups;
+  auto objects = dump_nexthops(sock);
+  close(sock);
+
+  std::map<uint32_t, const NhObject *> byId;
+  InterfaceIndexCache ifindexes;
+  NexthopGroupNames names;
+  for (const auto &obj : objects)
+    byId[obj.id] = &obj;
+
+  for (const auto &obj : objects) {
+    if (obj.group.empty())
+      continue;
+    // The kernel does not keep names. Groups created here come back under
+    // the name recorded for them, others under their id, which
+    // NexthopGroupConfig::idFromName maps back verbatim.
+    NexthopGroupConfig ng;
+    ng.name = names.name(obj.id);
+    ng.id = obj.id;
+    for (const auto &g : obj.group) {
+      NexthopGroupMember m;
+      m.weight = static_cast<uint16_t>(g.weight) + 1;
+      auto it = byId.find(g.id);
+      if (it != byId.end()) {
+        m.gateway = it->second->gateway.value_or("");
+        auto oif = static_cast<unsigned>(it->second->oif);
+        if (auto *ifname = ifindexes.name(oif))
+          m.iface = *ifname;
+      }
+      ng.members.push_back(std::move(m));
+    }
+    groups.push_back(std::move(ng));
+  }
+  return groups;
+}
+
+void SystemConfigurationManager::SetNexthopGroup(
+    const NexthopGroupConfig &group) const {
+  if (group.members.empty())
+    throw std::runtime_error("nexthop-group " + group.name +
+                             ": at least one nexthop is required");
+
+  uint32_t groupId = checked_group_id(group);
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (sock < 0)
+    throw std::runtime_error("netlink socket: " +
+                             std::string(std::strerror(errno)));
+
+  auto before = dump_nexthops(sock);
+  const NhObject *current = find_object(before, groupId);
+  std::string conflict = id_conflict(current);
+  if (conflict.empty() && current && current->group.empty())
+    conflict = "nexthop id " + std::to_string(groupId) + " is not a group";
+  if (!conflict.empty()) {
+    close(sock);
+    throw std::runtime_error("nexthop-group " + group.name + ": " + conflict);
+  }
+
+  std::vector<struct nexthop_grp> entries;
+  for (const auto &m : group.members) {
+    unsigned char addr[sizeof(struct in6_addr)] = {};
+    int family = AF_INET;
+    int addrlen = sizeof(struct in_addr);
+    if (inet_pton(AF_INET, m.gateway.c_str(), addr) != 1) {
+      family = AF_INET6;
+      addrlen = sizeof(struct in6_addr);
+      if (inet_pton(AF_INET6, m.gateway.c_str(), addr) != 1) {
+        close(sock);
+        throw std::runtime_error("invalid nexthop address: " + m.gateway);
+      }
+    }
+
+    int oif = m.iface ? static_cast<int>(if_nametoindex(m.iface->c_str()))
+                      : resolve_oif(sock, family, addr, addrlen);
+    if (oif == 0) {
+      close(sock);
+      throw std::runtime_error("cannot resolve interface for nexthop " +
+                               m.gateway);
+    }
+
+    // Members are shared between groups: an object already holding this
+    // gateway is reused, one holding anything else is a hash collision.
+    uint32_t id = member_id(m.gateway, oif);
+    char canonical[INET6_ADDRSTRLEN] = {};
+    inet_ntop(family, addr, canonical, sizeof(canonical));
+    const NhObject *existing = find_object(before, id);
+    conflict = id_conflict(existing);
+    if (conflict.empty() && existing &&
+        (!existing->group.empty() || existing->gateway != canonical ||
+         existing->oif != oif))
+      conflict = "nexthop id " + std::to_string(id) +
+                 " is already used by a different nexthop";
+    if (!conflict.empty()) {
+      close(sock);
+      throw std::runtime_error("nexthop " + m.gateway + ": " + conflict);
+    }
+
+    if (!existing) {
+      struct nh_req req{};
+      req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct nhmsg));
+      req.n.nlmsg_type = RTM_NEWNEXTHOP;
+      req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_CREATE | NLM_F_EXCL;
+      req.nh.nh_family = family;
+      req.nh.nh_protocol = RTPROT_STATIC;
+      add_attr(&req.n, NHA_ID, &id, sizeof(id));
+      add_attr(&req.n, NHA_GATEWAY, addr, addrlen);
+      add_attr(&req.n, NHA_OIF, &oif, sizeof(oif));
+      if (int err = nl_transact(sock, &req.n); err < 0) {
+        close(sock);
+        throw std::runtime_error("nexthop " + m.gateway + ": " +
+                                 std::strerror(-err));
+      }
+    }
+
+    struct nexthop_grp entry{};
+    entry.id = id;
+    entry.weight = static_cast<uint8_t>(std::clamp<int>(m.weight, 1, 256) - 1);
+    entries.push_back(entry);
+  }
+
+  // Replacing the group object re-points every route using it at once.
+  struct nh_req req{};
+  req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct nhmsg));
+  req.n.nlmsg_type = RTM_NEWNEXTHOP;
+  req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_CREATE | NLM_F_REPLACE;
+  req.nh.nh_family = AF_UNSPEC;
+  req.nh.nh_protocol = RTPROT_STATIC;
+  add_attr(&req.n, NHA_ID, &groupId, sizeof(groupId));
+  add_attr(&req.n, NHA_GROUP, entries.data(),
+           static_cast<int>(entries.size() * sizeof(struct nexthop_grp)));
+  if (int err = nl_transact(sock, &req.n); err < 0) {
+    close(sock);
+    throw std::runtime_error("nexthop-group " + group.name + ": " +
+                             std::strerror(-err));
+  }
+
+  collect_stale_members(sock, before, groupId);
+  close(sock);
+  NexthopGroupNames().set(groupId, group.name);
+}
+
+void SystemConfigurationManager::DeleteNexthopGroup(
+    const NexthopGroupConfig &group) const {
+  uint32_t groupId = checked_group_id(group);
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (sock < 0)
+    throw std::runtime_error("netlink socket: " +
+                             std::string(std::strerror(errno)));
+
+  auto before = dump_nexthops(sock);
+  if (auto conflict = id_conflict(find_object(before, groupId));
+      !conflict.empty()) {
+    close(sock);
+    throw std::runtime_error("nexthop-group " + group.name + ": " + conflict);
+  }
+
+  struct nh_req req{};
+  req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct nhmsg));
+  req.n.nlmsg_type = RTM_DELNEXTHOP;
+  req.n.nlmsg_flags = NLM_F_REQUEST;
+  req.nh.nh_family = AF_UNSPEC;
+  add_attr(&req.n, NHA_ID, &groupId, sizeof(groupId));
+  if (int err = nl_transact(sock, &req.n); err < 0) {
+    close(sock);
+    throw std::runtime_error("nexthop-group " + group.name + ": " +
+                             std::strerror(-err));
+  }
+
+  collect_stale_members(sock, before, groupId);
+  close(sock);
+  NexthopGroupNames().erase(groupId);
+}
@@ -0,0 +1,697 @@
+/*
+ * Copyright (c) 2026, Ravenhammer Research Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file SystemPolicy.cpp
+ * @brief Linux policy access-lists compiled to nf_tables
+ *
+ * Each access-list becomes a regular chain `acl-<N>` in table
+ * `inet stelleri` (reach it with `jump acl-<N>` from a hook chain).
+ * Consecutive rules with the same action are folded into one nf_tables
+ * rule that looks up `meta l4proto . saddr . daddr` in an anonymous
+ * interval set, so a large ACL costs a handful of set lookups instead of
+ * one rule evaluation per entry. A run is split when a new entry would
+ * overlap one already in its set, which keeps first-match order intact.
+ *
+ * Every change rebuilds the whole chain inside one NFNL_MSG_BATCH, so the
+ * kernel swaps old and new rules atomically. The original rule text is
+ * kept as a comment on each set element, which is what GetPolicies reads
+ * back.
+ */
+
+#include "PolicyConfig.hpp"
+#include "SystemConfigurationManager.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+  constexpr const char *kTable = "stelleri";
+  constexpr const char *kAnonSet = "__set%d";
+  constexpr size_t kElemChunk = 32 * 1024; // bytes per NEWSETELEM message
+  constexpr uint8_t kUdataComment = 0;     // NFTNL_UDATA_SET_ELEM_COMMENT
+
+  std::string chain_name(uint32_t acl) { return "acl-" + std::to_string(acl); }
+
+  // ── Netlink message builder ──────────────────────────────────────────
+
+  class NlBuffer {
+  public:
+    NlBuffer() : seq_(static_cast<uint32_t>(time(nullptr))) {}
+
+    size_t begin(uint16_t type, uint16_t flags, uint8_t family,
+                 uint16_t res_id = 0) {
+      align();
+      size_t off = last_msg = buf_.size();
+      buf_.resize(off + NLMSG_HDRLEN + NLMSG_ALIGN(sizeof(nfgenmsg)));
+      auto *n = (struct nlmsghdr *)&buf_[off];
+      n->nlmsg_type = type;
+      n->nlmsg_flags = NLM_F_REQUEST | flags;
+      n->nlmsg_seq = last_seq = seq_++;
+      auto *g = (struct nfgenmsg *)NLMSG_DATA(n);
+      g->nfgen_family = family;
+      g->version = NFNETLINK_V0;
+      g->res_id = htons(res_id);
+      return off;
+    }
+
+    size_t begin_nft(uint8_t msg, uint16_t flags = 0) {
+      return begin((NFNL_SUBSYS_NFTABLES << 8) | msg, flags, NFPROTO_INET);
+    }
+
+    void end(size_t msg) {
+      ((struct nlmsghdr *)&buf_[msg])->nlmsg_len =
+          static_cast<uint32_t>(buf_.size() - msg);
+    }
+
+    void put(uint16_t type, const void *data, size_t len) {
+      size_t off = buf_.size();
+      buf_.resize(off + NLA_ALIGN(NLA_HDRLEN + len));
+      auto *a = (struct nlattr *)&buf_[off];
+      a->nla_type = type;
+      a->nla_len = static_cast<uint16_t>(NLA_HDRLEN + len);
+      if (len)
+        std::memcpy(&buf_[off + NLA_HDRLEN], data, len);
+    }
+    void put_str(uint16_t type, const std::string &s) {
+      put(type, s.c_str(), s.size() + 1);
+    }
+    void put_be32(uint16_t type, uint32_t v) {
+      v = htonl(v);
+      put(type, &v, sizeof(v));
+    }
+
+    size_t nest(uint16_t type) {
+      size_t off = buf_.size();
+      put(type | NLA_F_NESTED, nullptr, 0);
+      return off;
+    }
+    void end_nest(size_t off) {
+      ((struct nlattr *)&buf_[off])->nla_len =
+          static_cast<uint16_t>(buf_.size() - off);
+    }
+
+    size_t size() const { return buf_.size(); }
+    const char *data() const { return buf_.data(); }
+    char *data() { return buf_.data(); }
+    void clear() { buf_.clear(); }
+
+    uint32_t last_seq = 0;
+    size_t last_msg = 0;
+
+  private:
+    void align() { buf_.resize(NLMSG_ALIGN(buf_.size())); }
+
+    std::vector<char> buf_;
+    uint32_t seq_;
+  };
+
+  // ── Netlink transport ────────────────────────────────────────────────
+
+  int open_nfnetlink() {
+    int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_NETFILTER);
+    if (sock < 0)
+      throw std::runtime_error("netfilter socket: " +
+                               std::string(std::strerror(errno)));
+    return sock;
+  }
+
+  // Send a batch and wait for the ACK of its last message. Any error in
+  // the batch aborts the whole transaction in the kernel.
+  void commit_batch(const NlBuffer &b, uint32_t ack_seq) {
+    int sock = open_nfnetlink();
+    int sndbuf = static_cast<int>(b.size()) + 4096;
+    if (setsockopt(sock, SOL_SOCKET, SO_SNDBUFFORCE, &sndbuf,
+                   sizeof(sndbuf)) < 0)
+      setsockopt(sock, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+    if (send(sock, b.data(), b.size(), 0) < 0) {
+      int err = errno;
+      close(sock);
+      throw std::runtime_error("nftables batch: " +
+                               std::string(std::strerror(err)));
+    }
+
+    std::vector<char> buf(64 * 1024);
+    for (;;) {
+      ssize_t len = recv(sock, buf.data(), buf.size(), 0);
+      if (len < 0) {
+        int err = errno;
+        close(sock);
+        throw std::runtime_error("nftables batch: " +
+                                 std::string(std::strerror(err)));
+      }
+      auto *nh = (struct nlmsghdr *)buf.data();
+      for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+           nh = NLMSG_NEXT(nh, len)) {
+        if (nh->nlmsg_type != NLMSG_ERROR)
+          continue;
+        int err = ((struct nlmsgerr *)NLMSG_DATA(nh))->error;
+        if (err < 0) {
+          close(sock);
+          throw std::runtime_error("nftables batch: " +
+                                   std::string(std::strerror(-err)));
+        }
+        if (nh->nlmsg_seq == ack_seq) {
+          close(sock);
+          return;
+        }
+      }
+    }
+  }
+
+  // Run a dump request and hand each reply message to `fn`.
+  template <typename Fn>
+  void dump(int sock, const NlBuffer &req, Fn &&fn) {
+    if (send(sock, req.data(), req.size(), 0) < 0)
+      return;
+    std::vector<char> buf(128 * 1024);
+    for (;;) {
+      ssize_t len = recv(sock, buf.data(), buf.size(), 0);
+      if (len <= 0)
+        return;
+      auto *nh = (struct nlmsghdr *)buf.data();
+      for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+           nh = NLMSG_NEXT(nh, len)) {
+        if (nh->nlmsg_type == NLMSG_DONE || nh->nlmsg_type == NLMSG_ERROR)
+          return;
+        fn(nh);
+      }
+    }
+  }
+
+  // Iterate the attributes that follow the nfgenmsg header (or a nest).
+  template <typename Fn>
+  void for_each_attr(const void *start, int len, Fn &&fn) {
+    auto *a = (const struct nlattr *)start;
+    while (len >= static_cast<int>(NLA_HDRLEN) && a->nla_len >= NLA_HDRLEN &&
+           a->nla_len <= len) {
+      fn(a->nla_type & NLA_TYPE_MASK, (const char *)a + NLA_HDRLEN,
+         static_cast<int>(a->nla_len - NLA_HDRLEN));
+      int step = NLA_ALIGN(a->nla_len);
+      len -= step;
+      a = (const struct nlattr *)((const char *)a + step);
+    }
+  }
+
+  template <typename Fn> void for_each_nft_attr(struct nlmsghdr *nh, Fn &&fn) {
+    size_t hdr = NLMSG_ALIGN(sizeof(struct nfgenmsg));
+    for_each_attr((char *)NLMSG_DATA(nh) + hdr,
+                  static_cast<int>(nh->nlmsg_len - NLMSG_LENGTH(hdr)), fn);
+  }
+
+  // ── Rule compilation ─────────────────────────────────────────────────
+
+  struct Range {
+    std::array<uint8_t, 16> lo{};
+    std::array<uint8_t, 16> hi{};
+  };
+
+  struct Entry {
+    uint8_t proto_lo = 0;
+    uint8_t proto_hi = 255;
+    Range src;
+    Range dst;
+    std::string comment;
+  };
+
+  struct Run {
+    bool permit = false;
+    std::vector<Entry> entries;
+  };
+
+  bool is_any(const std::optional<std::string> &v) {
+    return !v || v->empty() || *v == "any";
+  }
+
+  // Address family a rule is restricted to: AF_INET, AF_INET6, or
+  // AF_UNSPEC when neither side names a prefix.
+  int rule_family(const PolicyAccessListRule &r) {
+    int fam = AF_UNSPEC;
+    for (const auto *side : {&r.source, &r.destination}) {
+      if (is_any(*side))
+        continue;
+      int f = (*side)->find(':') != std::string::npos ? AF_INET6 : AF_INET;
+      if (fam != AF_UNSPEC && fam != f)
+        throw std::runtime_error("rule " + std::to_string(r.seq) +
+                                 ": source and destination families differ");
+      fam = f;
+    }
+    return fam;
+  }
+
+  Range parse_prefix(const std::optional<std::string> &v, int family) {
+    size_t alen = family == AF_INET6 ? 16 : 4;
+    Range r;
+    if (is_any(v)) {
+      std::fill_n(r.hi.begin(), alen, 0xff);
+      return r;
+    }
+    std::string addr = *v;
+    int plen = static_cast<int>(alen * 8);
+    if (auto slash = addr.find('/'); slash != std::string::npos) {
+      try {
+        plen = std::stoi(addr.substr(slash + 1));
+      } catch (...) {
+        plen = -1;
+      }
+      addr.resize(slash);
+    }
+    if (plen < 0 || plen > static_cast<int>(alen * 8) ||
+        inet_pton(family, addr.c_str(), r.lo.data()) != 1)
+      throw std::runtime_error("invalid prefix: " + *v);
+    for (size_t i = 0; i < alen; ++i) {
+      int bits = std::clamp(plen - static_cast<int>(i * 8), 0, 8);
+      uint8_t mask = static_cast<uint8_t>(0xff00 >> bits);
+      r.lo[i] &= mask;
+      r.hi[i] = r.lo[i] | static_cast<uint8_t>(~mask);
+    }
+    return r;
+  }
+
+  std::pair<uint8_t, uint8_t>
+  parse_protocol(const std::optional<std::string> &p, int family) {
+    if (is_any(p) || *p == "ip" || *p == "ipv6")
+      return {0, 255};
+    static const std::map<std::string, uint8_t> names = {
+        {"icmp", 1}, {"igmp", 2},  {"tcp", 6},     {"udp", 17},
+        {"gre", 47}, {"esp", 50},  {"ah", 51},     {"icmpv6", 58},
+        {"ospf", 89}, {"pim", 103}, {"vrrp", 112}, {"sctp", 132}};
+    if (auto it = names.find(*p); it != names.end()) {
+      uint8_t n = it->second;
+      if (n == 1 && family == AF_INET6)
+        n = 58;
+      return {n, n};
+    }
+    try {
+      int n = std::stoi(*p);
+      if (n >= 0 && n <= 255)
+        return {static_cast<uint8_t>(n), static_cast<uint8_t>(n)};
+    } catch (...) {
+    }
+    throw std::runtime_error("unknown protocol: " + *p);
+  }
+
+  bool intersects(const Range &a, const Range &b) {
+    return !(a.hi < b.lo || b.hi < a.lo);
+  }
+
+  bool overlaps(const Entry &a, const Entry &b) {
+    return a.proto_lo <= b.proto_hi && b.proto_lo <= a.proto_hi &&
+           intersects(a.src, b.src) && intersects(a.dst, b.dst);
+  }
+
+  std::string rule_comment(uint32_t acl, const PolicyAccessListRule &r) {
+    auto field = [](const std::optional<std::string> &v) {
+      return v && !v->empty() ? *v : std::string("-");
+    };
+    return std::to_string(acl) + " " + std::to_string(r.seq) + " " +
+           r.action + " " + field(r.protocol) + " " + field(r.source) + " " +
+           field(r.destination);
+  }
+
+  std::vector<Run> compile(const PolicyAccessList &acl, int family) {
+    std::vector<Run> runs;
+    for (const auto &rule : acl.rules) {
+      int fam = rule_family(rule);
+      if (fam != AF_UNSPEC && fam != family)
+        continue;
+
+      Entry e;
+      std::tie(e.proto_lo, e.proto_hi) = parse_protocol(rule.protocol, family);
+      e.src = parse_prefix(rule.source, family);
+      e.dst = parse_prefix(rule.destination, family);
+      e.comment = rule_comment(acl.id, rule);
+      bool permit = rule.action != "deny";
+
+      bool split = runs.empty() || runs.back().permit != permit ||
+                   std::any_of(runs.back().entries.begin(),
+                               runs.back().entries.end(),
+                               [&](const Entry &o) { return overlaps(o, e); });
+      if (split)
+        runs.push_back(Run{permit, {}});
+      runs.back().entries.push_back(std::move(e));
+    }
+    return runs;
+  }
+
+  // ── nf_tables expressions ────────────────────────────────────────────
+
+  void expr_begin(NlBuffer &b, const char *name, size_t &elem,
+                  size_t &data) {
+    elem = b.nest(NFTA_LIST_ELEM);
+    b.put_str(NFTA_EXPR_NAME, name);
+    data = b.nest(NFTA_EXPR_DATA);
+  }
+
+  void expr_end(NlBuffer &b, size_t elem, size_t data) {
+    b.end_nest(data);
+    b.end_nest(elem);
+  }
+
+  void expr_meta(NlBuffer &b, uint32_t key, uint32_t dreg) {
+    size_t elem, data;
+    expr_begin(b, "meta", elem, data);
+    b.put_be32(NFTA_META_KEY, key);
+    b.put_be32(NFTA_META_DREG, dreg);
+    expr_end(b, elem, data);
+  }
+
+  void expr_cmp_u8(NlBuffer &b, uint32_t sreg, uint8_t value) {
+    size_t elem, data;
+    expr_begin(b, "cmp", elem, data);
+    b.put_be32(NFTA_CMP_SREG, sreg);
+    b.put_be32(NFTA_CMP_OP, NFT_CMP_EQ);
+    size_t d = b.nest(NFTA_CMP_DATA);
+    b.put(NFTA_DATA_VALUE, &value, sizeof(value));
+    b.end_nest(d);
+    expr_end(b, elem, data);
+  }
+
+  void expr_payload(NlBuffer &b, uint32_t dreg, uint32_t offset,
+                    uint32_t len) {
+    size_t elem, data;
+    expr_begin(b, "payload", elem, data);
+    b.put_be32(NFTA_PAYLOAD_DREG, dreg);
+    b.put_be32(NFTA_PAYLOAD_BASE, NFT_PAYLOAD_NETWORK_HEADER);
+    b.put_be32(NFTA_PAYLOAD_OFFSET, offset);
+    b.put_be32(NFTA_PAYLOAD_LEN, len);
+    expr_end(b, elem, data);
+  }
+
+  void expr_lookup(NlBuffer &b, uint32_t sreg, uint32_t set_id) {
+    size_t elem, data;
+    expr_begin(b, "lookup", elem, data);
+    b.put_str(NFTA_LOOKUP_SET, kAnonSet);
+    b.put_be32(NFTA_LOOKUP_SET_ID, set_id);
+    b.put_be32(NFTA_LOOKUP_SREG, sreg);
+    expr_end(b, elem, data);
+  }
+
+  void expr_verdict(NlBuffer &b, int verdict) {
+    size_t elem, data;
+    expr_begin(b, "immediate", elem, data);
+    b.put_be32(NFTA_IMMEDIATE_DREG, NFT_REG_VERDICT);
+    size_t d = b.nest(NFTA_IMMEDIATE_DATA);
+    size_t v = b.nest(NFTA_DATA_VERDICT);
+    b.put_be32(NFTA_VERDICT_CODE, static_cast<uint32_t>(verdict));
+    b.end_nest(v);
+    b.end_nest(d);
+    expr_end(b, elem, data);
+  }
+
+  // ── Batch assembly ───────────────────────────────────────────────────
+
+  // Key layout: l4proto (1 byte, padded to a register) . saddr . daddr
+  void put_key(NlBuffer &b, uint16_t type, const Entry &e, bool end,
+               size_t alen) {
+    std::array<uint8_t, 36> key{};
+    key[0] = end ? e.proto_hi : e.proto_lo;
+    const auto &s = end ? e.src.hi : e.src.lo;
+    const auto &d = end ? e.dst.hi : e.dst.lo;
+    std::copy_n(s.begin(), alen, key.begin() + 4);
+    std::copy_n(d.begin(), alen, key.begin() + 4 + alen);
+    size_t k = b.nest(type);
+    b.put(NFTA_DATA_VALUE, key.data(), 4 + 2 * alen);
+    b.end_nest(k);
+  }
+
+  void put_elements(NlBuffer &b, uint32_t set_id, const Run &run,
+                    size_t alen) {
+    size_t i = 0;
+    while (i < run.entries.size()) {
+      size_t msg = b.begin_nft(NFT_MSG_NEWSETELEM, NLM_F_CREATE);
+      b.put_str(NFTA_SET_ELEM_LIST_TABLE, kTable);
+      b.put_str(NFTA_SET_ELEM_LIST_SET, kAnonSet);
+      b.put_be32(NFTA_SET_ELEM_LIST_SET_ID, set_id);
+      size_t list = b.nest(NFTA_SET_ELEM_LIST_ELEMENTS);
+      size_t start = b.size();
+      for (; i < run.entries.size() && b.size() - start < kElemChunk; ++i) {
+        const auto &e = run.entries[i];
+        size_t el = b.nest(NFTA_LIST_ELEM);
+        put_key(b, NFTA_SET_ELEM_KEY, e, false, alen);
+        put_key(b, NFTA_SET_ELEM_KEY_END, e, true, alen);
+        std::string udata;
+        udata += static_cast<char>(kUdataComment);
+        udata += static_cast<char>(e.comment.size() + 1);
+        udata += e.comment;
+        udata += '\0';
+        b.put(NFTA_SET_ELEM_USERDATA, udata.data(), udata.size());
+        b.end_nest(el);
+      }
+      b.end_nest(list);
+      b.end(msg);
+    }
+  }
+
+  void put_run(NlBuffer &b, const std::string &chain, uint32_t set_id,
+               const Run &run, int family) {
+    size_t alen = family == AF_INET6 ? 16 : 4;
+    uint32_t klen = static_cast<uint32_t>(4 + 2 * alen);
+
+    size_t msg = b.begin_nft(NFT_MSG_NEWSET, NLM_F_CREATE);
+    b.put_str(NFTA_SET_TABLE, kTable);
+    b.put_str(NFTA_SET_NAME, kAnonSet);
+    b.put_be32(NFTA_SET_FLAGS, NFT_SET_ANONYMOUS | NFT_SET_CONSTANT |
+                                   NFT_SET_INTERVAL | NFT_SET_CONCAT);
+    b.put_be32(NFTA_SET_KEY_TYPE, 0);
+    b.put_be32(NFTA_SET_KEY_LEN, klen);
+    b.put_be32(NFTA_SET_ID, set_id);
+    size_t desc = b.nest(NFTA_SET_DESC);
+    size_t concat = b.nest(NFTA_SET_DESC_CONCAT);
+    for (uint32_t len : {uint32_t{1}, static_cast<uint32_t>(alen),
+                         static_cast<uint32_t>(alen)}) {
+      size_t f = b.nest(NFTA_LIST_ELEM);
+      b.put_be32(NFTA_SET_FIELD_LEN, len);
+      b.end_nest(f);
+    }
+    b.end_nest(concat);
+    b.end_nest(desc);
+    b.end(msg);
+
+    put_elements(b, set_id, run, alen);
+
+    msg = b.begin_nft(NFT_MSG_NEWRULE, NLM_F_CREATE | NLM_F_APPEND);
+    b.put_str(NFTA_RULE_TABLE, kTable);
+    b.put_str(NFTA_RULE_CHAIN, chain);
+    size_t exprs = b.nest(NFTA_RULE_EXPRESSIONS);
+    expr_meta(b, NFT_META_NFPROTO, NFT_REG_1);
+    expr_cmp_u8(b, NFT_REG_1,
+                family == AF_INET6 ? NFPROTO_IPV6 : NFPROTO_IPV4);
+    expr_meta(b, NFT_META_L4PROTO, NFT_REG32_00);
+    uint32_t regs = static_cast<uint32_t>(alen / 4);
+    expr_payload(b, NFT_REG32_01, family == AF_INET6 ? 8 : 12,
+                 static_cast<uint32_t>(alen));
+    expr_payload(b, NFT_REG32_01 + regs, family == AF_INET6 ? 24 : 16,
+                 static_cast<uint32_t>(alen));
+    expr_lookup(b, NFT_REG32_00, set_id);
+    expr_verdict(b, run.permit ? NF_ACCEPT : NF_DROP);
+    b.end_nest(exprs);
+    b.end(msg);
+  }
+
+  // Replace the contents of an ACL chain (or remove it) in one batch.
+  void replace_acl(const PolicyAccessList &acl, bool remove) {
+    NlBuffer b;
+    std::string chain = chain_name(acl.id);
+
+    size_t msg = b.begin(NFNL_MSG_BATCH_BEGIN, 0, AF_UNSPEC,
+                         NFNL_SUBSYS_NFTABLES);
+    b.end(msg);
+
+    msg = b.begin_nft(NFT_MSG_NEWTABLE, NLM_F_CREATE);
+    b.put_str(NFTA_TABLE_NAME, kTable);
+    b.end(msg);
+
+    msg = b.begin_nft(NFT_MSG_NEWCHAIN, NLM_F_CREATE);
+    b.put_str(NFTA_CHAIN_TABLE, kTable);
+    b.put_str(NFTA_CHAIN_NAME, chain);
+    b.end(msg);
+
+    msg = b.begin_nft(NFT_MSG_DELRULE);
+    b.put_str(NFTA_RULE_TABLE, kTable);
+    b.put_str(NFTA_RULE_CHAIN, chain);
+    b.end(msg);
+
+    if (remove) {
+      msg = b.begin_nft(NFT_MSG_DELCHAIN);
+      b.put_str(NFTA_CHAIN_TABLE, kTable);
+      b.put_str(NFTA_CHAIN_NAME, chain);
+      b.end(msg);
+    } else {
+      uint32_t set_id = 1;
+      for (int family : {AF_INET, AF_INET6})
+        for (const auto &run : compile(acl, family))
+          put_run(b, chain, set_id++, run, family);
+    }
+
+    // Only the last real message asks for an ACK; errors on any message
+    // are reported regardless.
+    auto *last = (struct nlmsghdr *)(b.data() + b.last_msg);
+    last->nlmsg_flags |= NLM_F_ACK;
+    uint32_t ack_seq = b.last_seq;
+
+    msg = b.begin(NFNL_MSG_BATCH_END, 0, AF_UNSPEC, NFNL_SUBSYS_NFTABLES);
+    b.end(msg);
+
+    commit_batch(b, ack_seq);
+  }
+
+  std::optional<std::pair<uint32_t, PolicyAccessListRule>>
+  parse_comment(const std::string &text) {
+    std::istringstream iss(text);
+    uint32_t acl = 0;
+    PolicyAccessListRule r;
+    std::string proto, src, dst;
+    if (!(iss >> acl >> r.seq >> r.action >> proto >> src >> dst))
+      return std::nullopt;
+    if (proto != "-")
+      r.protocol = proto;
+    if (src != "-")
+      r.source = src;
+    if (dst != "-")
+      r.destination = dst;
+    return std::make_pair(acl, r);
+  }
+
+} // namespace
+
+std::vector<PolicyConfig> SystemConfigurationManager::GetPolicies(
+    const std::optional<uint32_t> &acl_filter) const {
+  int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_NETFILTER);
+  if (sock < 0)
+    return {};
+
+  // Collect the (anonymous) sets of our table, then read their elements.
+  std::vector<std::string> sets;
+  NlBuffer req;
+  size_t msg = req.begin_nft(NFT_MSG_GETSET, NLM_F_DUMP);
+  req.put_str(NFTA_SET_TABLE, kTable);
+  req.end(msg);
+  dump(sock, req, [&](struct nlmsghdr *nh) {
+    for_each_nft_attr(nh, [&](int type, const char *data, int) {
+      if (type == NFTA_SET_NAME)
+        sets.emplace_back(data);
+    });
+  });
+
+  std::map<uint32_t, std::map<uint32_t, PolicyAccessListRule>> acls;
+  for (const auto &set : sets) {
+    req.clear();
+    msg = req.begin_nft(NFT_MSG_GETSETELEM, NLM_F_DUMP);
+    req.put_str(NFTA_SET_ELEM_LIST_TABLE, kTable);
+    req.put_str(NFTA_SET_ELEM_LIST_SET, set);
+    req.end(msg);
+    dump(sock, req, [&](struct nlmsghdr *nh) {
+      for_each_nft_attr(nh, [&](int type, const char *data, int len) {
+        if (type != NFTA_SET_ELEM_LIST_ELEMENTS)
+          return;
+        for_each_attr(data, len, [&](int, const char *el, int ellen) {
+          for_each_attr(el, ellen, [&](int t, const char *ud, int udlen) {
+            if (t != NFTA_SET_ELEM_USERDATA)
+              return;
+            // TLV list: type (1 byte), length (1 byte), value
+            for (int i = 0; i + 2 <= udlen;) {
+              int vlen = static_cast<uint8_t>(ud[i + 1]);
+              if (ud[i] == kUdataComment && i + 2 + vlen <= udlen) {
+                auto parsed = parse_comment(std::string(ud + i + 2));
+                if (parsed && (!acl_filter || *acl_filter == parsed->first))
+                  acls[parsed->first][parsed->second.seq] = parsed->second;
+              }
+              i += 2 + vlen;
+            }
+          });
+        });
+      });
+    });
+  }
+  close(sock);
+
+  std::vector<PolicyConfig> out;
+  for (auto &[id, rules] : acls) {
+    PolicyConfig pc;
+    pc.policy_type = PolicyConfig::Type::AccessList;
+    pc.access_list.id = id;
+    for (auto &[seq, rule] : rules)
+      pc.access_list.rules.push_back(std::move(rule));
+    out.push_back(std::move(pc));
+  }
+  return out;
+}
+
+void SystemConfigurationManager::SetPolicy(const PolicyConfig &pc) const {
+  if (pc.policy_type != PolicyConfig::Type::AccessList)
+    return;
+
+  // Merge the given rules into the installed list by sequence number.
+  std::map<uint32_t, PolicyAccessListRule> rules;
+  auto existing = GetPolicies(pc.access_list.id);
+  if (!existing.empty())
+    for (const auto &r : existing.front().access_list.rules)
+      rules[r.seq] = r;
+  for (const auto &r : pc.access_list.rules)
+    rules[r.seq] = r;
+
+  PolicyAccessList acl;
+  acl.id = pc.access_list.id;
+  for (auto &[seq, rule] : rules)
+    acl.rules.push_back(std::move(rule));
+  replace_acl(acl, false);
+}
+
+void SystemConfigurationManager::DeletePolicy(const PolicyConfig &pc) const {
+  if (pc.policy_type != PolicyConfig::Type::AccessList)
+    return;
+
+  PolicyAccessList acl;
+  acl.id = pc.access_list.id;
+  if (!pc.access_list.rules.empty()) {
+    auto existing = GetPolicies(pc.access_list.id);
+    if (!existing.empty())
+      for (const auto &r : existing.front().access_list.rules)
+        if (std::none_of(pc.access_list.rules.begin(),
+                         pc.access_list.rules.end(),
+                         [&](const auto &d) { return d.seq == r.seq; }))
+          acl.rules.push_back(r);
+  }
+  replace_acl(acl, acl.rules.empty());
+}
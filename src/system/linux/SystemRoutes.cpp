@@ -25,29 +25,67 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "IPAddress.hpp"
-#include "IPNetwork.hpp"
+#include "IPPrefix.hpp"
+#include "InterfaceNames.hpp"
+#include "NexthopGroupConfig.hpp"
+#include "NexthopGroupNames.hpp"
 #include "RouteConfig.hpp"
+#include "RouteTable.hpp"
+#include "Socket.hpp"
 #include "SystemConfigurationManager.hpp"
+#include <algorithm>
+#include <array>
 #include <arpa/inet.h>
+#include <charconv>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
+#include <map>
+#include <optional>
+// <net/if.h> must precede the linux/ headers so they skip struct ifreq.
+#include <net/if.h>
+#include <linux/netlink.h>
 #include <linux/route.h>
-#include <sstream>
+#include <linux/rtnetlink.h>
+#include <string_view>
+#include <stdexcept>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
 namespace {
-  std::string hexToIp(const std::string &hex) {
-    uint32_t ip;
-    std::stringstream ss;
-    ss << std::hex << hex;
-    ss >> ip;
-    struct in_addr addr;
-    addr.s_addr = ip;
-    return inet_ntoa(addr);
+  uint32_t hexValue(std::string_view hex) {
+    uint32_t v = 0;
+    std::from_chars(hex.data(), hex.data() + hex.size(), v, 16);
+    return v;
+  }
+
+  // /proc/net/route prints s_addr (network byte order) as a native hex word.
+  uint32_t hexToAddr(std::string_view hex) { return ntohl(hexValue(hex)); }
+
+  // /proc/net/ipv6_route prints addresses as 32 hex digits.
+  void hexToBytes(std::string_view hex, uint8_t (&out)[16]) {
+    for (size_t i = 0; i < 16 && 2 * i + 2 <= hex.size(); ++i)
+      out[i] = static_cast<uint8_t>(hexValue(hex.substr(2 * i, 2)));
+  }
+
+  // Split a /proc table row into its whitespace-separated columns without
+  // copying; these files run to one row per route.
+  template <size_t N>
+  size_t splitFields(std::string_view line,
+                     std::array<std::string_view, N> &out) {
+    size_t n = 0, i = 0;
+    while (n < N) {
+      while (i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+        ++i;
+      if (i == line.size())
+        break;
+      size_t start = i;
+      while (i < line.size() && line[i] != ' ' && line[i] != '\t')
+        ++i;
+      out[n++] = line.substr(start, i - start);
+    }
+    return n;
   }
 
   int countSetBits(uint32_t n) {
@@ -58,12 +96,236 @@ namespace {
     }
     return count;
   }
+
+  struct rt_req {
+    struct nlmsghdr n;
+    struct rtmsg r;
+    char buf[256];
+  };
+
+  void add_attr(struct nlmsghdr *n, int type, const void *data, int len) {
+    int nlalen = NLMSG_ALIGN(n->nlmsg_len);
+    struct rtattr *rta = (struct rtattr *)(((char *)n) + nlalen);
+    rta->rta_type = type;
+    rta->rta_len = RTA_LENGTH(len);
+    std::memcpy(RTA_DATA(rta), data, len);
+    n->nlmsg_len = nlalen + RTA_ALIGN(rta->rta_len);
+  }
+
+  // rtm_protocol of the routes /proc lists, by (prefix, gateway).
+  using RouteProtocols =
+      std::map<std::pair<IPPrefix, std::optional<IPPrefix>>, int>;
+
+  // /proc only lists the main table, shows group routes without their
+  // group, and does not say who installed a route. Those come from a
+  // netlink dump instead: routes that reference a nexthop object, the
+  // routes of VRF tables (other than the ones the kernel adds for local
+  // addresses), and the protocol of every other route into `protocols`.
+  std::vector<RouteConfig> dump_netlink_routes(RouteProtocols &protocols) {
+    std::vector<RouteConfig> out;
+    InterfaceIndexCache ifindexes;
+    NexthopGroupNames names;
+    int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+    if (sock < 0)
+      return out;
+
+    struct {
+      struct nlmsghdr n;
+      struct rtmsg r;
+    } req{};
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+    req.n.nlmsg_type = RTM_GETROUTE;
+    req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.r.rtm_family = AF_UNSPEC;
+    if (send(sock, &req, req.n.nlmsg_len, 0) < 0) {
+      close(sock);
+      return out;
+    }
+
+    char buf[16384];
+    bool done = false;
+    while (!done) {
+      ssize_t len = recv(sock, buf, sizeof(buf), 0);
+      if (len <= 0)
+        break;
+      struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+      for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+           nh = NLMSG_NEXT(nh, len)) {
+        if (nh->nlmsg_type == NLMSG_DONE || nh->nlmsg_type == NLMSG_ERROR) {
+          done = true;
+          break;
+        }
+        if (nh->nlmsg_type != RTM_NEWROUTE)
+          continue;
+
+        auto *rtm = (struct rtmsg *)NLMSG_DATA(nh);
+        std::optional<uint32_t> nhid;
+        uint32_t table = rtm->rtm_table;
+        unsigned char dst[sizeof(struct in6_addr)] = {};
+        unsigned char gw[sizeof(struct in6_addr)] = {};
+        bool hasGateway = false;
+        int oif = 0;
+        struct rtattr *rta = RTM_RTA(rtm);
+        int rta_len = static_cast<int>(RTM_PAYLOAD(nh));
+        for (; RTA_OK(rta, rta_len); rta = RTA_NEXT(rta, rta_len)) {
+          if (rta->rta_type == RTA_NH_ID)
+            nhid = *(uint32_t *)RTA_DATA(rta);
+          else if (rta->rta_type == RTA_TABLE)
+            table = *(uint32_t *)RTA_DATA(rta);
+          else if (rta->rta_type == RTA_DST)
+            std::memcpy(dst, RTA_DATA(rta),
+                        std::min<size_t>(RTA_PAYLOAD(rta), sizeof(dst)));
+          else if (rta->rta_type == RTA_OIF)
+            oif = *(int *)RTA_DATA(rta);
+          else if (rta->rta_type == RTA_GATEWAY) {
+            std::memcpy(gw, RTA_DATA(rta),
+                        std::min<size_t>(RTA_PAYLOAD(rta), sizeof(gw)));
+            hasGateway = true;
+          }
+        }
+        RouteConfig rc;
+        if (rtm->rtm_family == AF_INET6) {
+          rc.prefix = IPPrefix::v6Bytes(dst, rtm->rtm_dst_len);
+          if (hasGateway)
+            rc.nexthop = IPPrefix::v6Bytes(gw);
+        } else {
+          uint32_t v4;
+          std::memcpy(&v4, dst, sizeof(v4));
+          rc.prefix = IPPrefix::v4(ntohl(v4), rtm->rtm_dst_len);
+          if (hasGateway) {
+            std::memcpy(&v4, gw, sizeof(v4));
+            rc.nexthop = IPPrefix::v4(ntohl(v4));
+          }
+        }
+        rc.protocol = rtm->rtm_protocol;
+
+        bool vrfTable = table != RT_TABLE_MAIN && table != RT_TABLE_LOCAL &&
+                        table != RT_TABLE_DEFAULT && table != RT_TABLE_UNSPEC;
+        if (!nhid && !vrfTable) {
+          // ipv6_route also lists the local table; the main table's
+          // entry wins for a prefix both hold.
+          auto key = std::make_pair(rc.prefix, rc.nexthop);
+          if (table == RT_TABLE_MAIN)
+            protocols[key] = rtm->rtm_protocol;
+          else
+            protocols.emplace(key, rtm->rtm_protocol);
+        }
+        if (!nhid && (!vrfTable || rtm->rtm_protocol == RTPROT_KERNEL))
+          continue;
+        if (rtm->rtm_type != RTN_UNICAST && rtm->rtm_type != RTN_BLACKHOLE &&
+            rtm->rtm_type != RTN_UNREACHABLE && rtm->rtm_type != RTN_PROHIBIT)
+          continue;
+
+        rc.flags = RouteConfig::Flag(RouteConfig::UP) |
+                   RouteConfig::Flag(RouteConfig::STATIC);
+        if (nhid) {
+          rc.nexthop.reset();
+          rc.nexthop_group = names.name(*nhid);
+          rc.flags |= RouteConfig::Flag(RouteConfig::GATEWAY);
+        } else if (hasGateway) {
+          rc.flags |= RouteConfig::Flag(RouteConfig::GATEWAY);
+        }
+        rc.blackhole = rtm->rtm_type == RTN_BLACKHOLE;
+        rc.reject = rtm->rtm_type == RTN_UNREACHABLE ||
+                    rtm->rtm_type == RTN_PROHIBIT;
+        if (auto *ifname = ifindexes.name(static_cast<unsigned>(oif)))
+          rc.iface = *ifname;
+        if (table != RT_TABLE_MAIN)
+          rc.vrf = static_cast<int>(table);
+        out.push_back(std::move(rc));
+      }
+    }
+    close(sock);
+    return out;
+  }
+
+  // SIOCADDRT/SIOCDELRT only reach the main table and cannot reference a
+  // nexthop object; those routes go through netlink.
+  bool needs_netlink(const RouteConfig &route) {
+    return route.nexthop_group || route.vrf.value_or(0) != 0;
+  }
+
+  // Program a route with an explicit table (RTA_TABLE), referencing a
+  // nexthop group (RTA_NH_ID) or a gateway and interface.
+  void netlink_route_op(const RouteConfig &route, int type, int flags) {
+    const IPPrefix &net = route.prefix;
+    if (net.empty())
+      throw std::runtime_error("route has no destination prefix");
+
+    int family = net.af();
+    int addrlen = family == AF_INET6 ? sizeof(struct in6_addr)
+                                     : sizeof(struct in_addr);
+
+    struct rt_req req{};
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+    req.n.nlmsg_type = type;
+    req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | flags;
+    req.r.rtm_family = family;
+    req.r.rtm_dst_len = net.length();
+    req.r.rtm_table = RT_TABLE_UNSPEC;
+    req.r.rtm_protocol = RTPROT_STATIC;
+    req.r.rtm_scope = RT_SCOPE_UNIVERSE;
+    req.r.rtm_type = RTN_UNICAST;
+    if (route.blackhole)
+      req.r.rtm_type = RTN_BLACKHOLE;
+    else if (route.reject)
+      req.r.rtm_type = RTN_UNREACHABLE;
+
+    add_attr(&req.n, RTA_DST, net.bytes().data(), addrlen);
+    uint32_t table = route.vrf ? static_cast<uint32_t>(*route.vrf)
+                               : static_cast<uint32_t>(RT_TABLE_MAIN);
+    add_attr(&req.n, RTA_TABLE, &table, sizeof(table));
+    if (route.nexthop_group) {
+      uint32_t nhid = NexthopGroupConfig::idFromName(*route.nexthop_group);
+      add_attr(&req.n, RTA_NH_ID, &nhid, sizeof(nhid));
+    } else if (type == RTM_DELROUTE) {
+      // Delete whatever route the table holds for the prefix, as
+      // SIOCDELRT does for the main table.
+      req.r.rtm_protocol = 0;
+      req.r.rtm_scope = RT_SCOPE_NOWHERE;
+      req.r.rtm_type = 0;
+    } else {
+      if (route.nexthop)
+        add_attr(&req.n, RTA_GATEWAY, route.nexthop->bytes().data(),
+                 addrlen);
+      else if (req.r.rtm_type == RTN_UNICAST)
+        req.r.rtm_scope = RT_SCOPE_LINK;
+      if (route.iface) {
+        int oif = static_cast<int>(if_nametoindex(route.iface->c_str()));
+        if (oif == 0)
+          throw std::runtime_error("route " + net.toString() +
+                                   ": unknown interface " + *route.iface);
+        add_attr(&req.n, RTA_OIF, &oif, sizeof(oif));
+      }
+    }
+
+    int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+    if (sock < 0)
+      throw std::runtime_error("netlink socket: " +
+                               std::string(std::strerror(errno)));
+    int err = 0;
+    if (send(sock, &req, req.n.nlmsg_len, 0) < 0) {
+      err = -errno;
+    } else {
+      char buf[4096];
+      ssize_t len = recv(sock, buf, sizeof(buf), 0);
+      struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+      if (len > 0 && NLMSG_OK(nh, static_cast<uint32_t>(len)) &&
+          nh->nlmsg_type == NLMSG_ERROR)
+        err = ((struct nlmsgerr *)NLMSG_DATA(nh))->error;
+    }
+    close(sock);
+    if (err < 0)
+      throw std::runtime_error("route " + net.toString() + ": " +
+                               std::strerror(-err));
+  }
 } // namespace
 
-std::vector<RouteConfig>
-SystemConfigurationManager::GetStaticRoutes(const std::optional<VRFConfig> &vrf
-                                            [[maybe_unused]]) const {
-  std::vector<RouteConfig> routes;
+RouteTable SystemConfigurationManager::GetRouteTable(
+    const std::optional<VRFConfig> &vrf) const {
+  // Rows go straight into the table's columns; no RouteConfig (and no
+  // interface-name string) is built per route.
+  RouteTable routes;
 
   // IPv4 - Listing routes via ioctl is not standard on Linux, using
   // /proc/net/route for enumeration.
@@ -71,32 +333,23 @@ SystemConfigurationManager::GetStaticRoutes(const std::optional<VRFConfig> &vrf
   if (ipv4_route.is_open()) {
     std::string line;
     std::getline(ipv4_route, line); // Skip header
+    // Iface Destination Gateway Flags RefCnt Use Metric Mask MTU ...
+    std::array<std::string_view, 9> f;
     while (std::getline(ipv4_route, line)) {
-      std::stringstream ss(line);
-      std::string iface, dest, gateway, flags, refcnt, use, metric, mask, mtu,
-          window, irtt;
-      ss >> iface >> dest >> gateway >> flags >> refcnt >> use >> metric >>
-          mask >> mtu >> window >> irtt;
-
-      RouteConfig rc;
-      rc.iface = iface;
-
-      std::string dest_ip = hexToIp(dest);
-      uint32_t mask_val = 0;
-      std::stringstream mss;
-      mss << std::hex << mask;
-      mss >> mask_val;
-      int prefix = countSetBits(mask_val);
-      rc.prefix = dest_ip + "/" + std::to_string(prefix);
-
-      if (gateway != "00000000") {
-        rc.nexthop = hexToIp(gateway);
-      }
+      if (splitFields(line, f) < f.size())
+        continue;
+
+      int prefix = countSetBits(hexToAddr(f[7]));
+      size_t row = routes.append(IPPrefix::v4(hexToAddr(f[1]), prefix));
+      routes.setInterface(row, f[0]);
 
-      rc.flags = std::stoul(flags, nullptr, 16);
-      rc.rmx_mtu = std::stoi(mtu);
+      if (f[2] != "00000000")
+        routes.setNexthop(row, IPPrefix::v4(hexToAddr(f[2])));
 
-      routes.push_back(rc);
+      routes.setFlags(row, hexValue(f[3]));
+      uint32_t mtu = 0;
+      std::from_chars(f[8].data(), f[8].data() + f[8].size(), mtu);
+      routes.setMtu(row, mtu);
     }
   }
 
@@ -104,42 +357,58 @@ SystemConfigurationManager::GetStaticRoutes(const std::optional<VRFConfig> &vrf
   std::ifstream ipv6_route("/proc/net/ipv6_route");
   if (ipv6_route.is_open()) {
     std::string line;
+    // dest dest_len src src_len nexthop metric refcnt use flags iface
+    std::array<std::string_view, 10> f;
     while (std::getline(ipv6_route, line)) {
-      std::stringstream ss(line);
-      std::string dest, dest_len, src, src_len, nexthop, metric, refcnt, use,
-          flags, iface;
-      ss >> dest >> dest_len >> src >> src_len >> nexthop >> metric >> refcnt >>
-          use >> flags >> iface;
-
-      RouteConfig rc;
-      rc.iface = iface;
-
-      // Parse IPv6 address from hex
-      struct in6_addr addr;
-      for (int i = 0; i < 16; ++i) {
-        std::string byte = dest.substr(i * 2, 2);
-        addr.s6_addr[i] = static_cast<uint8_t>(std::stoul(byte, nullptr, 16));
-      }
-      char buf[INET6_ADDRSTRLEN];
-      inet_ntop(AF_INET6, &addr, buf, sizeof(buf));
-      rc.prefix = std::string(buf) + "/" +
-                  std::to_string(std::stoul(dest_len, nullptr, 16));
-
-      if (nexthop != "00000000000000000000000000000000") {
-        for (int i = 0; i < 16; ++i) {
-          std::string byte = nexthop.substr(i * 2, 2);
-          addr.s6_addr[i] = static_cast<uint8_t>(std::stoul(byte, nullptr, 16));
-        }
-        inet_ntop(AF_INET6, &addr, buf, sizeof(buf));
-        rc.nexthop = buf;
+      if (splitFields(line, f) < f.size())
+        continue;
+
+      uint8_t addr[16] = {};
+      hexToBytes(f[0], addr);
+      size_t row = routes.append(
+          IPPrefix::v6Bytes(addr, static_cast<uint8_t>(hexValue(f[1]))));
+      routes.setInterface(row, f[9]);
+
+      if (f[4] != "00000000000000000000000000000000") {
+        hexToBytes(f[4], addr);
+        routes.setNexthop(row, IPPrefix::v6Bytes(addr));
       }
 
-      rc.flags = std::stoul(flags, nullptr, 16);
-      routes.push_back(rc);
+      routes.setFlags(row, hexValue(f[8]));
     }
   }
 
-  return routes;
+  // Group routes replace the /proc row for the same main-table prefix;
+  // VRF routes are added after the main table.
+  size_t procRows = routes.size();
+  RouteProtocols protocols;
+  auto netlinkRoutes = dump_netlink_routes(protocols);
+  for (size_t row = 0; row < procRows; ++row)
+    if (auto it = protocols.find({routes.prefix(row), routes.nexthop(row)});
+        it != protocols.end())
+      routes.setProtocol(row, it->second);
+  for (auto &grc : netlinkRoutes) {
+    size_t row = 0;
+    while (row < procRows && (grc.vrf || routes.prefix(row) != grc.prefix))
+      ++row;
+    if (row < procRows)
+      routes.assign(row, grc);
+    else
+      routes.push_back(grc);
+  }
+
+  if (!vrf)
+    return routes;
+  RouteTable inTable;
+  for (size_t row = 0; row < routes.size(); ++row)
+    if (routes.table(row) == vrf->table)
+      inTable.push_back(routes, row);
+  return inTable;
+}
+
+std::vector<RouteConfig> SystemConfigurationManager::GetStaticRoutes(
+    const std::optional<VRFConfig> &vrf) const {
+  return GetRouteTable(vrf).toVector();
 }
 
 std::vector<RouteConfig> SystemConfigurationManager::GetRoutes(
@@ -147,35 +416,27 @@ std::vector<RouteConfig> SystemConfigurationManager::GetRoutes(
   return GetStaticRoutes(vrf);
 }
 
-void SystemConfigurationManager::AddRoute(const RouteConfig &route) const {
-  int sock = socket(AF_INET, SOCK_DGRAM, 0);
-  if (sock < 0)
+// SIOCADDRT on an already open socket; IPv4 only.
+static void add_route_ioctl(int sock, const RouteConfig &route) {
+  const IPPrefix &net = route.prefix;
+  if (!net.isV4())
     return;
 
   struct rtentry rt{};
   memset(&rt, 0, sizeof(rt));
 
-  auto net = IPNetwork::fromString(route.prefix);
-  if (!net) {
-    close(sock);
-    return;
-  }
-
   struct sockaddr_in *dst = (struct sockaddr_in *)&rt.rt_dst;
   dst->sin_family = AF_INET;
-  inet_pton(AF_INET, net->address()->toString().c_str(), &dst->sin_addr);
+  dst->sin_addr.s_addr = htonl(net.v4Value());
 
   struct sockaddr_in *mask = (struct sockaddr_in *)&rt.rt_genmask;
   mask->sin_family = AF_INET;
-  auto m = IPAddress::maskFromCIDR(AddressFamily::IPv4, net->mask());
-  if (m) {
-    inet_pton(AF_INET, m->toString().c_str(), &mask->sin_addr);
-  }
+  mask->sin_addr.s_addr = htonl(IPPrefix::maskV4(net.length()));
 
   if (route.nexthop) {
     struct sockaddr_in *gw = (struct sockaddr_in *)&rt.rt_gateway;
     gw->sin_family = AF_INET;
-    inet_pton(AF_INET, route.nexthop->c_str(), &gw->sin_addr);
+    gw->sin_addr.s_addr = htonl(route.nexthop->v4Value());
     rt.rt_flags |= RTF_GATEWAY;
   }
 
@@ -185,10 +446,49 @@ void SystemConfigurationManager::AddRoute(const RouteConfig &route) const {
   }
 
   ioctl(sock, SIOCADDRT, &rt);
+}
+
+void SystemConfigurationManager::AddRoute(const RouteConfig &route) const {
+  if (needs_netlink(route)) {
+    netlink_route_op(route, RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE);
+    return;
+  }
+
+  int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if (sock < 0)
+    return;
+  add_route_ioctl(sock, route);
   close(sock);
 }
 
+void SystemConfigurationManager::AddRoutes(
+    const std::vector<RouteConfig> &routes) const {
+  // One ioctl socket for the whole batch instead of one per route.
+  std::optional<Socket> sock;
+  for (const auto &route : routes) {
+    if (needs_netlink(route)) {
+      netlink_route_op(route, RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE);
+      continue;
+    }
+    if (!sock)
+      sock.emplace(AF_INET, SOCK_DGRAM);
+    add_route_ioctl(*sock, route);
+  }
+}
+
+// NLM_F_REPLACE swaps the route for the prefix in place, so the prefix is
+// never left unrouted; SIOCADDRT has no equivalent.
+void SystemConfigurationManager::ReplaceRoute(const RouteConfig & /*was*/,
+                                              const RouteConfig &want) const {
+  netlink_route_op(want, RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE);
+}
+
 void SystemConfigurationManager::DeleteRoute(const RouteConfig &route) const {
+  if (needs_netlink(route)) {
+    netlink_route_op(route, RTM_DELROUTE, 0);
+    return;
+  }
+
   int sock = socket(AF_INET, SOCK_DGRAM, 0);
   if (sock < 0)
     return;
@@ -196,22 +496,19 @@ void SystemConfigurationManager::DeleteRoute(const RouteConfig &route) const {
   struct rtentry rt{};
   memset(&rt, 0, sizeof(rt));
 
-  auto net = IPNetwork::fromString(route.prefix);
-  if (!net) {
+  const IPPrefix &net = route.prefix;
+  if (!net.isV4()) {
     close(sock);
     return;
   }
 
   struct sockaddr_in *dst = (struct sockaddr_in *)&rt.rt_dst;
   dst->sin_family = AF_INET;
-  inet_pton(AF_INET, net->address()->toString().c_str(), &dst->sin_addr);
+  dst->sin_addr.s_addr = htonl(net.v4Value());
 
   struct sockaddr_in *mask = (struct sockaddr_in *)&rt.rt_genmask;
   mask->sin_family = AF_INET;
-  auto m = IPAddress::maskFromCIDR(AddressFamily::IPv4, net->mask());
-  if (m) {
-    inet_pton(AF_INET, m->toString().c_str(), &mask->sin_addr);
-  }
+  mask->sin_addr.s_addr = htonl(IPPrefix::maskV4(net.length()));
 
   ioctl(sock, SIOCDELRT, &rt);
   close(sock);
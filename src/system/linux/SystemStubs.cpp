@@ -36,7 +36,6 @@
 #include "OvpnInterfaceConfig.hpp"
 #include "PflogInterfaceConfig.hpp"
 #include "PfsyncInterfaceConfig.hpp"
-#include "PolicyConfig.hpp"
 #include "SixToFourInterfaceConfig.hpp"
 #include "SystemConfigurationManager.hpp"
 #include "TapInterfaceConfig.hpp"
@@ -149,15 +148,6 @@ void SystemConfigurationManager::CreateEpair(const std::string &name
 void SystemConfigurationManager::SaveEpair(const EpairInterfaceConfig &epair
                                            [[maybe_unused]]) const {}
 
-std::vector<PolicyConfig> SystemConfigurationManager::GetPolicies(
-    const std::optional<uint32_t> &acl_filter [[maybe_unused]]) const {
-  return {};
-}
-void SystemConfigurationManager::SetPolicy(const PolicyConfig &pc
-                                           [[maybe_unused]]) const {}
-void SystemConfigurationManager::DeletePolicy(const PolicyConfig &pc
-                                              [[maybe_unused]]) const {}
-
 void SystemConfigurationManager::CreateSixToFour(const std::string &name
                                                  [[maybe_unused]]) const {}
 void SystemConfigurationManager::SaveSixToFour(const SixToFourInterfaceConfig &t
@@ -27,32 +27,36 @@
 
 #include "SystemConfigurationManager.hpp"
 #include "TapInterfaceConfig.hpp"
-#include <cstring>
-#include <fcntl.h>
-#include <linux/if_tun.h>
-#include <net/if.h>
-#include <sys/ioctl.h>
-#include <unistd.h>
 
 void SystemConfigurationManager::CreateTap(const std::string &name) const {
-  int fd = open("/dev/net/tun", O_RDWR);
-  if (fd < 0)
-    return;
-
-  struct ifreq ifr{};
-  ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
-  if (!name.empty()) {
-    std::strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
-  }
+  configureTunTap(name, true, std::nullopt, std::nullopt, std::nullopt,
+                  std::nullopt);
+}
 
-  ioctl(fd, TUNSETIFF, &ifr);
-  ioctl(fd, TUNSETPERSIST, 1);
-  close(fd);
+void SystemConfigurationManager::SaveTap(const TapInterfaceConfig &tap) const {
+  configureTunTap(tap.name, true, tap.queues, tap.owner, tap.owner_group,
+                  tap.vnet_hdr);
 }
 
-void SystemConfigurationManager::SaveTap(const TapInterfaceConfig &tap
-                                         [[maybe_unused]]) const {
-  if (!InterfaceExists(tap.name)) {
-    CreateTap(tap.name);
+std::vector<TapInterfaceConfig> SystemConfigurationManager::GetTapInterfaces(
+    const std::vector<InterfaceConfig> &bases) const {
+  std::vector<TapInterfaceConfig> out;
+  auto links = query_tuntap_links();
+  for (const auto &ic : bases) {
+    if (ic.type != InterfaceType::Tap)
+      continue;
+    TapInterfaceConfig tc(ic);
+    if (auto it = links.find(ic.name); it != links.end()) {
+      const auto &l = it->second;
+      tc.multi_queue = l.multi_queue;
+      tc.vnet_hdr = l.vnet_hdr;
+      tc.tx_queues = l.tx_queues;
+      tc.rx_queues = l.rx_queues;
+      tc.attached_queues = l.attached_queues;
+      tc.owner = l.owner;
+      tc.owner_group = l.group;
+    }
+    out.push_back(std::move(tc));
   }
+  return out;
 }
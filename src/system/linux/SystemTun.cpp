@@ -27,45 +27,256 @@
 
 #include "SystemConfigurationManager.hpp"
 #include "TunInterfaceConfig.hpp"
+#include <cerrno>
 #include <cstring>
 #include <fcntl.h>
-#include <linux/if_tun.h>
+#include <grp.h>
 #include <net/if.h>
+#include <linux/if_link.h>
+#include <linux/if_tun.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <pwd.h>
+#include <stdexcept>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
-void SystemConfigurationManager::CreateTun(const std::string &name) const {
-  int fd = open("/dev/net/tun", O_RDWR);
-  if (fd < 0)
-    return;
+namespace {
 
-  struct ifreq ifr{};
-  ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
-  if (!name.empty()) {
-    std::strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+  // Upper bound on queues per device (MAX_TAP_QUEUES in drivers/net/tun.c).
+  constexpr int kMaxTunQueues = 256;
+
+  bool all_digits(const std::string &s) {
+    return !s.empty() &&
+           s.find_first_not_of("0123456789") == std::string::npos;
+  }
+
+  uid_t resolve_uid(const std::string &owner) {
+    if (all_digits(owner))
+      return static_cast<uid_t>(std::stoul(owner));
+    struct passwd *pw = getpwnam(owner.c_str());
+    if (!pw)
+      throw std::runtime_error("unknown user '" + owner + "'");
+    return pw->pw_uid;
+  }
+
+  gid_t resolve_gid(const std::string &group) {
+    if (all_digits(group))
+      return static_cast<gid_t>(std::stoul(group));
+    struct group *gr = getgrnam(group.c_str());
+    if (!gr)
+      throw std::runtime_error("unknown group '" + group + "'");
+    return gr->gr_gid;
+  }
+
+  std::string user_name(uid_t uid) {
+    struct passwd *pw = getpwuid(uid);
+    return pw ? std::string(pw->pw_name) : std::to_string(uid);
+  }
+
+  std::string group_name(gid_t gid) {
+    struct group *gr = getgrgid(gid);
+    return gr ? std::string(gr->gr_name) : std::to_string(gid);
+  }
+
+  void parse_tun_info(struct rtattr *info, int len,
+                      SystemConfigurationManager::TunTapLink &link) {
+    for (struct rtattr *a = info; RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+      switch (a->rta_type) {
+      case IFLA_TUN_TYPE:
+        link.tap = *(uint8_t *)RTA_DATA(a) == IFF_TAP;
+        break;
+      case IFLA_TUN_OWNER:
+        link.owner = user_name(*(uint32_t *)RTA_DATA(a));
+        break;
+      case IFLA_TUN_GROUP:
+        link.group = group_name(*(uint32_t *)RTA_DATA(a));
+        break;
+      case IFLA_TUN_PI:
+        link.pi = *(uint8_t *)RTA_DATA(a) != 0;
+        break;
+      case IFLA_TUN_VNET_HDR:
+        link.vnet_hdr = *(uint8_t *)RTA_DATA(a) != 0;
+        break;
+      case IFLA_TUN_MULTI_QUEUE:
+        link.multi_queue = *(uint8_t *)RTA_DATA(a) != 0;
+        break;
+      case IFLA_TUN_NUM_QUEUES:
+        link.attached_queues = static_cast<int>(*(uint32_t *)RTA_DATA(a));
+        break;
+      }
+    }
+  }
+
+} // namespace
+
+std::map<std::string, SystemConfigurationManager::TunTapLink>
+SystemConfigurationManager::query_tuntap_links() const {
+  std::map<std::string, TunTapLink> out;
+
+  int sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+  if (sock < 0)
+    return out;
+
+  struct {
+    struct nlmsghdr n;
+    struct ifinfomsg ifi;
+  } req{};
+  req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+  req.n.nlmsg_type = RTM_GETLINK;
+  req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+  req.ifi.ifi_family = AF_UNSPEC;
+  if (send(sock, &req, req.n.nlmsg_len, 0) < 0) {
+    close(sock);
+    return out;
+  }
+
+  char buf[32768];
+  for (bool done = false; !done;) {
+    ssize_t len = recv(sock, buf, sizeof(buf), 0);
+    if (len <= 0)
+      break;
+    struct nlmsghdr *nh = (struct nlmsghdr *)buf;
+    for (; NLMSG_OK(nh, static_cast<uint32_t>(len));
+         nh = NLMSG_NEXT(nh, len)) {
+      if (nh->nlmsg_type == NLMSG_DONE || nh->nlmsg_type == NLMSG_ERROR) {
+        done = true;
+        break;
+      }
+      if (nh->nlmsg_type != RTM_NEWLINK)
+        continue;
+
+      auto *ifi = (struct ifinfomsg *)NLMSG_DATA(nh);
+      int alen = IFLA_PAYLOAD(nh);
+      std::string name;
+      bool is_tun = false;
+      TunTapLink link;
+      for (struct rtattr *a = IFLA_RTA(ifi); RTA_OK(a, alen);
+           a = RTA_NEXT(a, alen)) {
+        if (a->rta_type == IFLA_IFNAME) {
+          name = (const char *)RTA_DATA(a);
+        } else if (a->rta_type == IFLA_NUM_TX_QUEUES) {
+          link.tx_queues = static_cast<int>(*(uint32_t *)RTA_DATA(a));
+        } else if (a->rta_type == IFLA_NUM_RX_QUEUES) {
+          link.rx_queues = static_cast<int>(*(uint32_t *)RTA_DATA(a));
+        } else if (a->rta_type == IFLA_LINKINFO) {
+          int ilen = RTA_PAYLOAD(a);
+          for (struct rtattr *li = (struct rtattr *)RTA_DATA(a);
+               RTA_OK(li, ilen); li = RTA_NEXT(li, ilen)) {
+            if (li->rta_type == IFLA_INFO_KIND)
+              is_tun = std::strcmp((const char *)RTA_DATA(li), "tun") == 0;
+            else if (li->rta_type == IFLA_INFO_DATA)
+              parse_tun_info((struct rtattr *)RTA_DATA(li), RTA_PAYLOAD(li),
+                             link);
+          }
+        }
+      }
+      if (is_tun && !name.empty())
+        out[name] = link;
+    }
   }
 
-  ioctl(fd, TUNSETIFF, &ifr);
+  close(sock);
+  return out;
+}
+
+void SystemConfigurationManager::configureTunTap(
+    const std::string &name, bool tap, const std::optional<int> &queues,
+    const std::optional<std::string> &owner,
+    const std::optional<std::string> &group,
+    const std::optional<bool> &vnet_hdr) const {
+  if (queues && (*queues < 1 || *queues > kMaxTunQueues))
+    throw std::runtime_error("queues must be between 1 and " +
+                             std::to_string(kMaxTunQueues));
+
+  auto links = query_tuntap_links();
+  auto it = links.find(name);
+  const TunTapLink *cur = it != links.end() ? &it->second : nullptr;
+  if (!cur && InterfaceExists(name))
+    throw std::runtime_error("'" + name + "' is not a tun/tap device");
+
+  // The driver fixes the queue mode when the device is allocated; attaching
+  // with a different IFF_MULTI_QUEUE setting fails with EINVAL.
+  bool multi = cur ? cur->multi_queue : (queues && *queues > 1);
+  if (cur) {
+    if (cur->tap != tap)
+      throw std::runtime_error("'" + name + "' is a " +
+                               (cur->tap ? "tap" : "tun") + " device");
+    if (queues && (*queues > 1) != multi)
+      throw std::runtime_error("queue mode of '" + name +
+                               "' can only be chosen at creation; delete "
+                               "the interface first");
+    if (!owner && !group && (!vnet_hdr || *vnet_hdr == cur->vnet_hdr))
+      return;
+  }
+
+  short flags = tap ? IFF_TAP : IFF_TUN;
+  if (!cur || !cur->pi)
+    flags |= IFF_NO_PI;
+  if (multi)
+    flags |= IFF_MULTI_QUEUE;
+  if (vnet_hdr ? *vnet_hdr : (cur && cur->vnet_hdr))
+    flags |= IFF_VNET_HDR;
+
+  int fd = open("/dev/net/tun", O_RDWR | O_CLOEXEC);
+  if (fd < 0)
+    throw std::runtime_error(std::string("/dev/net/tun: ") +
+                             std::strerror(errno));
+
+  auto fail = [&](const char *what) {
+    int err = errno;
+    close(fd);
+    throw std::runtime_error(std::string(what) + " on '" + name +
+                             "': " + std::strerror(err));
+  };
+
+  // Attaching sets the feature flags (vnet header, PI) for the whole device.
+  struct ifreq ifr{};
+  ifr.ifr_flags = flags;
+  std::strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+  if (ioctl(fd, TUNSETIFF, &ifr) < 0)
+    fail("TUNSETIFF");
+  if (owner && ioctl(fd, TUNSETOWNER, resolve_uid(*owner)) < 0)
+    fail("TUNSETOWNER");
+  if (group && ioctl(fd, TUNSETGROUP, resolve_gid(*group)) < 0)
+    fail("TUNSETGROUP");
   // In Linux, the interface usually disappears when the FD is closed,
   // unless TUNSETPERSIST is used.
-  ioctl(fd, TUNSETPERSIST, 1);
+  if (!cur && ioctl(fd, TUNSETPERSIST, 1) < 0)
+    fail("TUNSETPERSIST");
   close(fd);
 }
 
-void SystemConfigurationManager::SaveTun(const TunInterfaceConfig &tun
-                                         [[maybe_unused]]) const {
-  if (!InterfaceExists(tun.name)) {
-    CreateTun(tun.name);
-  }
+void SystemConfigurationManager::CreateTun(const std::string &name) const {
+  configureTunTap(name, false, std::nullopt, std::nullopt, std::nullopt,
+                  std::nullopt);
+}
+
+void SystemConfigurationManager::SaveTun(const TunInterfaceConfig &tun) const {
+  configureTunTap(tun.name, false, tun.queues, tun.owner, tun.owner_group,
+                  tun.vnet_hdr);
 }
 
 std::vector<TunInterfaceConfig> SystemConfigurationManager::GetTunInterfaces(
-    const std::vector<InterfaceConfig> &bases [[maybe_unused]]) const {
+    const std::vector<InterfaceConfig> &bases) const {
   std::vector<TunInterfaceConfig> out;
+  auto links = query_tuntap_links();
   for (const auto &ic : bases) {
-    if (ic.type == InterfaceType::Tun) {
-      out.emplace_back(ic);
+    if (ic.type != InterfaceType::Tun)
+      continue;
+    TunInterfaceConfig tc(ic);
+    if (auto it = links.find(ic.name); it != links.end()) {
+      const auto &l = it->second;
+      tc.multi_queue = l.multi_queue;
+      tc.vnet_hdr = l.vnet_hdr;
+      tc.tx_queues = l.tx_queues;
+      tc.rx_queues = l.rx_queues;
+      tc.attached_queues = l.attached_queues;
+      tc.owner = l.owner;
+      tc.owner_group = l.group;
     }
+    out.push_back(std::move(tc));
   }
   return out;
 }
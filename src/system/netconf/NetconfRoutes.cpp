@@ -16,3 +16,11 @@ void NetconfConfigurationManager::AddRoute(
     const RouteConfig & /*route*/) const {}
 void NetconfConfigurationManager::DeleteRoute(
     const RouteConfig & /*route*/) const {}
+std::vector<NexthopGroupConfig>
+NetconfConfigurationManager::GetNexthopGroups() const {
+  return {};
+}
+void NetconfConfigurationManager::SetNexthopGroup(
+    const NexthopGroupConfig & /*group*/) const {}
+void NetconfConfigurationManager::DeleteNexthopGroup(
+    const NexthopGroupConfig & /*group*/) const {}
@@ -8,3 +8,7 @@ void NetconfConfigurationManager::CreateTap(
     const std::string & /*name*/) const {}
 void NetconfConfigurationManager::SaveTap(
     const TapInterfaceConfig & /*tap*/) const {}
+std::vector<TapInterfaceConfig> NetconfConfigurationManager::GetTapInterfaces(
+    const std::vector<InterfaceConfig> & /*bases*/) const {
+  return {};
+}